@@ -0,0 +1,225 @@
+// Benchmark headless do ProjectileSystem: mede Update + coleta de colisões por tipo de projétil.
+// Build: `make bench` (dentro de ./game). Uso: ./projectile_bench [filtro-de-tipo]
+#include "projectile.h"
+#include "alloc_stats.h"
+#include "game_data.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Contador global de alocações feitas enquanto o benchmark roda.
+std::atomic<std::uint64_t> g_allocationCount{0};
+
+} // namespace
+
+// Com ALLOC_TRACKING=TRUE o alloc_stats.o já substitui operator new/delete; o benchmark lê os contadores dele.
+#if !defined(GAME_ALLOC_TRACKING)
+
+void* operator new(std::size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+#endif
+
+namespace {
+
+constexpr float kTickSeconds = 1.0f / 60.0f;
+constexpr float kWorldSize = 1200.0f;
+constexpr float kTargetRadius = 24.0f;
+constexpr int kMinTicks = 5;
+constexpr int kMaxTicks = 240;
+constexpr double kScenarioBudgetSeconds = 0.25;
+
+const int kProjectileCounts[] = {10, 100, 1000, 5000};
+const int kTargetCounts[] = {1, 100, 1000};
+
+// Tipo medido e blueprint usado para gerá-lo.
+struct BenchKind {
+    const char* name;
+    const ProjectileBlueprint* blueprint;
+};
+
+// Alvo circular estático com id estável para o rastreio de hits por alvo.
+struct BenchTarget {
+    Vector2 center{};
+    std::uintptr_t id{0};
+};
+
+// Resultado agregado de um cenário.
+struct BenchResult {
+    int ticks{0};
+    double nsPerProjectileTick{0.0};
+    double allocationsPerTick{0.0};
+    double damageEventsPerTick{0.0};
+    double damageEventsPerSecond{0.0};
+};
+
+// Total de alocações desde o início (chamar fora da região cronometrada).
+std::uint64_t AllocationCount() {
+#if defined(GAME_ALLOC_TRACKING)
+    EndAllocStatsFrame();
+    g_allocationCount.fetch_add(GetLastAllocFrameStats().totals.allocations, std::memory_order_relaxed);
+#endif
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+// Projétil da arma em assets/data/weapons.txt (nullptr se a arma não existe).
+const ProjectileBlueprint* WeaponProjectile(const char* weaponName) {
+    const WeaponBlueprint* weapon = FindWeaponBlueprint(weaponName);
+    return (weapon != nullptr) ? &weapon->projectile : nullptr;
+}
+
+// Variante "ranged" isolada: só a arma exibida, sem os projéteis arremessados.
+const ProjectileBlueprint* GetRangedDisplayOnlyBlueprint() {
+    static const ProjectileBlueprint blueprint = [] {
+        const ProjectileBlueprint* bow = WeaponProjectile("Arco Simples");
+        ProjectileBlueprint copy = (bow != nullptr) ? *bow : ProjectileBlueprint{};
+        copy.thrownProjectiles.clear();
+        return copy;
+    }();
+    return &blueprint;
+}
+
+Vector2 RandomPoint(std::mt19937& rng) {
+    std::uniform_real_distribution<float> dist(0.0f, kWorldSize);
+    return Vector2{dist(rng), dist(rng)};
+}
+
+// Repõe a população de projéteis até o alvo do cenário (fora da região cronometrada).
+void Refill(ProjectileSystem& system, const ProjectileBlueprint& blueprint, int desired, std::mt19937& rng) {
+    std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * PI);
+    while (static_cast<int>(system.ActiveCount()) < desired) {
+        float angle = angleDist(rng);
+        ProjectileSpawnContext context{};
+        context.origin = RandomPoint(rng);
+        context.aimDirection = Vector2{std::cos(angle), std::sin(angle)};
+        std::size_t before = system.ActiveCount();
+        system.SpawnProjectile(blueprint, context);
+        if (system.ActiveCount() == before) {
+            break;
+        }
+    }
+}
+
+BenchResult RunScenario(const ProjectileBlueprint& blueprint, int projectileCount, int targetCount) {
+    std::mt19937 rng(1337u + static_cast<unsigned>(projectileCount * 31 + targetCount));
+
+    std::vector<BenchTarget> targets;
+    targets.reserve(targetCount);
+    for (int i = 0; i < targetCount; ++i) {
+        targets.push_back(BenchTarget{RandomPoint(rng), static_cast<std::uintptr_t>(i + 1)});
+    }
+
+    ProjectileSystem system;
+    Refill(system, blueprint, projectileCount, rng);
+
+    using Clock = std::chrono::steady_clock;
+    std::chrono::nanoseconds elapsed{0};
+    std::uint64_t allocations = 0;
+    std::uint64_t damageEvents = 0;
+    std::uint64_t projectileTicks = 0;
+    int ticks = 0;
+
+    while (ticks < kMaxTicks) {
+        if (ticks >= kMinTicks && std::chrono::duration<double>(elapsed).count() >= kScenarioBudgetSeconds) {
+            break;
+        }
+
+        std::size_t activeAtStart = system.ActiveCount();
+        std::uint64_t allocationsBefore = AllocationCount();
+        auto start = Clock::now();
+
+        system.Update(kTickSeconds);
+        for (const BenchTarget& target : targets) {
+            damageEvents += system.CollectDamageEvents(target.center, kTargetRadius, target.id, 0.0f).size();
+        }
+
+        elapsed += Clock::now() - start;
+        allocations += AllocationCount() - allocationsBefore;
+        projectileTicks += activeAtStart;
+        ++ticks;
+
+        Refill(system, blueprint, projectileCount, rng);
+    }
+
+    BenchResult result{};
+    result.ticks = ticks;
+    double totalNs = static_cast<double>(elapsed.count());
+    double totalSeconds = totalNs * 1e-9;
+    result.nsPerProjectileTick = (projectileTicks > 0) ? totalNs / static_cast<double>(projectileTicks) : 0.0;
+    result.allocationsPerTick = static_cast<double>(allocations) / ticks;
+    result.damageEventsPerTick = static_cast<double>(damageEvents) / ticks;
+    result.damageEventsPerSecond = (totalSeconds > 0.0) ? static_cast<double>(damageEvents) / totalSeconds : 0.0;
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* filter = (argc > 1) ? argv[1] : nullptr;
+    if (!LoadGameData("assets/data")) {
+        return 1;
+    }
+
+    const BenchKind kinds[] = {
+        {"blunt", WeaponProjectile("Broquel")},
+        {"swing", WeaponProjectile("Espada Curta")},
+        {"spear", WeaponProjectile("Machadinha")},
+        {"full-circle", WeaponProjectile("Espada Runica")},
+        {"ranged", GetRangedDisplayOnlyBlueprint()},
+        {"thrown-ammunition", WeaponProjectile("Arco Simples")},
+        {"thrown-laser", WeaponProjectile("Cajado de Carvalho")},
+    };
+
+    std::printf("%-18s %6s %7s %6s %14s %12s %14s %16s\n",
+                "kind", "proj", "targets", "ticks", "ns/proj/tick", "allocs/tick", "events/tick", "events/s");
+
+    for (const BenchKind& kind : kinds) {
+        if (filter != nullptr && std::strstr(kind.name, filter) == nullptr) {
+            continue;
+        }
+        if (kind.blueprint == nullptr) {
+            std::fprintf(stderr, "%s: arma ausente em assets/data/weapons.txt\n", kind.name);
+            continue;
+        }
+        for (int projectileCount : kProjectileCounts) {
+            for (int targetCount : kTargetCounts) {
+                BenchResult result = RunScenario(*kind.blueprint, projectileCount, targetCount);
+                std::printf("%-18s %6d %7d %6d %14.1f %12.1f %14.1f %16.0f\n",
+                            kind.name,
+                            projectileCount,
+                            targetCount,
+                            result.ticks,
+                            result.nsPerProjectileTick,
+                            result.allocationsPerTick,
+                            result.damageEventsPerTick,
+                            result.damageEventsPerSecond);
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,279 @@
+#include "alloc_stats.h"
+
+const char* AllocTagName(AllocTag tag) {
+    switch (tag) {
+        case AllocTag::Rooms:
+            return "rooms";
+        case AllocTag::Doors:
+            return "doors";
+        case AllocTag::Enemies:
+            return "enemies";
+        case AllocTag::Projectiles:
+            return "projectiles";
+        case AllocTag::DamageNumbers:
+            return "damage numbers";
+        case AllocTag::Hud:
+            return "hud";
+        case AllocTag::Inventory:
+            return "inventory";
+        case AllocTag::Other:
+        case AllocTag::Count:
+            break;
+    }
+    return "other";
+}
+
+#if defined(GAME_ALLOC_TRACKING)
+
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+namespace {
+
+// Cabeçalho gravado antes de cada bloco: ponteiro devolvido pelo malloc (para alinhamentos maiores que o padrão)
+// e, em sizeAndTag, o tamanho pedido (40 bits), a tag (8 bits) e uma marca (16 bits altos) para o delete descontar
+// do subsistema que alocou. A marca identifica blocos que não passaram pelo nosso new.
+struct AllocHeader {
+    void* raw;
+    std::uint64_t sizeAndTag;
+};
+static_assert(sizeof(AllocHeader) == 16, "Cabecalho de alocacao deve ter 16 bytes");
+
+constexpr unsigned kTagShift = 40;
+constexpr unsigned kMagicShift = 48;
+constexpr std::uint64_t kSizeMask = (std::uint64_t{1} << kTagShift) - 1;
+constexpr std::uint64_t kTagMask = 0xFF;
+constexpr std::uint64_t kMagic = 0xA11C;
+
+// Contadores do quadro atual; atômicos porque threads de fundo (decodificação de texturas) também alocam.
+struct AtomicTagCounters {
+    std::atomic<std::uint32_t> allocations;
+    std::atomic<std::uint32_t> frees;
+    std::atomic<std::uint64_t> bytes;
+};
+
+// Armazenamento estático com inicialização zero: válido mesmo para alocações antes de main.
+AtomicTagCounters g_frameCounters[kAllocTagCount];
+std::atomic<std::int64_t> g_liveBytes[kAllocTagCount];
+thread_local AllocTag t_currentTag = AllocTag::Other;
+
+// Acumulados para o resumo de saída (só a thread principal mexe, em EndAllocStatsFrame).
+struct TagSummary {
+    std::uint64_t allocations{0};
+    std::uint64_t bytes{0};
+    std::uint32_t peakAllocations{0};
+    std::uint64_t framesWithAllocations{0};
+};
+
+AllocFrameStats g_lastFrame{};
+TagSummary g_summary[kAllocTagCount]{};
+std::uint64_t g_frameCounter = 0;
+
+void* TrackedAllocate(std::size_t size, std::size_t alignment) {
+    if (alignment < alignof(std::max_align_t)) {
+        alignment = alignof(std::max_align_t);
+    }
+    void* raw = std::malloc(size + sizeof(AllocHeader) + alignment - 1);
+    if (raw == nullptr) {
+        return nullptr;
+    }
+    const std::uintptr_t first = reinterpret_cast<std::uintptr_t>(raw) + sizeof(AllocHeader);
+    const std::uintptr_t aligned = (first + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    AllocHeader* header = reinterpret_cast<AllocHeader*>(aligned) - 1;
+    const AllocTag tag = t_currentTag;
+    const std::size_t index = static_cast<std::size_t>(tag);
+    header->raw = raw;
+    header->sizeAndTag = (static_cast<std::uint64_t>(size) & kSizeMask) | (static_cast<std::uint64_t>(tag) << kTagShift) |
+                         (kMagic << kMagicShift);
+
+    g_frameCounters[index].allocations.fetch_add(1, std::memory_order_relaxed);
+    g_frameCounters[index].bytes.fetch_add(size, std::memory_order_relaxed);
+    g_liveBytes[index].fetch_add(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+    return reinterpret_cast<void*>(aligned);
+}
+
+void TrackedFree(void* pointer) {
+    if (pointer == nullptr) {
+        return;
+    }
+    AllocHeader* header = static_cast<AllocHeader*>(pointer) - 1;
+    const std::uint64_t sizeAndTag = header->sizeAndTag;
+    const std::size_t index = static_cast<std::size_t>((sizeAndTag >> kTagShift) & kTagMask);
+    const std::uintptr_t raw = reinterpret_cast<std::uintptr_t>(header->raw);
+    // Bloco sem a nossa marca (alocado por um new de fora, ex.: libstdc++ em DLL no mingw): devolve direto ao malloc.
+    // Tag válida e raw antes do cabeçalho reforçam a marca contra bytes de outro bloco que por acaso coincidam.
+    if ((sizeAndTag >> kMagicShift) != kMagic || index >= kAllocTagCount || raw == 0 ||
+        raw > reinterpret_cast<std::uintptr_t>(header)) {
+        std::free(pointer);
+        return;
+    }
+    const std::uint64_t size = sizeAndTag & kSizeMask;
+    // Libera na tag de quem alocou: bytes vivos por subsistema ficam corretos mesmo com donos trocando de escopo.
+    g_frameCounters[index].frees.fetch_add(1, std::memory_order_relaxed);
+    g_liveBytes[index].fetch_sub(static_cast<std::int64_t>(size), std::memory_order_relaxed);
+    header->sizeAndTag = 0;
+    std::free(header->raw);
+}
+
+// Mesmo contrato do operator new padrão: tenta o new_handler antes de lançar bad_alloc.
+void* AllocateOrThrow(std::size_t size, std::size_t alignment) {
+    for (;;) {
+        if (void* pointer = TrackedAllocate(size, alignment)) {
+            return pointer;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+} // namespace
+
+AllocScope::AllocScope(AllocTag tag)
+    : previous_(t_currentTag) {
+    t_currentTag = tag;
+}
+
+AllocScope::~AllocScope() {
+    t_currentTag = previous_;
+}
+
+void EndAllocStatsFrame() {
+    AllocFrameStats frame{};
+    frame.frameIndex = g_frameCounter++;
+    for (std::size_t i = 0; i < kAllocTagCount; ++i) {
+        AllocTagCounters& counters = frame.tags[i];
+        counters.allocations = g_frameCounters[i].allocations.exchange(0, std::memory_order_relaxed);
+        counters.frees = g_frameCounters[i].frees.exchange(0, std::memory_order_relaxed);
+        counters.bytes = g_frameCounters[i].bytes.exchange(0, std::memory_order_relaxed);
+        frame.totals.allocations += counters.allocations;
+        frame.totals.frees += counters.frees;
+        frame.totals.bytes += counters.bytes;
+
+        TagSummary& summary = g_summary[i];
+        summary.allocations += counters.allocations;
+        summary.bytes += counters.bytes;
+        if (counters.allocations > summary.peakAllocations) {
+            summary.peakAllocations = counters.allocations;
+        }
+        if (counters.allocations > 0) {
+            ++summary.framesWithAllocations;
+        }
+    }
+    g_lastFrame = frame;
+}
+
+const AllocFrameStats& GetLastAllocFrameStats() {
+    return g_lastFrame;
+}
+
+void PrintAllocStatsSummary() {
+    if (g_frameCounter == 0) {
+        return;
+    }
+    const double frames = static_cast<double>(g_frameCounter);
+    std::cerr << "[AllocStats] " << g_frameCounter << " quadros" << std::endl;
+    std::cerr << "[AllocStats] " << std::setw(15) << std::left << "subsistema" << std::right << std::setw(12)
+              << "allocs/q" << std::setw(10) << "pico/q" << std::setw(10) << "% quad." << std::setw(12) << "KB/q"
+              << std::setw(12) << "vivos KB" << std::endl;
+    std::cerr << std::fixed << std::setprecision(1);
+    for (std::size_t i = 0; i < kAllocTagCount; ++i) {
+        const TagSummary& summary = g_summary[i];
+        const std::int64_t liveBytes = g_liveBytes[i].load(std::memory_order_relaxed);
+        std::cerr << "[AllocStats] " << std::setw(15) << std::left << AllocTagName(static_cast<AllocTag>(i))
+                  << std::right << std::setw(12) << static_cast<double>(summary.allocations) / frames << std::setw(10)
+                  << summary.peakAllocations << std::setw(10)
+                  << 100.0 * static_cast<double>(summary.framesWithAllocations) / frames << std::setw(12)
+                  << static_cast<double>(summary.bytes) / frames / 1024.0 << std::setw(12)
+                  << static_cast<double>(liveBytes) / 1024.0 << std::endl;
+    }
+    std::cerr << std::defaultfloat;
+}
+
+// Substituições globais; todas as variantes passam pelos mesmos contadores.
+void* operator new(std::size_t size) {
+    return AllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size) {
+    return AllocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return TrackedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return TrackedAllocate(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return AllocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return TrackedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return TrackedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    TrackedFree(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept {
+    TrackedFree(pointer);
+}
+
+#endif
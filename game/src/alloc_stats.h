@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Contadores de alocação no heap por subsistema, compilados apenas com -DGAME_ALLOC_TRACKING (make ALLOC_TRACKING=TRUE).
+// Com a flag, operator new/delete globais são substituídos e cada alocação é atribuída ao AllocScope ativo na
+// thread; sem a flag os escopos e funções abaixo não fazem nada. Meta: zero alocações por quadro em regime.
+
+// Subsistemas medidos; alocações fora de um AllocScope contam como Other.
+enum class AllocTag : std::uint8_t {
+    Other = 0,
+    Rooms,         // Geração de salas e geometria de renderização
+    Doors,         // Pré-passe de portas do quadro (render data, máscaras, animação)
+    Enemies,       // Update/IA dos inimigos
+    Projectiles,   // Update, colisão e eventos de dano dos projéteis
+    DamageNumbers,
+    Hud,
+    Inventory,     // UI de inventário/loja/forja/baú, inclusive quebra de texto
+    Count
+};
+
+constexpr std::size_t kAllocTagCount = static_cast<std::size_t>(AllocTag::Count);
+
+// Totais de um subsistema em um quadro.
+struct AllocTagCounters {
+    std::uint32_t allocations{0};
+    std::uint32_t frees{0};
+    std::uint64_t bytes{0};        // Bytes pedidos pelas alocações
+};
+
+// Retrato de um quadro completo (entre duas chamadas de EndAllocStatsFrame).
+struct AllocFrameStats {
+    std::uint64_t frameIndex{0};
+    std::array<AllocTagCounters, kAllocTagCount> tags{};
+    AllocTagCounters totals{};
+};
+
+// Nome curto exibido no overlay/resumo.
+const char* AllocTagName(AllocTag tag);
+
+#if defined(GAME_ALLOC_TRACKING)
+
+// Marca o subsistema atual da thread enquanto viva; escopos aninhados restauram o anterior ao sair.
+class AllocScope {
+public:
+    explicit AllocScope(AllocTag tag);
+    ~AllocScope();
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+
+private:
+    AllocTag previous_;
+};
+
+// Fecha o quadro (uma vez por quadro, na thread principal): publica os contadores e acumula no resumo.
+void EndAllocStatsFrame();
+
+// Último quadro publicado por EndAllocStatsFrame.
+const AllocFrameStats& GetLastAllocFrameStats();
+
+// Imprime no console, por subsistema, média/pico de alocações por quadro, total de bytes e bytes ainda vivos.
+void PrintAllocStatsSummary();
+
+#else
+
+class AllocScope {
+public:
+    explicit AllocScope(AllocTag) {}
+};
+
+inline void EndAllocStatsFrame() {}
+inline void PrintAllocStatsSummary() {}
+
+#endif
@@ -0,0 +1,194 @@
+#include "asset_archive.h"
+
+#include <cstring>
+#include <iostream>
+#include <string_view>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#define NOUSER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Este módulo não inclui raylib.h de propósito: windows.h conflita com nomes da Raylib (Rectangle, CloseWindow...).
+
+namespace {
+
+// Região mapeada do arquivo ativo; somente leitura após OpenAssetArchive.
+struct MappedArchive {
+    const unsigned char* base{nullptr};
+    std::size_t size{0};
+    const AssetArchiveFormat::IndexEntry* entries{nullptr};
+    std::uint32_t entryCount{0};
+#if defined(_WIN32)
+    HANDLE file{INVALID_HANDLE_VALUE};
+    HANDLE mapping{nullptr};
+#endif
+};
+
+MappedArchive g_archive{};
+
+// Mapeia o arquivo inteiro como somente leitura.
+bool MapFile(const std::string& path, MappedArchive& archive) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    archive.file = file;
+    archive.mapping = mapping;
+    archive.base = static_cast<const unsigned char*>(view);
+    archive.size = static_cast<std::size_t>(fileSize.QuadPart);
+    return true;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info{};
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    archive.base = static_cast<const unsigned char*>(view);
+    archive.size = static_cast<std::size_t>(info.st_size);
+    return true;
+#endif
+}
+
+// Libera o mapeamento e zera o estado.
+void UnmapFile(MappedArchive& archive) {
+    if (archive.base != nullptr) {
+#if defined(_WIN32)
+        UnmapViewOfFile(archive.base);
+        CloseHandle(archive.mapping);
+        CloseHandle(archive.file);
+#else
+        munmap(const_cast<unsigned char*>(archive.base), archive.size);
+#endif
+    }
+    archive = MappedArchive{};
+}
+
+// Caminho armazenado na entrada como string_view apontando para o mapeamento.
+std::string_view EntryPath(const MappedArchive& archive, const AssetArchiveFormat::IndexEntry& entry) {
+    return std::string_view(reinterpret_cast<const char*>(archive.base + entry.pathOffset), entry.pathLength);
+}
+
+// Confere cabeçalho, limites de cada entrada e ordenação do índice antes de aceitar o arquivo.
+bool ValidateArchive(MappedArchive& archive) {
+    using namespace AssetArchiveFormat;
+    if (archive.size < sizeof(Header)) {
+        return false;
+    }
+    Header header{};
+    std::memcpy(&header, archive.base, sizeof(Header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion) {
+        return false;
+    }
+
+    std::size_t indexBytes = static_cast<std::size_t>(header.entryCount) * sizeof(IndexEntry);
+    if (indexBytes > archive.size - sizeof(Header)) {
+        return false;
+    }
+    archive.entries = reinterpret_cast<const IndexEntry*>(archive.base + sizeof(Header));
+    archive.entryCount = header.entryCount;
+
+    for (std::uint32_t i = 0; i < archive.entryCount; ++i) {
+        const IndexEntry& entry = archive.entries[i];
+        if (entry.pathOffset > archive.size || entry.pathLength > archive.size - entry.pathOffset) {
+            return false;
+        }
+        if (entry.dataOffset > archive.size || entry.dataSize > archive.size - entry.dataOffset) {
+            return false;
+        }
+        if (i > 0 && !(EntryPath(archive, archive.entries[i - 1]) < EntryPath(archive, entry))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool OpenAssetArchive(const std::string& archivePath) {
+    CloseAssetArchive();
+
+    MappedArchive archive{};
+    if (!MapFile(archivePath, archive)) {
+        return false;
+    }
+    if (!ValidateArchive(archive)) {
+        std::cerr << "[AssetArchive] Arquivo invalido, usando assets soltos: " << archivePath << std::endl;
+        UnmapFile(archive);
+        return false;
+    }
+
+    g_archive = archive;
+    return true;
+}
+
+void CloseAssetArchive() {
+    UnmapFile(g_archive);
+}
+
+bool IsAssetArchiveOpen() {
+    return g_archive.base != nullptr;
+}
+
+bool FindPackedAsset(const std::string& path, AssetBlob& outBlob) {
+    if (g_archive.base == nullptr || path.empty()) {
+        return false;
+    }
+
+    // Chaves do pack_assets são lexically_normal ("assets/img/..."); remove prefixos "./" sem alocar.
+    std::string_view key(path);
+    while (key.size() > 2 && key[0] == '.' && key[1] == '/') {
+        key.remove_prefix(2);
+    }
+    std::uint32_t low = 0;
+    std::uint32_t high = g_archive.entryCount;
+    while (low < high) {
+        std::uint32_t mid = low + (high - low) / 2;
+        const AssetArchiveFormat::IndexEntry& entry = g_archive.entries[mid];
+        int cmp = EntryPath(g_archive, entry).compare(key);
+        if (cmp == 0) {
+            outBlob.data = g_archive.base + entry.dataOffset;
+            outBlob.size = static_cast<std::size_t>(entry.dataSize);
+            return true;
+        }
+        if (cmp < 0) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return false;
+}
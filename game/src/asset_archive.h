@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Formato do arquivo empacotado (assets.pak), compartilhado entre o empacotador e o jogo.
+// Layout: Header | IndexEntry[entryCount] ordenado por caminho | tabela de strings | dados.
+namespace AssetArchiveFormat {
+constexpr char kMagic[4] = {'C', 'J', 'P', 'K'};
+constexpr std::uint32_t kVersion = 1;
+constexpr std::size_t kDataAlignment = 16;
+
+struct Header {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t entryCount;
+    std::uint32_t reserved;
+};
+
+struct IndexEntry {
+    std::uint32_t pathOffset; // Offset absoluto do caminho (sem terminador) no arquivo
+    std::uint32_t pathLength;
+    std::uint64_t dataOffset; // Offset absoluto dos bytes do asset
+    std::uint64_t dataSize;
+};
+} // namespace AssetArchiveFormat
+
+// Bytes de um asset dentro do arquivo mapeado; válidos até CloseAssetArchive.
+struct AssetBlob {
+    const unsigned char* data{nullptr};
+    std::size_t size{0};
+};
+
+// Recebe caminho do .pak, mapeia em memória e valida o índice; retorna false (e segue no disco) se ausente/inválido.
+bool OpenAssetArchive(const std::string& archivePath = "assets.pak");
+
+// Nao recebe parametros; desfaz o mapeamento (blobs devolvidos anteriormente deixam de ser válidos).
+void CloseAssetArchive();
+
+// Indica se há arquivo empacotado ativo.
+bool IsAssetArchiveOpen();
+
+// Busca binária no índice pelo caminho usado no código (ex.: "assets/img/...", prefixo "./" é ignorado);
+// seguro entre threads.
+bool FindPackedAsset(const std::string& path, AssetBlob& outBlob);
@@ -0,0 +1,200 @@
+#include "damage_numbers.h"
+
+#include "alloc_stats.h"
+#include "font_manager.h"
+#include "sprite_batch.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Glifos usados pelos números: dígitos, prefixo de recompensa e sufixo de crítico.
+constexpr char kGlyphChars[] = "0123456789+!";
+constexpr int kGlyphCount = static_cast<int>(sizeof(kGlyphChars) - 1);
+constexpr int kPlusGlyph = 10;
+constexpr int kBangGlyph = 11;
+
+// Maior texto possível: "+" + 10 dígitos de int + "!".
+constexpr int kMaxGlyphsPerNumber = 12;
+
+constexpr float kNormalFontSize = 24.0f;
+constexpr float kCriticalFontSize = 30.0f;
+constexpr float kRiseSpeed = 26.0f;
+
+// Métricas de um glifo na escala base da fonte (multiplicadas por fontSize / baseSize no layout).
+struct GlyphMetrics {
+    Rectangle source{}; // Retângulo na textura da fonte, já incluindo o padding
+    float offsetX{0.0f};
+    float offsetY{0.0f};
+    float advance{0.0f}; // Avanço do cursor, igual ao usado por DrawTextEx
+    float measure{0.0f}; // Largura contada por MeasureTextEx
+};
+
+// Cache das métricas de uma variante da fonte; refeito quando a textura/tamanho base da fonte muda.
+struct DigitGlyphCache {
+    unsigned int textureId{0};
+    int baseSize{0};
+    bool valid{false};
+    std::array<GlyphMetrics, kGlyphCount> glyphs{};
+};
+
+// Um cache por estilo (normal e crítico), já que cada um usa a variante do atlas do próprio tamanho.
+std::array<DigitGlyphCache, 2> g_glyphCaches{};
+
+// Lote reaproveitado entre quadros para os quads dos glifos.
+SpriteBatch g_glyphBatch;
+
+const DigitGlyphCache& ResolveGlyphCache(DigitGlyphCache& cache, const Font& font) {
+    if (cache.valid && cache.textureId == font.texture.id && cache.baseSize == font.baseSize) {
+        return cache;
+    }
+
+    cache = DigitGlyphCache{};
+    cache.textureId = font.texture.id;
+    cache.baseSize = font.baseSize;
+    if (font.recs == nullptr || font.glyphs == nullptr || font.baseSize <= 0) {
+        return cache;
+    }
+
+    const float padding = static_cast<float>(font.glyphPadding);
+    for (int i = 0; i < kGlyphCount; ++i) {
+        int index = GetGlyphIndex(font, kGlyphChars[i]);
+        const Rectangle& rec = font.recs[index];
+        const GlyphInfo& info = font.glyphs[index];
+        GlyphMetrics& metrics = cache.glyphs[i];
+        metrics.source = Rectangle{rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding};
+        metrics.offsetX = static_cast<float>(info.offsetX) - padding;
+        metrics.offsetY = static_cast<float>(info.offsetY) - padding;
+        metrics.advance = (info.advanceX != 0) ? static_cast<float>(info.advanceX) : rec.width;
+        metrics.measure = (info.advanceX != 0) ? static_cast<float>(info.advanceX) : rec.width + static_cast<float>(info.offsetX);
+    }
+    cache.valid = true;
+    return cache;
+}
+
+// Converte o número em índices de glifo (sem std::to_string); retorna quantos foram escritos.
+int BuildGlyphRun(const DamageNumber& number, std::array<int, kMaxGlyphsPerNumber>& outGlyphs) {
+    long displayValue = std::max(0L, std::lround(number.amount));
+
+    int digits[10];
+    int digitCount = 0;
+    do {
+        digits[digitCount++] = static_cast<int>(displayValue % 10);
+        displayValue /= 10;
+    } while (displayValue > 0 && digitCount < 10);
+
+    int count = 0;
+    if (number.isReward) {
+        outGlyphs[count++] = kPlusGlyph;
+    }
+    while (digitCount > 0) {
+        outGlyphs[count++] = digits[--digitCount];
+    }
+    if (!number.isReward && number.isCritical) {
+        outGlyphs[count++] = kBangGlyph;
+    }
+    return count;
+}
+
+} // namespace
+
+void DamageNumberPool::Clear() {
+    head_ = 0;
+    count_ = 0;
+}
+
+void DamageNumberPool::Push(const Vector2& position, float amount, bool isCritical, float lifetime, bool isReward) {
+    if (count_ == kCapacity) {
+        // Anel cheio: descarta o mais antigo.
+        head_ = (head_ + 1) % kCapacity;
+        --count_;
+    }
+
+    DamageNumber& number = entries_[(head_ + count_) % kCapacity];
+    number = DamageNumber{};
+    number.amount = amount;
+    number.isCritical = isCritical;
+    number.isReward = isReward;
+    number.lifetime = lifetime;
+    number.position = position;
+    ++count_;
+}
+
+void DamageNumberPool::Update(float deltaSeconds) {
+    for (std::size_t i = 0; i < count_; ++i) {
+        DamageNumber& number = entries_[(head_ + i) % kCapacity];
+        number.age += deltaSeconds;
+        number.position.y -= kRiseSpeed * deltaSeconds;
+    }
+
+    // Durações diferentes (crítico/recompensa) podem expirar fora de ordem; essas ficam até chegar à cabeça.
+    while (count_ > 0 && entries_[head_].age >= entries_[head_].lifetime) {
+        head_ = (head_ + 1) % kCapacity;
+        --count_;
+    }
+}
+
+void DamageNumberPool::Draw() const {
+    if (count_ == 0) {
+        return;
+    }
+    AllocScope allocScope(AllocTag::DamageNumbers);
+
+    const Font& normalFont = GetGameFont(kNormalFontSize);
+    const Font& criticalFont = GetGameFont(kCriticalFontSize);
+    const DigitGlyphCache& normalCache = ResolveGlyphCache(g_glyphCaches[0], normalFont);
+    const DigitGlyphCache& criticalCache = ResolveGlyphCache(g_glyphCaches[1], criticalFont);
+    if (!normalCache.valid || !criticalCache.valid) {
+        return;
+    }
+
+    auto regionOf = [](const Font& font) {
+        return TextureRegion{font.texture, Rectangle{0.0f, 0.0f, static_cast<float>(font.texture.width), static_cast<float>(font.texture.height)}};
+    };
+    const TextureRegion normalRegion = regionOf(normalFont);
+    const TextureRegion criticalRegion = regionOf(criticalFont);
+    std::array<int, kMaxGlyphsPerNumber> glyphs{};
+
+    for (std::size_t i = 0; i < count_; ++i) {
+        const DamageNumber& number = entries_[(head_ + i) % kCapacity];
+        float alpha = 1.0f - (number.age / number.lifetime);
+        if (alpha <= 0.0f) {
+            continue;
+        }
+
+        const float fontSize = number.isCritical ? kCriticalFontSize : kNormalFontSize;
+        const DigitGlyphCache& cache = number.isCritical ? criticalCache : normalCache;
+        const TextureRegion& fontRegion = number.isCritical ? criticalRegion : normalRegion;
+        const float scale = fontSize / static_cast<float>(cache.baseSize);
+        Color baseColor = number.isReward
+            ? Color{255, 227, 96, 255}
+            : (number.isCritical ? Color{255, 120, 120, 255} : Color{235, 235, 240, 255});
+        baseColor.a = static_cast<unsigned char>(std::clamp(alpha, 0.0f, 1.0f) * 255.0f);
+
+        int glyphCount = BuildGlyphRun(number, glyphs);
+
+        // Mesma largura que MeasureTextEx com spacing 0; altura é o próprio fontSize.
+        float width = 0.0f;
+        for (int g = 0; g < glyphCount; ++g) {
+            width += cache.glyphs[glyphs[g]].measure;
+        }
+        width *= scale;
+
+        float cursorX = number.position.x - width * 0.5f;
+        float originY = number.position.y - fontSize;
+        for (int g = 0; g < glyphCount; ++g) {
+            const GlyphMetrics& metrics = cache.glyphs[glyphs[g]];
+            Rectangle dest{
+                cursorX + metrics.offsetX * scale,
+                originY + metrics.offsetY * scale,
+                metrics.source.width * scale,
+                metrics.source.height * scale
+            };
+            g_glyphBatch.AddSprite(fontRegion, metrics.source, dest, Vector2{0.0f, 0.0f}, baseColor);
+            cursorX += metrics.advance * scale;
+        }
+    }
+
+    g_glyphBatch.Flush();
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "raylib.h"
+
+#include <array>
+#include <cstddef>
+
+// Dados temporários de um pop-up de dano desenhado na tela.
+struct DamageNumber {
+    Vector2 position{};
+    float amount{0.0f};
+    bool isCritical{false};
+    bool isReward{false};
+    float age{0.0f};
+    float lifetime{1.0f};
+};
+
+// Pool circular de capacidade fixa para números de dano: sem alocações por evento.
+// Quando cheio, o número mais antigo é sobrescrito. O texto é montado por dígitos a partir de
+// métricas de glifo em cache (sem std::string/MeasureTextEx) e desenhado em um único lote.
+class DamageNumberPool {
+public:
+    static constexpr std::size_t kCapacity = 128;
+
+    // Remove todos os números ativos.
+    void Clear();
+
+    // Cria uma nova entrada com valores padrão; isReward exibe "+N" em dourado.
+    void Push(const Vector2& position,
+              float amount,
+              bool isCritical,
+              float lifetime = 1.0f,
+              bool isReward = false);
+
+    // Avança timers, move números para cima e libera entradas expiradas na cabeça do anel.
+    void Update(float deltaSeconds);
+
+    // Desenha todos os números vivos com fade out usando a fonte atual do jogo.
+    void Draw() const;
+
+    bool Empty() const { return count_ == 0; }
+    std::size_t Size() const { return count_; }
+
+private:
+    std::array<DamageNumber, kCapacity> entries_{};
+    std::size_t head_{0};  // Índice do número mais antigo
+    std::size_t count_{0}; // Entradas entre head_ e head_ + count_ (algumas podem já ter expirado)
+};
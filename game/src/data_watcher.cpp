@@ -0,0 +1,119 @@
+#include "data_watcher.h"
+
+#if defined(GAME_HOT_RELOAD)
+
+#include <iostream>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#define NOUSER
+#include <windows.h>
+#elif defined(__linux__)
+#include <cerrno>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+// Assim como asset_archive.cpp, este módulo não inclui raylib.h (windows.h conflita com nomes da Raylib).
+
+DirectoryWatcher::~DirectoryWatcher() {
+    Stop();
+}
+
+bool DirectoryWatcher::Start(const std::string& directory) {
+    Stop();
+    directory_ = directory;
+
+#if defined(_WIN32)
+    HANDLE handle = FindFirstChangeNotificationA(directory.c_str(), FALSE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME);
+    if (handle == INVALID_HANDLE_VALUE) {
+        std::cerr << "[HotReload] Nao foi possivel observar " << directory << std::endl;
+        return false;
+    }
+    changeHandle_ = handle;
+    active_ = true;
+#elif defined(__linux__)
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        std::cerr << "[HotReload] inotify indisponivel" << std::endl;
+        return false;
+    }
+    // Editores costumam salvar gravando um arquivo temporário e renomeando, então MOVED_TO também conta.
+    if (inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+        std::cerr << "[HotReload] Nao foi possivel observar " << directory << std::endl;
+        close(fd);
+        return false;
+    }
+    inotifyFd_ = fd;
+    active_ = true;
+#else
+    std::cerr << "[HotReload] Observacao de arquivos nao suportada nesta plataforma" << std::endl;
+#endif
+    return active_;
+}
+
+void DirectoryWatcher::Stop() {
+#if defined(_WIN32)
+    if (changeHandle_ != nullptr) {
+        FindCloseChangeNotification(static_cast<HANDLE>(changeHandle_));
+        changeHandle_ = nullptr;
+    }
+#else
+    if (inotifyFd_ >= 0) {
+        close(inotifyFd_);
+        inotifyFd_ = -1;
+    }
+#endif
+    active_ = false;
+}
+
+bool DirectoryWatcher::Poll() {
+    if (!active_) {
+        return false;
+    }
+
+    bool changed = false;
+#if defined(_WIN32)
+    HANDLE handle = static_cast<HANDLE>(changeHandle_);
+    while (WaitForSingleObject(handle, 0) == WAIT_OBJECT_0) {
+        changed = true;
+        if (!FindNextChangeNotification(handle)) {
+            Stop();
+            break;
+        }
+    }
+#elif defined(__linux__)
+    // Só interessa saber se houve evento; o conteúdo (nome do arquivo) é descartado.
+    alignas(struct inotify_event) char buffer[4096];
+    for (;;) {
+        ssize_t bytes = read(inotifyFd_, buffer, sizeof(buffer));
+        if (bytes > 0) {
+            changed = true;
+            continue;
+        }
+        if (bytes < 0 && errno == EINTR) {
+            continue;
+        }
+        break; // EAGAIN: fila vazia
+    }
+#endif
+    return changed;
+}
+
+#else
+
+DirectoryWatcher::~DirectoryWatcher() = default;
+
+bool DirectoryWatcher::Start(const std::string& directory) {
+    directory_ = directory;
+    return false;
+}
+
+void DirectoryWatcher::Stop() {}
+
+bool DirectoryWatcher::Poll() {
+    return false;
+}
+
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+
+// Observa uma pasta e avisa quando algum arquivo dela foi gravado (recarga de dados em builds com GAME_HOT_RELOAD).
+// Linux usa inotify e Windows usa FindFirstChangeNotification; nos dois casos Poll é uma consulta não bloqueante.
+// Em outras plataformas Start falha e a recarga fica desativada.
+class DirectoryWatcher {
+public:
+    DirectoryWatcher() = default;
+    ~DirectoryWatcher();
+
+    DirectoryWatcher(const DirectoryWatcher&) = delete;
+    DirectoryWatcher& operator=(const DirectoryWatcher&) = delete;
+
+    // Recebe a pasta a observar (substitui a anterior); retorna false se a plataforma/pasta não suporta observação.
+    bool Start(const std::string& directory);
+
+    // Nao recebe parametros; para de observar e libera o handle do sistema.
+    void Stop();
+
+    // Retorna true se houve gravação na pasta desde a última chamada (eventos acumulados são consumidos juntos).
+    bool Poll();
+
+    bool IsActive() const { return active_; }
+    const std::string& Directory() const { return directory_; }
+
+private:
+    std::string directory_;
+    bool active_{false};
+#if defined(_WIN32)
+    void* changeHandle_{nullptr};
+#else
+    int inotifyFd_{-1};
+#endif
+};
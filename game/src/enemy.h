@@ -10,6 +10,7 @@
 class Room;
 class PlayerCharacter;
 class ProjectileSystem;
+class SpriteBatch;
 struct RoomLayout;
 
 // Configuração estática compartilhada por instâncias do mesmo inimigo.
@@ -47,6 +48,10 @@ public:
 
     virtual void Update(const EnemyUpdateContext& context) = 0;
     virtual void Draw(const EnemyDrawContext& context) const = 0;
+    // Acumula o desenho em um lote compartilhado; false indica que o inimigo precisa de Draw individual.
+    virtual bool AppendToBatch(SpriteBatch&, const EnemyDrawContext&) const { return false; }
+    // Id da textura GPU usada no quadro atual (0 = primitivas); agrupa desenhos na fila de renderização.
+    virtual unsigned int GetBatchTextureId() const { return 0; }
 
     void Initialize(Room& room, const Vector2& spawnPosition);
     void ResetSpawnState();
@@ -1,23 +1,19 @@
 #include "enemy_common.h"
 
+#include "sprite_batch.h"
 #include "projectile.h"
 #include "raymath.h"
+#include "render_stats.h"
 #include "room.h"
+#include "texture_manager.h"
 
 #include <algorithm>
-#include <cctype>
 #include <unordered_map>
 
 namespace {
 
-// Mantém texturas de inimigos em cache para evitar recarregamentos.
-
-struct CachedEnemyTexture {
-    Texture2D texture{};
-    bool attempted{false};
-};
-
-std::unordered_map<std::string, CachedEnemyTexture> g_enemyTextureCache;
+// Handles de sprites de inimigos mantidos vivos até ShutdownSpriteCache (evita recarregar a cada spawn).
+std::unordered_map<std::string, TextureHandle> g_enemyTextureHandles;
 
 constexpr float kHealthBarWidthPadding = 8.0f;
 constexpr float kHealthBarHeight = 2.0f;
@@ -26,56 +22,18 @@ constexpr float kHealthBarBackgroundThickness = 1.0f;
 const Color kHealthBarBackgroundColor = Color{12, 12, 18, 200};
 const Color kHealthBarFillColor = Color{196, 64, 64, 230};
 
-// Verifica sufixo ignorando caixa para tentar fallback de extensão.
-bool EndsWithExtension(const std::string& path, const std::string& extension) {
-    if (path.size() < extension.size()) {
-        return false;
-    }
-    return std::equal(extension.rbegin(), extension.rend(), path.rbegin(), [](char a, char b) {
-        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
-    });
-}
-
-// Carrega textura como está, aplicando filtro point se possível.
-Texture2D LoadTextureExact(const std::string& path) {
-    if (path.empty()) {
-        return Texture2D{};
-    }
-    if (!FileExists(path.c_str())) {
-        return Texture2D{};
-    }
-    Texture2D texture = LoadTexture(path.c_str());
-    if (texture.id != 0) {
-        SetTextureFilter(texture, TEXTURE_FILTER_POINT);
-    }
-    return texture;
-}
-
-// Tenta carregar arquivo e, se faltar extensão, força sufixo .png.
-Texture2D LoadTextureWithFallback(const std::string& rawPath) {
-    Texture2D texture = LoadTextureExact(rawPath);
-    if (texture.id != 0) {
-        return texture;
-    }
-
-    if (!rawPath.empty() && !EndsWithExtension(rawPath, ".png")) {
-        std::string fallbackPath = rawPath + ".png";
-        texture = LoadTextureExact(fallbackPath);
-    }
-    return texture;
-}
-
-// Retorna textura cacheada ou dispara carregamento lazy.
-Texture2D AcquireEnemyTexture(const std::string& path) {
+// Retorna handle compartilhado do sprite, adquirindo referência na primeira vez.
+TextureHandle AcquireEnemyTexture(const std::string& path) {
     if (path.empty()) {
-        return Texture2D{};
+        return kInvalidTextureHandle;
     }
-    auto& entry = g_enemyTextureCache[path];
-    if (!entry.attempted) {
-        entry.attempted = true;
-        entry.texture = LoadTextureWithFallback(path);
+    auto it = g_enemyTextureHandles.find(path);
+    if (it != g_enemyTextureHandles.end()) {
+        return it->second;
     }
-    return entry.texture;
+    TextureHandle handle = AcquireTexture(path, TEXTURE_FILTER_POINT);
+    g_enemyTextureHandles.emplace(path, handle);
+    return handle;
 }
 
 } // namespace
@@ -84,16 +42,11 @@ EnemyCommon::EnemyCommon(const EnemyConfig& config,
                          float range,
                          const WeaponBlueprint* weapon,
                          const EnemySpriteInfo& spriteInfo)
-    : Enemy(config), weapon_(weapon), range_(range), spriteInfo_(spriteInfo) {}
-
-// Carrega texturas de idle/caminhada apenas uma vez.
-void EnemyCommon::EnsureTexturesLoaded() const {
-    if (texturesLoaded_) {
-        return;
-    }
-    idleTexture_ = AcquireEnemyTexture(spriteInfo_.idleSpritePath);
-    walkingTexture_ = AcquireEnemyTexture(spriteInfo_.walkingSpriteSheetPath);
-    texturesLoaded_ = true;
+    : Enemy(config), weapon_(weapon), range_(range), spriteInfo_(spriteInfo) {
+    // Adquire já no spawn para que a decodificação assíncrona comece antes do primeiro desenho
+    // (desenhar só consulta os handles, sem checar carregamento a cada quadro).
+    idleTextureHandle_ = AcquireEnemyTexture(spriteInfo_.idleSpritePath);
+    walkingTextureHandle_ = AcquireEnemyTexture(spriteInfo_.walkingSpriteSheetPath);
 }
 
 // Movimenta o inimigo em direção ao jogador e administra ataques.
@@ -154,16 +107,12 @@ void EnemyCommon::AttemptAttack(const EnemyUpdateContext& context,
         return;
     }
 
-    ProjectileBlueprint projectile = weapon_->projectile;
-    projectile.common.damage = weapon_->damage.baseDamage;
-    projectile.common.criticalChance = weapon_->critical.baseChance;
-    projectile.common.criticalMultiplier = (weapon_->critical.multiplier > 0.0f) ? weapon_->critical.multiplier : 1.0f;
-
-    for (auto& thrown : projectile.thrownProjectiles) {
-        thrown.common.damage = weapon_->damage.baseDamage;
-        thrown.common.criticalChance = weapon_->critical.baseChance;
-        thrown.common.criticalMultiplier = (weapon_->critical.multiplier > 0.0f) ? weapon_->critical.multiplier : 1.0f;
-    }
+    ProjectileShotOverrides overrides{};
+    overrides.overrideDamage = true;
+    overrides.damage = weapon_->damage.baseDamage;
+    overrides.overrideCritical = true;
+    overrides.criticalChance = weapon_->critical.baseChance;
+    overrides.criticalMultiplier = (weapon_->critical.multiplier > 0.0f) ? weapon_->critical.multiplier : 1.0f;
 
     Vector2 aimDir = Vector2{1.0f, 0.0f};
     if (distanceToPlayer > 1e-5f) {
@@ -175,7 +124,7 @@ void EnemyCommon::AttemptAttack(const EnemyUpdateContext& context,
     spawnContext.followTarget = GetPositionAddress();
     spawnContext.aimDirection = aimDir;
 
-    context.projectileSystem.SpawnProjectile(projectile, spawnContext);
+    context.projectileSystem.SpawnProjectile(weapon_->projectile, spawnContext, overrides);
 
     float attackInterval = weapon_->cooldownSeconds;
     if (weapon_->cadence.baseAttacksPerSecond > 0.0f) {
@@ -199,32 +148,40 @@ void EnemyCommon::UpdateAnimation(float deltaSeconds, bool moving) {
     }
 }
 
-// Renderiza sprite e barra de vida com alpha baseado em fade.
+// Caminho sem lote: monta um lote de uma instância e descarrega na hora.
 void EnemyCommon::Draw(const EnemyDrawContext& context) const {
+    RenderStatsScope statsScope(RenderSubsystem::Enemies);
+    SpriteBatch batch;
+    AppendToBatch(batch, context);
+    batch.Flush();
+}
+
+// Acumula sprite (frame atual, espelhado conforme direção) e barra de vida com alpha baseado em fade.
+bool EnemyCommon::AppendToBatch(SpriteBatch& batch, const EnemyDrawContext& context) const {
     if (!IsAlive()) {
-        return;
+        return true;
     }
 
     float visibleAlpha = std::clamp(GetAlpha() * context.roomVisibility, 0.0f, 1.0f);
     if (visibleAlpha <= 0.0f) {
-        return;
+        return true;
     }
 
-    EnsureTexturesLoaded();
-
     Color tint{255, 255, 255, static_cast<unsigned char>(visibleAlpha * 255.0f)};
     Vector2 position = GetPosition();
 
-    auto drawTexture = [&](const Texture2D& texture, int frameWidth, int frameHeight, int frameIndex) {
-        if (texture.id == 0) {
+    auto addSprite = [&](const TextureRegion& sprite, int frameWidth, int frameHeight, int frameIndex) {
+        if (sprite.texture.id == 0) {
             return false;
         }
 
-        int columns = (frameWidth > 0) ? texture.width / frameWidth : 1;
+        const int spriteWidth = static_cast<int>(sprite.bounds.width);
+        const int spriteHeight = static_cast<int>(sprite.bounds.height);
+        int columns = (frameWidth > 0) ? spriteWidth / frameWidth : 1;
         if (columns <= 0) {
             columns = 1;
         }
-        int rows = (frameHeight > 0) ? texture.height / frameHeight : 1;
+        int rows = (frameHeight > 0) ? spriteHeight / frameHeight : 1;
         if (rows <= 0) {
             rows = 1;
         }
@@ -239,30 +196,32 @@ void EnemyCommon::Draw(const EnemyDrawContext& context) const {
 
         Rectangle dest{position.x, position.y, static_cast<float>(frameWidth), static_cast<float>(frameHeight)};
         Vector2 origin{static_cast<float>(frameWidth) * 0.5f, static_cast<float>(frameHeight)};
-        DrawTexturePro(texture, src, dest, origin, 0.0f, tint);
+        batch.AddSprite(sprite, src, dest, origin, tint);
         return true;
     };
 
+    const TextureRegion& walkingTexture = GetTextureRegion(walkingTextureHandle_);
+    const TextureRegion& idleTexture = GetTextureRegion(idleTextureHandle_);
+
     bool drew = false;
-    if (isMoving_ && walkingTexture_.id != 0 && spriteInfo_.frameCount > 0) {
-        drew = drawTexture(walkingTexture_, spriteInfo_.frameWidth, spriteInfo_.frameHeight, currentFrame_);
+    if (isMoving_ && walkingTexture.texture.id != 0 && spriteInfo_.frameCount > 0) {
+        drew = addSprite(walkingTexture, spriteInfo_.frameWidth, spriteInfo_.frameHeight, currentFrame_);
     }
 
-    if (!drew && idleTexture_.id != 0) {
-        drew = drawTexture(idleTexture_, idleTexture_.width, idleTexture_.height, 0);
+    if (!drew && idleTexture.texture.id != 0) {
+        drew = addSprite(idleTexture, static_cast<int>(idleTexture.bounds.width), static_cast<int>(idleTexture.bounds.height), 0);
     }
 
     if (!drew) {
-        float radius = GetCollisionRadius();
-        DrawCircleV(position, radius, tint);
+        batch.AddFallbackCircle(position, GetCollisionRadius(), tint);
     }
 
     if (HasTakenDamage()) {
         float baseWidth = 0.0f;
         if (spriteInfo_.frameWidth > 0) {
             baseWidth = static_cast<float>(spriteInfo_.frameWidth);
-        } else if (idleTexture_.id != 0) {
-            baseWidth = static_cast<float>(idleTexture_.width);
+        } else if (idleTexture.texture.id != 0) {
+            baseWidth = idleTexture.bounds.width;
         } else {
             baseWidth = GetCollisionRadius() * 2.0f;
         }
@@ -278,29 +237,32 @@ void EnemyCommon::Draw(const EnemyDrawContext& context) const {
             barWidth,
             barHeight + border * 2.0f
         };
-        DrawRectangleRec(background, kHealthBarBackgroundColor);
 
         float fillWidth = std::max(0.0f, (barWidth - border * 2.0f) * std::clamp(GetHealthFraction(), 0.0f, 1.0f));
-        if (fillWidth > 0.0f) {
-            Rectangle fill{
-                background.x + border,
-                background.y + border,
-                fillWidth,
-                barHeight
-            };
-            DrawRectangleRec(fill, kHealthBarFillColor);
-        }
+        Rectangle fill{
+            background.x + border,
+            background.y + border,
+            fillWidth,
+            barHeight
+        };
+        batch.AddHealthBar(background, kHealthBarBackgroundColor, fill, kHealthBarFillColor);
     }
+    return true;
 }
 
-// Libera texturas carregadas estaticamente para este tipo de inimigo.
+// Mesma escolha de sprite feita em AppendToBatch (andando ou parado), sem desenhar.
+unsigned int EnemyCommon::GetBatchTextureId() const {
+    const TextureRegion& walkingTexture = GetTextureRegion(walkingTextureHandle_);
+    if (isMoving_ && walkingTexture.texture.id != 0 && spriteInfo_.frameCount > 0) {
+        return walkingTexture.texture.id;
+    }
+    return GetTextureRegion(idleTextureHandle_).texture.id;
+}
+
+// Devolve ao gerenciador as referências mantidas para sprites de inimigos.
 void EnemyCommon::ShutdownSpriteCache() {
-    for (auto& entry : g_enemyTextureCache) {
-        if (entry.second.texture.id != 0) {
-            UnloadTexture(entry.second.texture);
-            entry.second.texture = Texture2D{};
-        }
-        entry.second.attempted = false;
+    for (const auto& entry : g_enemyTextureHandles) {
+        ReleaseTexture(entry.second);
     }
-    g_enemyTextureCache.clear();
+    g_enemyTextureHandles.clear();
 }
@@ -4,6 +4,7 @@
 
 #include <string>
 
+#include "texture_manager.h"
 #include "weapon.h"
 
 // Define sprites usados para idle/movimento do inimigo comum.
@@ -26,13 +27,13 @@ public:
 
     void Update(const EnemyUpdateContext& context) override;
     void Draw(const EnemyDrawContext& context) const override;
+    bool AppendToBatch(SpriteBatch& batch, const EnemyDrawContext& context) const override;
+    unsigned int GetBatchTextureId() const override;
 
-    // Limpa cache de sprites compartilhados entre instâncias.
+    // Devolve ao gerenciador de texturas os sprites compartilhados entre instâncias.
     static void ShutdownSpriteCache();
 
 private:
-    // Garante que texturas foram carregadas antes de desenhar.
-    void EnsureTexturesLoaded() const;
     // Avança frames de animação conforme movimento.
     void UpdateAnimation(float deltaSeconds, bool isMoving);
     // Dispara projéteis caso o jogador esteja no alcance.
@@ -42,9 +43,8 @@ private:
     float range_{320.0f};
     EnemySpriteInfo spriteInfo_{};
 
-    mutable Texture2D idleTexture_{};
-    mutable Texture2D walkingTexture_{};
-    mutable bool texturesLoaded_{false};
+    TextureHandle idleTextureHandle_{kInvalidTextureHandle};
+    TextureHandle walkingTextureHandle_{kInvalidTextureHandle};
 
     float attackCooldown_{0.0f};
     float animationTimer_{0.0f};
@@ -2,13 +2,13 @@
 
 #include <algorithm>
 #include <cmath>
-#include <random>
+#include <iostream>
 #include <string>
 
 #include "raymath.h"
 
+#include "game_data.h"
 #include "room.h"
-#include "weapon_blueprints.h"
 
 namespace {
 
@@ -22,97 +22,33 @@ Rectangle TileRectToPixels(const TileRect& rect) {
     };
 }
 
-// Helper para montar EnemyConfig legível.
-EnemyConfig MakeConfig(int id,
-                       const std::string& name,
-                       BiomeType biome,
-                       float maxHealth,
-                       float speed,
-                       float spawnRate,
-                       float collisionRadius) {
-    EnemyConfig config{};
-    config.id = id;
-    config.name = name;
-    config.biome = biome;
-    config.maxHealth = maxHealth;
-    config.speed = speed;
-    config.spawnRate = spawnRate;
-    config.collisionRadius = collisionRadius;
-    return config;
-}
-
-// Preenche dados de spritesheet a partir da pasta base.
-EnemySpriteInfo MakeSpriteInfo(const std::string& basePath) {
-    EnemySpriteInfo info{};
-        info.idleSpritePath = basePath + "/idle_sprite";
-        info.walkingSpriteSheetPath = basePath + "/walking_spritesheet";
-    info.frameWidth = 38;
-    info.frameHeight = 68;
-    info.frameCount = 4;
-    info.secondsPerFrame = 0.16f;
-    return info;
-}
-
 } // namespace
 
 EnemySpawner::EnemySpawner() {
-    RegisterDefaults();
+    Reload();
 }
 
-// Registra os tipos básicos de inimigos por bioma.
-void EnemySpawner::RegisterDefaults() {
+// Agrupa os presets carregados por bioma e resolve a arma de cada um pelo nome.
+void EnemySpawner::Reload() {
     templates_.clear();
 
-    // Caverna
-    EnemyTemplate caveRanged{};
-    caveRanged.config = MakeConfig(100, "caverna_ranged", BiomeType::Cave, 21.0f, 82.5f, 1.0f, 22.0f);
-    caveRanged.range = 520.0f;
-    caveRanged.weapon = &GetArcoSimplesWeaponBlueprint();
-        caveRanged.sprite = MakeSpriteInfo("./assets/img/enemies/caverna_ranged");
-    templates_[BiomeType::Cave].push_back(caveRanged);
-
-    EnemyTemplate caveMelee{};
-    caveMelee.config = MakeConfig(101, "caverna_melee", BiomeType::Cave, 40.0f, 95.0f, 1.2f, 24.0f);
-    caveMelee.range = 140.0f;
-    caveMelee.weapon = &GetEspadaCurtaWeaponBlueprint();
-        caveMelee.sprite = MakeSpriteInfo("./assets/img/enemies/caverna_melee");
-    templates_[BiomeType::Cave].push_back(caveMelee);
-
-    // Dungeon
-    EnemyTemplate dungeonRanged{};
-    dungeonRanged.config = MakeConfig(110, "dungeon_ranged", BiomeType::Dungeon, 27.5f, 85.0f, 1.0f, 22.0f);
-    dungeonRanged.range = 560.0f;
-    dungeonRanged.weapon = &GetCajadoDeCarvalhoWeaponBlueprint();
-        dungeonRanged.sprite = MakeSpriteInfo("./assets/img/enemies/dungeon_ranged");
-    templates_[BiomeType::Dungeon].push_back(dungeonRanged);
-
-    EnemyTemplate dungeonMelee{};
-    dungeonMelee.config = MakeConfig(111, "dungeon_melee", BiomeType::Dungeon, 47.5f, 92.5f, 1.3f, 26.0f);
-    dungeonMelee.range = 150.0f;
-    dungeonMelee.weapon = &GetMachadinhaWeaponBlueprint();
-        dungeonMelee.sprite = MakeSpriteInfo("./assets/img/enemies/dungeon_melee");
-    templates_[BiomeType::Dungeon].push_back(dungeonMelee);
-
-    // Mansao
-    EnemyTemplate mansionRanged{};
-    mansionRanged.config = MakeConfig(120, "mansao_ranged", BiomeType::Mansion, 30.0f, 87.5f, 1.1f, 22.0f);
-    mansionRanged.range = 540.0f;
-    mansionRanged.weapon = &GetArcoSimplesWeaponBlueprint();
-        mansionRanged.sprite = MakeSpriteInfo("./assets/img/enemies/mansao_ranged");
-    templates_[BiomeType::Mansion].push_back(mansionRanged);
-
-    EnemyTemplate mansionMelee{};
-    mansionMelee.config = MakeConfig(121, "mansao_melee", BiomeType::Mansion, 52.5f, 100.0f, 1.4f, 26.0f);
-    mansionMelee.range = 160.0f;
-    mansionMelee.weapon = &GetEspadaRunicaWeaponBlueprint();
-        mansionMelee.sprite = MakeSpriteInfo("./assets/img/enemies/mansao_melee");
-    templates_[BiomeType::Mansion].push_back(mansionMelee);
+    for (const EnemyRecord& record : GetGameData().enemies) {
+        EnemyTemplate enemyTemplate{};
+        enemyTemplate.config = record.config;
+        enemyTemplate.range = record.range;
+        enemyTemplate.weapon = FindWeaponBlueprint(record.weaponName);
+        enemyTemplate.sprite = record.sprite;
+        if (enemyTemplate.weapon == nullptr) {
+            std::cerr << "[Enemies] Arma nao encontrada para " << record.config.name << ": " << record.weaponName << std::endl;
+        }
+        templates_[record.config.biome].push_back(std::move(enemyTemplate));
+    }
 }
 
 // Cria inimigos aleatórios baseados no bioma e área da sala.
 void EnemySpawner::SpawnEnemiesForRoom(Room& room,
                                        std::vector<std::unique_ptr<Enemy>>& storage,
-                                       std::mt19937& rng) const {
+                                       RandomStream& rng) const {
     if (!storage.empty()) {
         return;
     }
@@ -139,26 +75,31 @@ void EnemySpawner::SpawnEnemiesForRoom(Room& room,
     spawnCount = std::max(spawnCount, 1);
 
     const std::vector<EnemyTemplate>& defs = it->second;
-    std::vector<double> weights;
-    weights.reserve(defs.size());
+    float totalWeight = 0.0f;
     for (const auto& def : defs) {
-        weights.push_back(std::max(def.config.spawnRate, 0.01f));
+        totalWeight += std::max(def.config.spawnRate, 0.01f);
     }
 
-    std::discrete_distribution<int> pick(weights.begin(), weights.end());
-
     Rectangle roomRect = TileRectToPixels(layout.tileBounds);
     float margin = TILE_SIZE * 0.75f;
-    std::uniform_real_distribution<float> randX(roomRect.x + margin, roomRect.x + roomRect.width - margin);
-    std::uniform_real_distribution<float> randY(roomRect.y + margin, roomRect.y + roomRect.height - margin);
+    const float minX = roomRect.x + margin;
+    const float maxX = roomRect.x + roomRect.width - margin;
+    const float minY = roomRect.y + margin;
+    const float maxY = roomRect.y + roomRect.height - margin;
 
     for (int i = 0; i < spawnCount; ++i) {
-        int index = pick(rng);
-        if (index < 0 || index >= static_cast<int>(defs.size())) {
-            continue;
+        // Sorteio ponderado por spawnRate; sobra de arredondamento cai no último preset.
+        float pick = rng.RangeFloat(0.0f, totalWeight);
+        std::size_t index = 0;
+        while (index + 1 < defs.size()) {
+            pick -= std::max(defs[index].config.spawnRate, 0.01f);
+            if (pick < 0.0f) {
+                break;
+            }
+            ++index;
         }
 
-        Vector2 spawnPosition{randX(rng), randY(rng)};
+        Vector2 spawnPosition{rng.RangeFloat(minX, maxX), rng.RangeFloat(minY, maxY)};
         const EnemyTemplate& selected = defs[index];
         auto enemy = std::make_unique<EnemyCommon>(selected.config, selected.range, selected.weapon, selected.sprite);
         enemy->Initialize(room, spawnPosition);
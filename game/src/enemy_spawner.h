@@ -1,22 +1,25 @@
 #pragma once
 
 #include <memory>
-#include <random>
 #include <unordered_map>
 #include <vector>
 
 #include "enemy_common.h"
+#include "game_random.h"
 
 class Room;
 
-// Fabrica inimigos conforme bioma e configurações padrão.
+// Fabrica inimigos conforme bioma, usando os presets de assets/data/enemies.txt.
 class EnemySpawner {
 public:
     EnemySpawner();
 
+    // Remonta os templates a partir de GetGameData() (chamar após recarga dos dados; inimigos já vivos não mudam).
+    void Reload();
+
     void SpawnEnemiesForRoom(Room& room,
                              std::vector<std::unique_ptr<Enemy>>& storage,
-                             std::mt19937& rng) const;
+                             RandomStream& rng) const;
 
 private:
     struct EnemyTemplate {
@@ -27,7 +30,4 @@ private:
     };
 
     std::unordered_map<BiomeType, std::vector<EnemyTemplate>> templates_;
-
-    // Registra presets hardcoded utilizados na demo atual.
-    void RegisterDefaults();
 };
@@ -0,0 +1,344 @@
+#include "explore_bot.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+
+#include "raymath.h"
+
+#include "input_replay.h"
+#include "process_memory.h"
+#include "room_types.h"
+
+namespace {
+
+constexpr float kTileSize = static_cast<float>(TILE_SIZE);
+constexpr float kFightMinDistance = 200.0f;   // Abaixo disso o bot recua
+constexpr float kFightMaxDistance = 360.0f;   // Acima disso o bot se aproxima
+constexpr float kStrafeFlipSeconds = 1.5f;
+constexpr float kDoorInteractDistance = 110.0f;
+constexpr float kChestReachFactor = 0.7f;
+constexpr float kProgressCheckSeconds = 2.0f;
+constexpr float kProgressMinDistance = 16.0f;
+constexpr float kDetourSeconds = 0.75f;
+constexpr float kDoorGiveUpSeconds = 30.0f;
+constexpr float kGrowthWarningRatio = 1.5f;   // Segunda metade crescendo 50% mais rápido por sala que a primeira
+
+Vector2 DirectionVector(Direction direction) {
+    switch (direction) {
+        case Direction::North:
+            return Vector2{0.0f, -1.0f};
+        case Direction::South:
+            return Vector2{0.0f, 1.0f};
+        case Direction::East:
+            return Vector2{1.0f, 0.0f};
+        case Direction::West:
+            return Vector2{-1.0f, 0.0f};
+    }
+    return Vector2{0.0f, 0.0f};
+}
+
+// Ponto central da abertura da porta, na borda interna da sala.
+Vector2 DoorMouth(const RoomLayout& layout, const Doorway& door) {
+    const TileRect& bounds = layout.tileBounds;
+    const float along = static_cast<float>(door.offset) + static_cast<float>(door.width) * 0.5f;
+    switch (door.direction) {
+        case Direction::North:
+            return Vector2{(static_cast<float>(bounds.x) + along) * kTileSize, static_cast<float>(bounds.y) * kTileSize};
+        case Direction::South:
+            return Vector2{(static_cast<float>(bounds.x) + along) * kTileSize,
+                           static_cast<float>(bounds.y + layout.heightTiles) * kTileSize};
+        case Direction::East:
+            return Vector2{static_cast<float>(bounds.x + layout.widthTiles) * kTileSize,
+                           (static_cast<float>(bounds.y) + along) * kTileSize};
+        case Direction::West:
+            return Vector2{static_cast<float>(bounds.x) * kTileSize, (static_cast<float>(bounds.y) + along) * kTileSize};
+    }
+    return Vector2{0.0f, 0.0f};
+}
+
+bool IsDoorUsable(const Doorway& door) {
+    return !door.sealed && door.targetGenerated && door.doorState &&
+           door.doorState->interactionState != DoorInteractionState::Locked;
+}
+
+const Enemy* FindNearestEnemy(const ExploreBotView& view) {
+    if (view.enemies == nullptr) {
+        return nullptr;
+    }
+    const Enemy* nearest = nullptr;
+    float nearestDistance = std::numeric_limits<float>::max();
+    for (const auto& enemy : *view.enemies) {
+        if (!enemy || !enemy->IsAlive()) {
+            continue;
+        }
+        const float distance = Vector2DistanceSqr(view.playerPosition, enemy->GetPosition());
+        if (distance < nearestDistance) {
+            nearestDistance = distance;
+            nearest = enemy.get();
+        }
+    }
+    return nearest;
+}
+
+float Percentile(const std::vector<float>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0f;
+    }
+    return sorted[static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1))];
+}
+
+} // namespace
+
+void ExploreBot::Start(int targetRooms, std::uint64_t seed, const std::string& csvPath) {
+    active_ = true;
+    targetRooms_ = std::max(1, targetRooms);
+    // Stream próprio: as escolhas do bot não consomem os streams do jogo.
+    rng_.Seed(DeriveSeed(seed, 0xB07B07ULL));
+    csv_.open(csvPath, std::ios::out | std::ios::trunc);
+    if (!csv_) {
+        std::cerr << "[Bot] Nao foi possivel criar " << csvPath << std::endl;
+    } else {
+        csv_ << "rooms,sim_seconds,frame_p50_ms,frame_p95_ms,frame_p99_ms,frame_max_ms,resident_mb,stored_rooms,"
+                "enemy_room_lists,enemies,reveal_states,player_projectiles,enemy_projectiles,deaths\n";
+    }
+    frameMilliseconds_.reserve(4096);
+    lastTick_ = std::chrono::steady_clock::now();
+    std::cerr << "[Bot] Explorando " << targetRooms_ << " salas" << std::endl;
+}
+
+void ExploreBot::ChooseDoor(const ExploreBotView& view) {
+    targetDoor_ = -1;
+    const std::vector<Doorway>& doors = view.room->Layout().doors;
+    // Prioridade: salas ainda não visitadas; depois qualquer porta que não volte; por fim qualquer porta.
+    std::vector<int> unvisited;
+    std::vector<int> forward;
+    std::vector<int> any;
+    for (int i = 0; i < static_cast<int>(doors.size()); ++i) {
+        const Doorway& door = doors[static_cast<std::size_t>(i)];
+        if (!IsDoorUsable(door)) {
+            continue;
+        }
+        any.push_back(i);
+        if (door.targetCoords == previousRoom_) {
+            continue;
+        }
+        forward.push_back(i);
+        const Room* target = view.rooms->TryGetRoom(door.targetCoords);
+        if (target == nullptr || !target->IsVisited()) {
+            unvisited.push_back(i);
+        }
+    }
+    const std::vector<int>& pool = !unvisited.empty() ? unvisited : (!forward.empty() ? forward : any);
+    if (!pool.empty()) {
+        targetDoor_ = pool[static_cast<std::size_t>(rng_.RangeInt(0, static_cast<int>(pool.size()) - 1))];
+    }
+}
+
+void ExploreBot::Tick(const ExploreBotView& view, float deltaSeconds) {
+    if (!active_ || view.room == nullptr || view.rooms == nullptr) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (ticks_ > 0) {
+        frameMilliseconds_.push_back(std::chrono::duration<float, std::milli>(now - lastTick_).count());
+    }
+    lastTick_ = now;
+    ++ticks_;
+    simulatedSeconds_ += deltaSeconds;
+    secondsInRoom_ += deltaSeconds;
+
+    const RoomCoords coords = view.room->GetCoords();
+    if (!hasRoom_ || coords != currentRoom_) {
+        if (hasRoom_) {
+            ++roomsEntered_;
+            previousRoom_ = currentRoom_;
+        } else {
+            previousRoom_ = coords;
+        }
+        hasRoom_ = true;
+        currentRoom_ = coords;
+        chestVisited_ = false;
+        targetDoor_ = -1;
+        secondsInRoom_ = 0.0f;
+        progressAnchor_ = view.playerPosition;
+        progressTimer_ = 0.0f;
+    }
+    if (view.chestOpen) {
+        chestVisited_ = true;
+    }
+
+    Vector2 move{0.0f, 0.0f};
+    Vector2 aimWorld = view.playerPosition;
+    bool wantsFire = false;
+    bool wantsInteract = false;
+    bool wantsInventoryToggle = false;
+
+    const RoomLayout& layout = view.room->Layout();
+    const Chest* chest = view.room->GetChest();
+    const Enemy* target = FindNearestEnemy(view);
+
+    if (view.inventoryOpen) {
+        // Qualquer UI aberta (baú, forja, loja) é fechada; o conteúdo do baú já foi carregado ao abrir.
+        wantsInventoryToggle = true;
+    } else if (target != nullptr) {
+        // Mantém distância média do alvo, circulando para desviar dos disparos.
+        aimWorld = target->GetPosition();
+        wantsFire = target->HasCompletedFade();
+        const Vector2 toTarget = Vector2Subtract(aimWorld, view.playerPosition);
+        const float distance = Vector2Length(toTarget);
+        strafeTimer_ += deltaSeconds;
+        if (strafeTimer_ >= kStrafeFlipSeconds) {
+            strafeTimer_ = 0.0f;
+            strafeSign_ = -strafeSign_;
+        }
+        if (distance > kFightMaxDistance) {
+            move = toTarget;
+        } else if (distance < kFightMinDistance) {
+            move = Vector2Negate(toTarget);
+        } else {
+            move = Vector2Scale(Vector2{-toTarget.y, toTarget.x}, strafeSign_);
+        }
+    } else if (chest != nullptr && !chestVisited_) {
+        const Vector2 anchor{chest->AnchorX(), chest->AnchorY()};
+        aimWorld = anchor;
+        const float reach = chest->InteractionRadius() * kChestReachFactor;
+        if (Vector2DistanceSqr(view.playerPosition, anchor) <= reach * reach) {
+            wantsInteract = true;
+        } else {
+            move = Vector2Subtract(anchor, view.playerPosition);
+        }
+    } else {
+        if (targetDoor_ < 0 || targetDoor_ >= static_cast<int>(layout.doors.size()) ||
+            secondsInRoom_ > kDoorGiveUpSeconds) {
+            if (secondsInRoom_ > kDoorGiveUpSeconds) {
+                ++doorRetargets_;
+                secondsInRoom_ = 0.0f;
+            }
+            ChooseDoor(view);
+        }
+        if (targetDoor_ >= 0) {
+            const Doorway& door = layout.doors[static_cast<std::size_t>(targetDoor_)];
+            const Vector2 forward = DirectionVector(door.direction);
+            const Vector2 mouth = DoorMouth(layout, door);
+            const Vector2 inside = Vector2Subtract(mouth, Vector2Scale(forward, kTileSize));
+            const bool doorPassable = door.doorState && (door.doorState->open || door.doorState->opening);
+            // Distância lateral até o eixo da porta: precisa estar alinhado para entrar no corredor.
+            const Vector2 offset = Vector2Subtract(view.playerPosition, mouth);
+            const float lateral = std::fabs(forward.x != 0.0f ? offset.y : offset.x);
+            const float lateralTolerance = static_cast<float>(door.width) * kTileSize * 0.25f;
+            if (!doorPassable) {
+                move = Vector2Subtract(inside, view.playerPosition);
+                wantsInteract = Vector2Distance(view.playerPosition, mouth) <= kDoorInteractDistance;
+            } else if (lateral > lateralTolerance && Vector2DotProduct(offset, forward) < 0.0f) {
+                move = Vector2Subtract(inside, view.playerPosition);
+            } else {
+                const float depth = static_cast<float>(door.corridorLength + 3) * kTileSize;
+                move = Vector2Subtract(Vector2Add(mouth, Vector2Scale(forward, depth)), view.playerPosition);
+            }
+            aimWorld = mouth;
+        }
+    }
+
+    // Sem progresso por alguns segundos (preso em forja, loja ou quina): desvia para um lado por um instante.
+    progressTimer_ += deltaSeconds;
+    if (progressTimer_ >= kProgressCheckSeconds) {
+        const bool stalled = Vector2Distance(view.playerPosition, progressAnchor_) < kProgressMinDistance;
+        if (stalled && Vector2LengthSqr(move) > 0.0f && !view.inventoryOpen) {
+            const Vector2 side{-move.y, move.x};
+            detour_ = Vector2Scale(Vector2Normalize(side), rng_.Chance(0.5f) ? 1.0f : -1.0f);
+            detourTimer_ = kDetourSeconds;
+        }
+        progressAnchor_ = view.playerPosition;
+        progressTimer_ = 0.0f;
+    }
+    if (detourTimer_ > 0.0f) {
+        detourTimer_ -= deltaSeconds;
+        move = detour_;
+    }
+
+    // Movimento em 8 direções, como o teclado.
+    constexpr float kAxisThreshold = 0.38f;
+    const Vector2 direction = Vector2LengthSqr(move) > 1e-6f ? Vector2Normalize(move) : Vector2{0.0f, 0.0f};
+    InjectKeyState(KEY_W, direction.y < -kAxisThreshold);
+    InjectKeyState(KEY_S, direction.y > kAxisThreshold);
+    InjectKeyState(KEY_A, direction.x < -kAxisThreshold);
+    InjectKeyState(KEY_D, direction.x > kAxisThreshold);
+    InjectKeyState(KEY_E, interactKey_.Next(wantsInteract));
+    InjectKeyState(KEY_I, inventoryKey_.Next(wantsInventoryToggle));
+
+    if (Vector2DistanceSqr(aimWorld, view.playerPosition) < 1.0f) {
+        aimWorld = Vector2Add(view.playerPosition, Vector2Scale(direction, kTileSize));
+    }
+    InjectMousePosition(GetWorldToScreen2D(aimWorld, view.camera));
+    InjectMouseButtonState(MOUSE_BUTTON_LEFT, leftFire_.Next(wantsFire));
+    InjectMouseButtonState(MOUSE_BUTTON_RIGHT, rightFire_.Next(wantsFire));
+}
+
+void ExploreBot::RecordSample(const SoakSample& sample) {
+    Row row{};
+    row.rooms = roomsEntered_;
+    row.seconds = simulatedSeconds_;
+    row.residentBytes = GetResidentMemoryBytes();
+    row.world = sample;
+    WriteRow(row);
+    rows_.push_back(row);
+    nextSampleRooms_ = roomsEntered_ + kSampleIntervalRooms;
+    std::cerr << "[Bot] " << roomsEntered_ << "/" << targetRooms_ << " salas | " << sample.storedRooms
+              << " salas geradas | " << sample.enemies << " inimigos | "
+              << static_cast<double>(row.residentBytes) / (1024.0 * 1024.0) << " MB" << std::endl;
+}
+
+void ExploreBot::WriteRow(const Row& row) {
+    std::sort(frameMilliseconds_.begin(), frameMilliseconds_.end());
+    if (csv_.is_open()) {
+        csv_ << row.rooms << ',' << row.seconds << ',' << Percentile(frameMilliseconds_, 0.50) << ','
+             << Percentile(frameMilliseconds_, 0.95) << ',' << Percentile(frameMilliseconds_, 0.99) << ','
+             << (frameMilliseconds_.empty() ? 0.0f : frameMilliseconds_.back()) << ','
+             << static_cast<double>(row.residentBytes) / (1024.0 * 1024.0) << ',' << row.world.storedRooms << ','
+             << row.world.enemyRoomLists << ',' << row.world.enemies << ',' << row.world.revealStates << ','
+             << row.world.playerProjectiles << ',' << row.world.enemyProjectiles << ',' << deaths_ << '\n';
+        csv_.flush();
+    }
+    frameMilliseconds_.clear();
+}
+
+void ExploreBot::Finish(const SoakSample& sample) {
+    if (!active_) {
+        return;
+    }
+    if (rows_.empty() || rows_.back().rooms != roomsEntered_) {
+        RecordSample(sample);
+    }
+    csv_.close();
+    active_ = false;
+
+    std::cerr << "[Bot] " << roomsEntered_ << " salas em " << simulatedSeconds_ << " s simulados, " << deaths_
+              << " mortes, " << doorRetargets_ << " portas abandonadas" << std::endl;
+    if (rows_.size() < 3) {
+        return;
+    }
+
+    // Crescimento por sala atravessada na primeira e na segunda metade; linear mantém a taxa, superlinear acelera.
+    const Row& first = rows_.front();
+    const Row& middle = rows_[rows_.size() / 2];
+    const Row& last = rows_.back();
+    auto report = [&](const char* name, auto metric) {
+        const double firstRooms = std::max(1, middle.rooms - first.rooms);
+        const double secondRooms = std::max(1, last.rooms - middle.rooms);
+        const double firstRate = (metric(middle) - metric(first)) / firstRooms;
+        const double secondRate = (metric(last) - metric(middle)) / secondRooms;
+        const bool superlinear = secondRate > 0.0 && secondRate > firstRate * kGrowthWarningRatio + 1e-3;
+        std::cerr << "[Bot] " << std::setw(18) << std::left << name << std::right << " inicio " << metric(first)
+                  << " fim " << metric(last) << " | por sala " << firstRate << " -> " << secondRate
+                  << (superlinear ? "  << crescimento superlinear" : "") << std::endl;
+    };
+    report("salas geradas", [](const Row& row) { return static_cast<double>(row.world.storedRooms); });
+    report("roomEnemies", [](const Row& row) { return static_cast<double>(row.world.enemyRoomLists); });
+    report("inimigos", [](const Row& row) { return static_cast<double>(row.world.enemies); });
+    report("roomRevealStates", [](const Row& row) { return static_cast<double>(row.world.revealStates); });
+    report("memoria (MB)", [](const Row& row) { return static_cast<double>(row.residentBytes) / (1024.0 * 1024.0); });
+}
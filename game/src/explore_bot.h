@@ -0,0 +1,117 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "raylib.h"
+
+#include "enemy.h"
+#include "game_random.h"
+#include "room.h"
+#include "room_manager.h"
+
+// Estado do mundo que o bot enxerga no início do tick (valores do fim do tick anterior).
+struct ExploreBotView {
+    Vector2 playerPosition{0.0f, 0.0f};
+    Camera2D camera{};
+    const Room* room{nullptr};
+    const RoomManager* rooms{nullptr};
+    const std::vector<std::unique_ptr<Enemy>>* enemies{nullptr}; // Inimigos da sala atual (nulo se ainda não spawnados)
+    bool inventoryOpen{false};
+    bool chestOpen{false};
+};
+
+// Contadores do mundo gravados a cada amostra do teste de resistência.
+struct SoakSample {
+    std::size_t storedRooms{0};       // Salas em RoomManager
+    std::size_t enemyRoomLists{0};    // Entradas em roomEnemies
+    std::size_t enemies{0};           // Inimigos somados em todas as salas
+    std::size_t revealStates{0};      // Entradas em roomRevealStates
+    std::size_t playerProjectiles{0};
+    std::size_t enemyProjectiles{0};
+};
+
+// Bot de exploração (`--bot <salas>`): anda pelas portas da sala atual, luta com as armas equipadas e abre baús
+// injetando input como um jogador, até atravessar o número pedido de salas. A cada kSampleIntervalRooms salas grava
+// uma linha em soak_stats.csv (percentis do tempo de quadro, memória residente e contadores do mundo); ao terminar
+// compara o crescimento por sala da primeira e da segunda metade da sessão para apontar crescimento superlinear.
+class ExploreBot {
+public:
+    static constexpr float kFixedDeltaSeconds = 1.0f / 60.0f; // Delta fixo: o resultado não depende do FPS
+    static constexpr int kSampleIntervalRooms = 100;
+
+    void Start(int targetRooms, std::uint64_t seed, const std::string& csvPath);
+    bool IsActive() const { return active_; }
+    bool IsFinished() const { return active_ && roomsEntered_ >= targetRooms_; }
+
+    // Decide e injeta o input do tick. Chamar no início do tick, antes de BeginInputTick.
+    void Tick(const ExploreBotView& view, float deltaSeconds);
+    // O main revive o jogador no lugar (o mundo não é recriado, para que o crescimento se acumule).
+    void NotePlayerDeath() { ++deaths_; }
+
+    bool WantsSample() const { return active_ && roomsEntered_ >= nextSampleRooms_; }
+    void RecordSample(const SoakSample& sample);
+    // Grava a última amostra e imprime o resumo de crescimento.
+    void Finish(const SoakSample& sample);
+
+private:
+    struct Row {
+        int rooms{0};
+        double seconds{0.0};
+        std::size_t residentBytes{0};
+        SoakSample world{};
+    };
+
+    struct KeyPulse {
+        bool down{false};
+        // Alterna entre apertado e solto para que IsKeyPressed/IsMouseButtonPressed disparem a cada dois ticks.
+        bool Next(bool wanted) {
+            down = wanted && !down;
+            return down;
+        }
+    };
+
+    void ChooseDoor(const ExploreBotView& view);
+    void WriteRow(const Row& row);
+
+    bool active_{false};
+    int targetRooms_{0};
+    RandomStream rng_;
+    std::ofstream csv_;
+
+    // Progresso da exploração.
+    int roomsEntered_{0};
+    int deaths_{0};
+    int doorRetargets_{0};
+    double simulatedSeconds_{0.0};
+    std::uint64_t ticks_{0};
+    bool hasRoom_{false};
+    RoomCoords currentRoom_{};
+    RoomCoords previousRoom_{};
+    bool chestVisited_{false};
+    int targetDoor_{-1};
+    float secondsInRoom_{0.0f};
+    float strafeSign_{1.0f};
+    float strafeTimer_{0.0f};
+    Vector2 progressAnchor_{0.0f, 0.0f};
+    float progressTimer_{0.0f};
+    Vector2 detour_{0.0f, 0.0f};
+    float detourTimer_{0.0f};
+
+    // Input injetado no tick anterior.
+    KeyPulse interactKey_;
+    KeyPulse inventoryKey_;
+    KeyPulse leftFire_;
+    KeyPulse rightFire_;
+
+    // Tempo de quadro (Tick a Tick) desde a última amostra.
+    std::chrono::steady_clock::time_point lastTick_{};
+    std::vector<float> frameMilliseconds_;
+    int nextSampleRooms_{0};
+    std::vector<Row> rows_;
+};
@@ -1,49 +1,208 @@
 #include "font_manager.h"
 
+#include "asset_archive.h"
 #include "raygui.h"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 namespace {
+
+// Tamanhos usados pelos textos do jogo (HUD, inventario, numeros de dano); o tamanho base e adicionado a lista.
+constexpr int kAtlasSizes[] = {14, 16, 18, 20, 22, 24, 28, 30};
+constexpr int kAtlasGlyphCount = 95; // ASCII 32..126, igual ao LoadFontEx sem lista de codepoints
+constexpr int kAtlasGlyphPadding = 4; // Mesmo padding usado pela Raylib em LoadFontEx
+
 Font g_gameFont = GetFontDefault(); // Fonte atualmente usada pelo jogo (pode ser padrao ou customizada)
 bool g_fontOwned = false; // Indica se a fonte carregada foi alocada pelo jogo e precisa ser liberada
+std::vector<Font> g_sizedFonts; // Variantes por tamanho (ordenadas por baseSize) que compartilham a textura do atlas
+Texture2D g_atlasTexture{}; // Textura unica com todos os tamanhos empilhados verticalmente
+FontAtlasStats g_atlasStats{};
+unsigned int g_fontGeneration = 0;
+
+// Libera tabelas de glifos de cada variante e a textura compartilhada (uma unica vez).
+void ReleaseSizedFonts() {
+    for (Font& font : g_sizedFonts) {
+        UnloadFontData(font.glyphs, font.glyphCount);
+        MemFree(font.recs);
+    }
+    g_sizedFonts.clear();
+    if (g_atlasTexture.id != 0) {
+        UnloadTexture(g_atlasTexture);
+    }
+    g_atlasTexture = Texture2D{};
+    g_atlasStats = FontAtlasStats{};
 }
 
+// Rasteriza cada tamanho com LoadFontData/GenImageFontAtlas e empilha as imagens em uma textura cinza + alfa.
+bool BuildSizedFonts(const unsigned char* fileData, int dataSize, int baseSize) {
+    std::vector<int> sizes(std::begin(kAtlasSizes), std::end(kAtlasSizes));
+    sizes.push_back(baseSize);
+    std::sort(sizes.begin(), sizes.end());
+    sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+
+    struct SizedImage {
+        Font font{};
+        Image image{};
+    };
+    std::vector<SizedImage> built;
+    built.reserve(sizes.size());
+
+    auto discardBuilt = [&]() {
+        for (SizedImage& entry : built) {
+            UnloadFontData(entry.font.glyphs, entry.font.glyphCount);
+            MemFree(entry.font.recs);
+            UnloadImage(entry.image);
+        }
+    };
+
+    int atlasWidth = 0;
+    int atlasHeight = 0;
+    for (int size : sizes) {
+        GlyphInfo* glyphs = LoadFontData(fileData, dataSize, size, nullptr, kAtlasGlyphCount, FONT_DEFAULT);
+        if (glyphs == nullptr) {
+            discardBuilt();
+            return false;
+        }
+
+        Rectangle* recs = nullptr;
+        Image image = GenImageFontAtlas(glyphs, &recs, kAtlasGlyphCount, size, kAtlasGlyphPadding, 0);
+        if (image.data == nullptr || recs == nullptr) {
+            UnloadFontData(glyphs, kAtlasGlyphCount);
+            MemFree(recs);
+            UnloadImage(image);
+            discardBuilt();
+            return false;
+        }
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+
+        // As imagens individuais dos glifos so servem para ImageText; o desenho usa apenas o atlas.
+        for (int i = 0; i < kAtlasGlyphCount; ++i) {
+            UnloadImage(glyphs[i].image);
+            glyphs[i].image = Image{};
+            recs[i].y += static_cast<float>(atlasHeight);
+        }
+
+        SizedImage entry{};
+        entry.font.baseSize = size;
+        entry.font.glyphCount = kAtlasGlyphCount;
+        entry.font.glyphPadding = kAtlasGlyphPadding;
+        entry.font.glyphs = glyphs;
+        entry.font.recs = recs;
+        entry.image = image;
+        built.push_back(entry);
+
+        atlasWidth = std::max(atlasWidth, image.width);
+        atlasHeight += image.height;
+    }
+
+    // Copia linha a linha para a imagem combinada (mesmo formato, 2 bytes por pixel).
+    const int bytesPerPixel = GetPixelDataSize(1, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+    Image atlas{};
+    atlas.width = atlasWidth;
+    atlas.height = atlasHeight;
+    atlas.mipmaps = 1;
+    atlas.format = PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA;
+    atlas.data = MemAlloc(static_cast<unsigned int>(GetPixelDataSize(atlasWidth, atlasHeight, atlas.format)));
+    if (atlas.data == nullptr) {
+        discardBuilt();
+        return false;
+    }
+
+    int offsetY = 0;
+    for (const SizedImage& entry : built) {
+        const std::size_t rowBytes = static_cast<std::size_t>(entry.image.width * bytesPerPixel);
+        for (int row = 0; row < entry.image.height; ++row) {
+            unsigned char* dst = static_cast<unsigned char*>(atlas.data) +
+                static_cast<std::size_t>(offsetY + row) * static_cast<std::size_t>(atlasWidth * bytesPerPixel);
+            const unsigned char* src = static_cast<const unsigned char*>(entry.image.data) + static_cast<std::size_t>(row) * rowBytes;
+            std::memcpy(dst, src, rowBytes);
+        }
+        offsetY += entry.image.height;
+    }
+
+    Texture2D texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+    if (texture.id == 0) {
+        discardBuilt();
+        return false;
+    }
+    // Cada variante e desenhada no proprio tamanho, entao o filtro de ponto nao borra nem serrilha o pixel art.
+    SetTextureFilter(texture, TEXTURE_FILTER_POINT);
+
+    g_atlasTexture = texture;
+    g_atlasStats = FontAtlasStats{};
+    g_atlasStats.atlasWidth = atlasWidth;
+    g_atlasStats.atlasHeight = atlasHeight;
+    g_atlasStats.textureBytes = static_cast<std::size_t>(GetPixelDataSize(atlasWidth, atlasHeight, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA));
+    for (SizedImage& entry : built) {
+        UnloadImage(entry.image);
+        entry.font.texture = texture;
+        g_sizedFonts.push_back(entry.font);
+        g_atlasStats.glyphBytes += static_cast<std::size_t>(kAtlasGlyphCount) * (sizeof(GlyphInfo) + sizeof(Rectangle));
+    }
+    g_atlasStats.sizeCount = static_cast<int>(g_sizedFonts.size());
+    return true;
+}
+
+// Sem parametros; volta para a fonte padrao da Raylib liberando o atlas proprio.
+void ResetToDefaultFont() {
+    ReleaseSizedFonts();
+    g_gameFont = GetFontDefault();
+    g_fontOwned = false;
+    ++g_fontGeneration;
+}
+
+} // namespace
+
 void LoadGameFont(const std::string& path, int baseSize) { // Recebe caminho e tamanho base, recarrega a fonte e atualiza o estado global retornando automaticamente
-    if (g_fontOwned && g_gameFont.texture.id != 0) {
-        UnloadFont(g_gameFont);
-        g_gameFont = GetFontDefault();
-        g_fontOwned = false;
+    if (g_fontOwned) {
+        ResetToDefaultFont();
     }
 
-    if (!path.empty() && FileExists(path.c_str())) {
-        Font loaded = LoadFontEx(path.c_str(), baseSize, nullptr, 0);
-        if (loaded.texture.id != 0) {
-            SetTextureFilter(loaded.texture, TEXTURE_FILTER_POINT);
-            g_gameFont = loaded;
+    AssetBlob packed{};
+    bool isPacked = !path.empty() && FindPackedAsset(path, packed);
+    if (isPacked || (!path.empty() && FileExists(path.c_str()))) {
+        int dataSize = 0;
+        unsigned char* fileData = isPacked ? nullptr : LoadFileData(path.c_str(), &dataSize);
+        const unsigned char* data = isPacked ? packed.data : fileData;
+        if (isPacked) {
+            dataSize = static_cast<int>(packed.size);
+        }
+
+        bool built = data != nullptr && dataSize > 0 && BuildSizedFonts(data, dataSize, baseSize);
+        if (fileData != nullptr) {
+            UnloadFileData(fileData);
+        }
+
+        if (built) {
+            auto base = std::find_if(g_sizedFonts.begin(), g_sizedFonts.end(), [&](const Font& font) {
+                return font.baseSize == baseSize;
+            });
+            g_gameFont = *base;
             g_fontOwned = true;
+            ++g_fontGeneration;
             GuiSetFont(g_gameFont);
+            std::cerr << "[Font] Atlas " << g_atlasStats.atlasWidth << "x" << g_atlasStats.atlasHeight
+                      << " com " << g_atlasStats.sizeCount << " tamanhos: "
+                      << (g_atlasStats.textureBytes + g_atlasStats.glyphBytes) / 1024 << " KB" << std::endl;
             return;
         }
 
-        if (loaded.texture.id != 0) {
-            UnloadFont(loaded);
-        }
         std::cerr << "[Font] Falha ao carregar fonte: " << path << std::endl;
     } else if (!path.empty()) {
         std::cerr << "[Font] Arquivo de fonte nao encontrado: " << path << std::endl;
     }
 
-    g_gameFont = GetFontDefault();
-    g_fontOwned = false;
+    ResetToDefaultFont();
     GuiSetFont(g_gameFont);
 }
 
 void UnloadGameFont() { // Sem parametros; libera fonte customizada se houver e aplica fonte padrao novamente
-    if (g_fontOwned && g_gameFont.texture.id != 0) {
-        UnloadFont(g_gameFont);
-        g_gameFont = GetFontDefault();
-        g_fontOwned = false;
+    if (g_fontOwned) {
+        ResetToDefaultFont();
     }
 
     GuiSetFont(g_gameFont);
@@ -52,3 +211,24 @@ void UnloadGameFont() { // Sem parametros; libera fonte customizada se houver e
 const Font& GetGameFont() { // Sem parametros; retorna por referencia a fonte hoje ativa
     return g_gameFont;
 }
+
+const Font& GetGameFont(float fontSize) { // Recebe o tamanho de desenho; retorna a variante rasterizada mais adequada
+    if (g_sizedFonts.empty()) {
+        return g_gameFont;
+    }
+    // Reduzir um pouco um glifo maior preserva melhor o traco do que ampliar um menor.
+    for (const Font& font : g_sizedFonts) {
+        if (static_cast<float>(font.baseSize) >= fontSize) {
+            return font;
+        }
+    }
+    return g_sizedFonts.back();
+}
+
+unsigned int GetGameFontGeneration() { // Sem parametros; retorna o contador de trocas de fonte
+    return g_fontGeneration;
+}
+
+FontAtlasStats GetFontAtlasStats() { // Sem parametros; retorna dimensoes e memoria do atlas de fontes
+    return g_atlasStats;
+}
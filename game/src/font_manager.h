@@ -2,14 +2,35 @@
 
 #include "raylib.h"
 
+#include <cstddef>
 #include <string>
 
+// Estatisticas do atlas de fontes (debug/profiling).
+struct FontAtlasStats {
+    int atlasWidth{0};           // Largura da textura compartilhada por todos os tamanhos
+    int atlasHeight{0};          // Altura da textura compartilhada
+    int sizeCount{0};            // Quantidade de tamanhos rasterizados no atlas
+    std::size_t textureBytes{0}; // Memoria de GPU da textura (cinza + alfa, sem mipmaps)
+    std::size_t glyphBytes{0};   // Memoria de CPU das tabelas de glifos e retangulos
+};
+
 // Recebe o caminho e o tamanho base, tenta carregar a fonte principal e substitui a atual (mantendo a padrao da Raylib se falhar).
+// Alem do tamanho base, rasteriza os tamanhos usados pela UI (14-30 px) em uma unica textura compartilhada.
 void LoadGameFont(const std::string& path = "assets/font/alagard.ttf",
                   int baseSize = 32);
 
 // Nao recebe parametros; libera a fonte customizada ativa e retorna para a fonte padrao da Raylib.
 void UnloadGameFont();
 
-// Nao recebe parametros; devolve por referencia a fonte atualmente em uso (customizada ou padrao da Raylib).
+// Nao recebe parametros; devolve por referencia a fonte atualmente em uso no tamanho base (customizada ou padrao da Raylib).
 const Font& GetGameFont();
+
+// Recebe o tamanho de desenho em pixels; devolve a fonte rasterizada no tamanho mais proximo (o menor >= fontSize).
+// Todas as variantes usam a mesma textura, entao trocar de tamanho nao troca de textura no lote.
+const Font& GetGameFont(float fontSize);
+
+// Nao recebe parametros; contador incrementado a cada troca de fonte (para invalidar caches de medidas).
+unsigned int GetGameFontGeneration();
+
+// Nao recebe parametros; devolve tamanho e memoria do atlas atual (zerado quando usando a fonte padrao).
+FontAtlasStats GetFontAtlasStats();
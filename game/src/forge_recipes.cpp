@@ -0,0 +1,180 @@
+#include "forge_recipes.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+const std::string kEmptyComboText{};
+
+} // namespace
+
+std::uint64_t ForgeRecipeBook::MakeKey(int idA, int idB) {
+    if (idA > idB) {
+        std::swap(idA, idB);
+    }
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(idA)) << 32) | static_cast<std::uint32_t>(idB);
+}
+
+void ForgeRecipeBook::Clear() {
+    recipes_.clear();
+    recipeByKey_.clear();
+    comboOffsets_.clear();
+    combos_.clear();
+    comboText_.clear();
+    built_ = false;
+}
+
+void ForgeRecipeBook::Add(int idA, int idB, int resultId, int resultQuantity) {
+    if (idA <= 0 || idB <= 0 || resultId <= 0) {
+        return;
+    }
+    ForgeRecipe recipe{std::min(idA, idB), std::max(idA, idB), resultId, std::max(1, resultQuantity)};
+    auto [it, inserted] = recipeByKey_.emplace(MakeKey(idA, idB), static_cast<int>(recipes_.size()));
+    if (inserted) {
+        recipes_.push_back(recipe);
+    } else {
+        recipes_[static_cast<std::size_t>(it->second)] = recipe;
+    }
+    built_ = false;
+}
+
+void ForgeRecipeBook::Build(const ItemRegistry& items) {
+    int maxId = 0;
+    for (const ForgeRecipe& recipe : recipes_) {
+        maxId = std::max(maxId, recipe.inputB);
+    }
+
+    // Conta o grau de cada item (receitas A + A contam uma vez) e converte em offsets.
+    comboOffsets_.assign(static_cast<std::size_t>(maxId) + 2, 0);
+    for (const ForgeRecipe& recipe : recipes_) {
+        ++comboOffsets_[static_cast<std::size_t>(recipe.inputA) + 1];
+        if (recipe.inputB != recipe.inputA) {
+            ++comboOffsets_[static_cast<std::size_t>(recipe.inputB) + 1];
+        }
+    }
+    for (std::size_t i = 1; i < comboOffsets_.size(); ++i) {
+        comboOffsets_[i] += comboOffsets_[i - 1];
+    }
+
+    combos_.assign(static_cast<std::size_t>(comboOffsets_.back()), ForgeCombo{});
+    std::vector<std::int32_t> cursor(comboOffsets_.begin(), comboOffsets_.end() - 1);
+    for (int index = 0; index < static_cast<int>(recipes_.size()); ++index) {
+        const ForgeRecipe& recipe = recipes_[static_cast<std::size_t>(index)];
+        combos_[static_cast<std::size_t>(cursor[static_cast<std::size_t>(recipe.inputA)]++)] = ForgeCombo{recipe.inputB, index};
+        if (recipe.inputB != recipe.inputA) {
+            combos_[static_cast<std::size_t>(cursor[static_cast<std::size_t>(recipe.inputB)]++)] = ForgeCombo{recipe.inputA, index};
+        }
+    }
+
+    comboText_.assign(static_cast<std::size_t>(maxId) + 1, std::string());
+    for (int id = 1; id <= maxId; ++id) {
+        auto first = combos_.begin() + comboOffsets_[static_cast<std::size_t>(id)];
+        auto last = combos_.begin() + comboOffsets_[static_cast<std::size_t>(id) + 1];
+        std::sort(first, last, [](const ForgeCombo& lhs, const ForgeCombo& rhs) {
+            return lhs.partnerId < rhs.partnerId;
+        });
+
+        std::string text;
+        for (auto it = first; it != last; ++it) {
+            const std::string& partnerName = items.NameOf(it->partnerId);
+            const std::string& resultName = items.NameOf(recipes_[static_cast<std::size_t>(it->recipeIndex)].resultId);
+            if (!partnerName.empty() && !resultName.empty()) {
+                text += "- " + partnerName + " -> " + resultName + "\n";
+            }
+        }
+        if (!text.empty()) {
+            comboText_[static_cast<std::size_t>(id)] = "Combina com:\n" + text;
+        }
+    }
+    built_ = true;
+}
+
+const ForgeRecipe* ForgeRecipeBook::Find(int idA, int idB) const {
+    if (idA <= 0 || idB <= 0) {
+        return nullptr;
+    }
+    if (!built_) {
+        auto it = recipeByKey_.find(MakeKey(idA, idB));
+        return (it != recipeByKey_.end()) ? &recipes_[static_cast<std::size_t>(it->second)] : nullptr;
+    }
+
+    // Busca binária na lista do item com menos combinações.
+    ForgeComboRange rangeA = CombosFor(idA);
+    ForgeComboRange rangeB = CombosFor(idB);
+    bool searchA = (rangeA.last - rangeA.first) <= (rangeB.last - rangeB.first);
+    ForgeComboRange range = searchA ? rangeA : rangeB;
+    int partner = searchA ? idB : idA;
+    const ForgeCombo* it = std::lower_bound(range.first, range.last, partner, [](const ForgeCombo& combo, int id) {
+        return combo.partnerId < id;
+    });
+    if (it == range.last || it->partnerId != partner) {
+        return nullptr;
+    }
+    return &recipes_[static_cast<std::size_t>(it->recipeIndex)];
+}
+
+ForgeComboRange ForgeRecipeBook::CombosFor(int itemId) const {
+    if (!built_ || itemId <= 0 || static_cast<std::size_t>(itemId) + 1 >= comboOffsets_.size()) {
+        return ForgeComboRange{};
+    }
+    const ForgeCombo* base = combos_.data();
+    return ForgeComboRange{base + comboOffsets_[static_cast<std::size_t>(itemId)],
+                           base + comboOffsets_[static_cast<std::size_t>(itemId) + 1]};
+}
+
+const std::string& ForgeRecipeBook::ComboText(int itemId) const {
+    if (!built_ || itemId <= 0 || static_cast<std::size_t>(itemId) >= comboText_.size()) {
+        return kEmptyComboText;
+    }
+    return comboText_[static_cast<std::size_t>(itemId)];
+}
+
+void ForgeRecipeBook::FindCraftable(const ItemSlot* slots, std::size_t slotCount, std::vector<int>& outRecipes) const {
+    outRecipes.clear();
+    if (slots == nullptr || slotCount == 0) {
+        return;
+    }
+
+    // Soma as quantidades por item (poucos slots, então vetor ordenado basta).
+    std::vector<ItemSlot>& owned = ownedScratch_;
+    owned.clear();
+    for (std::size_t i = 0; i < slotCount; ++i) {
+        if (slots[i].itemId > 0 && slots[i].quantity > 0) {
+            owned.push_back(slots[i]);
+        }
+    }
+    std::sort(owned.begin(), owned.end(), [](const ItemSlot& lhs, const ItemSlot& rhs) {
+        return lhs.itemId < rhs.itemId;
+    });
+    std::size_t merged = 0;
+    for (std::size_t i = 0; i < owned.size(); ++i) {
+        if (merged > 0 && owned[merged - 1].itemId == owned[i].itemId) {
+            owned[merged - 1].quantity += owned[i].quantity;
+        } else {
+            owned[merged++] = owned[i];
+        }
+    }
+    owned.resize(merged);
+
+    auto quantityOf = [&owned](int itemId) {
+        auto it = std::lower_bound(owned.begin(), owned.end(), itemId, [](const ItemSlot& slot, int id) {
+            return slot.itemId < id;
+        });
+        return (it != owned.end() && it->itemId == itemId) ? it->quantity : 0;
+    };
+
+    for (const ItemSlot& entry : owned) {
+        for (const ForgeCombo& combo : CombosFor(entry.itemId)) {
+            // Cada par é reportado uma vez, a partir do item de menor id.
+            if (combo.partnerId < entry.itemId) {
+                continue;
+            }
+            int needed = (combo.partnerId == entry.itemId) ? 2 : 1;
+            int available = (combo.partnerId == entry.itemId) ? entry.quantity : quantityOf(combo.partnerId);
+            if (available >= needed) {
+                outRecipes.push_back(combo.recipeIndex);
+            }
+        }
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "item_registry.h"
+
+// Receita da forja: dois itens de entrada (ordem irrelevante) geram um resultado.
+struct ForgeRecipe {
+    int inputA{0};
+    int inputB{0};
+    int resultId{0};
+    int resultQuantity{1};
+};
+
+// Aresta do grafo de receitas vista a partir de um item: o parceiro necessário e a receita gerada.
+struct ForgeCombo {
+    int partnerId{0};
+    int recipeIndex{0};
+};
+
+// Intervalo contíguo de combinações de um item (compatível com range-for).
+struct ForgeComboRange {
+    const ForgeCombo* first{nullptr};
+    const ForgeCombo* last{nullptr};
+
+    const ForgeCombo* begin() const { return first; }
+    const ForgeCombo* end() const { return last; }
+    bool empty() const { return first == last; }
+};
+
+// Livro de receitas da forja com índice reverso por item.
+// Add acumula receitas no carregamento; Build monta uma vez as listas de adjacência (item -> [(parceiro, receita)])
+// e os textos de "Combina com" já formatados, para que tooltips e consultas não varram todas as receitas.
+class ForgeRecipeBook {
+public:
+    // Remove receitas e índices.
+    void Clear();
+
+    // Registra a receita idA + idB -> resultId (substitui a anterior do mesmo par). Invalida o índice até o próximo Build.
+    void Add(int idA, int idB, int resultId, int resultQuantity = 1);
+
+    // Monta adjacências e textos de tooltip usando os nomes do registro.
+    void Build(const ItemRegistry& items);
+
+    // Receita do par informado, em qualquer ordem (nullptr se não existe).
+    const ForgeRecipe* Find(int idA, int idB) const;
+
+    // Combinações em que o item participa, ordenadas pelo id do parceiro (vazio antes do Build).
+    ForgeComboRange CombosFor(int itemId) const;
+
+    // Texto "Combina com:" pré-formatado do item (string vazia se não participa de receitas).
+    const std::string& ComboText(int itemId) const;
+
+    // Recebe os slots do jogador e preenche outRecipes com os índices das receitas que dá para forjar com eles.
+    // Custa proporcional aos itens possuídos e às combinações de cada um, não ao total de receitas.
+    // Reaproveita um buffer interno entre chamadas (não aloca em regime; não chamar de várias threads).
+    void FindCraftable(const ItemSlot* slots, std::size_t slotCount, std::vector<int>& outRecipes) const;
+
+    const ForgeRecipe& Recipe(int recipeIndex) const { return recipes_[static_cast<std::size_t>(recipeIndex)]; }
+    std::size_t Size() const { return recipes_.size(); }
+
+private:
+    static std::uint64_t MakeKey(int idA, int idB);
+
+    std::vector<ForgeRecipe> recipes_;
+    std::unordered_map<std::uint64_t, int> recipeByKey_; // Par ordenado -> posição em recipes_
+    std::vector<std::int32_t> comboOffsets_;              // id -> início em combos_; id + 1 -> fim
+    std::vector<ForgeCombo> combos_;                      // Adjacências de todos os itens, agrupadas por id
+    std::vector<std::string> comboText_;                  // id -> tooltip pré-formatado
+    mutable std::vector<ItemSlot> ownedScratch_;          // Itens possuídos somados, reaproveitado por FindCraftable
+    bool built_{false};
+};
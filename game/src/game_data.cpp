@@ -0,0 +1,1113 @@
+#include "game_data.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "asset_archive.h"
+#include "data_watcher.h"
+
+namespace {
+
+constexpr const char* kDataFileNames[] = {"weapons.txt", "items.txt", "enemies.txt", "loot.txt"};
+constexpr std::size_t kDataFileCount = sizeof(kDataFileNames) / sizeof(kDataFileNames[0]);
+constexpr const char* kCachePath = "game_data.cache";
+
+// Cabeçalho do cache binário. Incrementar kCacheVersion sempre que mudar os campos visitados em VisitFields.
+constexpr char kCacheMagic[4] = {'C', 'J', 'G', 'D'};
+constexpr std::uint32_t kCacheVersion = 2;
+
+using DataTexts = std::array<std::string, kDataFileCount>;
+
+// Nomes aceitos nos arquivos para cada enum (mesma grafia dos enumeradores no código).
+template <typename Enum>
+struct EnumNames;
+
+template <>
+struct EnumNames<ProjectileKind> {
+    static constexpr const char* kNames[] = {"Blunt", "Swing", "Spear", "FullCircleSwing", "Ranged"};
+};
+
+template <>
+struct EnumNames<WeaponDisplayMode> {
+    static constexpr const char* kNames[] = {"Hidden", "Fixed", "AimAligned"};
+};
+
+template <>
+struct EnumNames<ThrownProjectileKind> {
+    static constexpr const char* kNames[] = {"Ammunition", "Laser"};
+};
+
+template <>
+struct EnumNames<WeaponAttributeKey> {
+    static constexpr const char* kNames[] = {"Constitution", "Strength", "Focus", "Mysticism", "Knowledge"};
+};
+
+template <>
+struct EnumNames<ItemCategory> {
+    static constexpr const char* kNames[] = {"None", "Weapon", "Armor", "Consumable", "Material", "Result"};
+};
+
+template <>
+struct EnumNames<BiomeType> {
+    static constexpr const char* kNames[] = {"Lobby", "Cave", "Mansion", "Dungeon", "Unknown"};
+};
+
+template <>
+struct EnumNames<LootSource> {
+    static constexpr const char* kNames[] = {"Chest", "Shop"};
+};
+
+template <typename Enum>
+constexpr int EnumCount() {
+    return static_cast<int>(std::size(EnumNames<Enum>::kNames));
+}
+
+// Lista de campos de cada struct de dados. O mesmo percurso serve ao parser de texto (chave = caminho com pontos)
+// e ao cache binário (campos na ordem abaixo), então um campo novo só precisa ser acrescentado aqui.
+// Blocos de atributos percorrem a lista de campos refletida em player.h (AttributeFieldList).
+template <typename V, typename Block>
+void VisitAttributeFields(V& v, Block& attributes) {
+    ForEachAttributeField<Block>([&](const auto& field) { v.Field(field.key, attributes.*(field.member)); });
+}
+
+template <typename V>
+void VisitFields(V& v, PrimaryAttributes& attributes) {
+    VisitAttributeFields(v, attributes);
+}
+
+template <typename V>
+void VisitFields(V& v, AttackAttributes& attributes) {
+    VisitAttributeFields(v, attributes);
+}
+
+template <typename V>
+void VisitFields(V& v, SecondaryAttributes& attributes) {
+    VisitAttributeFields(v, attributes);
+}
+
+template <typename V>
+void VisitFields(V& v, PlayerAttributes& attributes) {
+    v.Group("primary", attributes.primary);
+    v.Group("attack", attributes.attack);
+    v.Group("secondary", attributes.secondary);
+}
+
+template <typename V>
+void VisitFields(V& v, ProjectileCommonParams& common) {
+    v.Field("damage", common.damage);
+    v.Field("lifespanSeconds", common.lifespanSeconds);
+    v.Field("projectileSpeed", common.projectileSpeed);
+    v.Field("projectileSize", common.projectileSize);
+    v.Field("projectilesPerShot", common.projectilesPerShot);
+    v.Field("randomSpreadDegrees", common.randomSpreadDegrees);
+    v.Field("angleOffsetsDegrees", common.angleOffsetsDegrees);
+    v.Field("positionalOffsets", common.positionalOffsets);
+    v.Field("delayBetweenProjectiles", common.delayBetweenProjectiles);
+    v.Field("debugColor", common.debugColor);
+    v.Field("spriteId", common.spriteId);
+    v.Field("weaponSpritePath", common.weaponSpritePath);
+    v.Field("projectileSpritePath", common.projectileSpritePath);
+    v.Field("projectileRotationOffsetDegrees", common.projectileRotationOffsetDegrees);
+    v.Field("projectileForwardOffset", common.projectileForwardOffset);
+    v.Field("displayMode", common.displayMode);
+    v.Field("displayOffset", common.displayOffset);
+    v.Field("displayLength", common.displayLength);
+    v.Field("displayThickness", common.displayThickness);
+    v.Field("displayColor", common.displayColor);
+    v.Field("displayHoldSeconds", common.displayHoldSeconds);
+    v.Field("criticalChance", common.criticalChance);
+    v.Field("criticalMultiplier", common.criticalMultiplier);
+    v.Field("perTargetHitCooldownSeconds", common.perTargetHitCooldownSeconds);
+}
+
+template <typename V>
+void VisitFields(V& v, BluntProjectileParams& blunt) {
+    v.Field("radius", blunt.radius);
+    v.Field("travelDegrees", blunt.travelDegrees);
+    v.Field("length", blunt.length);
+    v.Field("thickness", blunt.thickness);
+    v.Field("followOwner", blunt.followOwner);
+}
+
+template <typename V>
+void VisitFields(V& v, SwingProjectileParams& swing) {
+    v.Field("length", swing.length);
+    v.Field("thickness", swing.thickness);
+    v.Field("travelDegrees", swing.travelDegrees);
+    v.Field("followOwner", swing.followOwner);
+}
+
+template <typename V>
+void VisitFields(V& v, SpearProjectileParams& spear) {
+    v.Field("length", spear.length);
+    v.Field("thickness", spear.thickness);
+    v.Field("reach", spear.reach);
+    v.Field("extendDuration", spear.extendDuration);
+    v.Field("idleTime", spear.idleTime);
+    v.Field("retractDuration", spear.retractDuration);
+    v.Field("followOwner", spear.followOwner);
+    v.Field("offset", spear.offset);
+}
+
+template <typename V>
+void VisitFields(V& v, FullCircleSwingParams& fullCircle) {
+    v.Field("length", fullCircle.length);
+    v.Field("thickness", fullCircle.thickness);
+    v.Field("revolutions", fullCircle.revolutions);
+    v.Field("angularSpeedDegreesPerSecond", fullCircle.angularSpeedDegreesPerSecond);
+    v.Field("followOwner", fullCircle.followOwner);
+}
+
+template <typename V>
+void VisitFields(V& v, AmmunitionProjectileParams& ammunition) {
+    v.Field("speed", ammunition.speed);
+    v.Field("maxDistance", ammunition.maxDistance);
+    v.Field("radius", ammunition.radius);
+}
+
+template <typename V>
+void VisitFields(V& v, LaserProjectileParams& laser) {
+    v.Field("length", laser.length);
+    v.Field("thickness", laser.thickness);
+    v.Field("duration", laser.duration);
+    v.Field("startOffset", laser.startOffset);
+    v.Field("fadeOutDuration", laser.fadeOutDuration);
+    v.Field("staffHoldExtraSeconds", laser.staffHoldExtraSeconds);
+}
+
+template <typename V>
+void VisitFields(V& v, ThrownProjectileBlueprint& thrown) {
+    v.Field("kind", thrown.kind);
+    v.Group("common", thrown.common);
+    v.Group("ammunition", thrown.ammunition);
+    v.Group("laser", thrown.laser);
+    v.Field("followOwner", thrown.followOwner);
+}
+
+template <typename V>
+void VisitFields(V& v, ProjectileBlueprint& projectile) {
+    v.Field("kind", projectile.kind);
+    v.Group("common", projectile.common);
+    v.Group("blunt", projectile.blunt);
+    v.Group("swing", projectile.swing);
+    v.Group("spear", projectile.spear);
+    v.Group("fullCircle", projectile.fullCircle);
+    v.Field("thrownSpawnForwardOffset", projectile.thrownSpawnForwardOffset);
+    v.List("thrownProjectiles", projectile.thrownProjectiles); // Blocos [thrown] no texto
+}
+
+template <typename V>
+void VisitFields(V& v, WeaponDamageParams& damage) {
+    v.Field("baseDamage", damage.baseDamage);
+    v.Field("attributeScaling", damage.attributeScaling);
+}
+
+template <typename V>
+void VisitFields(V& v, WeaponCadenceParams& cadence) {
+    v.Field("baseAttacksPerSecond", cadence.baseAttacksPerSecond);
+    v.Field("dexterityGainPerPoint", cadence.dexterityGainPerPoint);
+    v.Field("attacksPerSecondCap", cadence.attacksPerSecondCap);
+}
+
+template <typename V>
+void VisitFields(V& v, WeaponCriticalParams& critical) {
+    v.Field("baseChance", critical.baseChance);
+    v.Field("chancePerLetalidade", critical.chancePerLetalidade);
+    v.Field("multiplier", critical.multiplier);
+}
+
+template <typename V>
+void VisitFields(V& v, WeaponInventorySprite& sprite) {
+    v.Field("spritePath", sprite.spritePath);
+    v.Field("drawSize", sprite.drawSize);
+    v.Field("drawOffset", sprite.drawOffset);
+    v.Field("rotationDegrees", sprite.rotationDegrees);
+}
+
+template <typename V>
+void VisitFields(V& v, WeaponBlueprint& weapon) {
+    v.Field("name", weapon.name);
+    v.Group("projectile", weapon.projectile);
+    v.Field("cooldownSeconds", weapon.cooldownSeconds);
+    v.Field("holdToFire", weapon.holdToFire);
+    v.Field("usesSeparateProjectileSprite", weapon.usesSeparateProjectileSprite);
+    v.Field("attributeKey", weapon.attributeKey);
+    v.Group("damage", weapon.damage);
+    v.Group("cadence", weapon.cadence);
+    v.Group("critical", weapon.critical);
+    v.Group("passiveBonuses", weapon.passiveBonuses);
+    v.Group("inventorySprite", weapon.inventorySprite);
+}
+
+template <typename V>
+void VisitFields(V& v, ItemRecord& item) {
+    ItemDefinition& def = item.definition;
+    v.Field("id", def.id);
+    v.Field("name", def.name);
+    v.Field("category", def.category);
+    v.Field("description", def.description);
+    v.Field("rarity", def.rarity);
+    v.Field("baseValue", def.baseValue);
+    v.Group("attributeBonuses", def.attributeBonuses);
+    v.Field("inventorySpritePath", def.inventorySpritePath);
+    v.Field("inventorySpriteDrawSize", def.inventorySpriteDrawSize);
+    v.Field("weapon", item.weaponName);
+    v.Field("ability", item.abilityName);
+}
+
+template <typename V>
+void VisitFields(V& v, ForgeRecipe& recipe) {
+    v.Field("inputA", recipe.inputA);
+    v.Field("inputB", recipe.inputB);
+    v.Field("resultId", recipe.resultId);
+    v.Field("resultQuantity", recipe.resultQuantity);
+}
+
+template <typename V>
+void VisitFields(V& v, EnemySpriteInfo& sprite) {
+    v.Field("idleSpritePath", sprite.idleSpritePath);
+    v.Field("walkingSpriteSheetPath", sprite.walkingSpriteSheetPath);
+    v.Field("frameWidth", sprite.frameWidth);
+    v.Field("frameHeight", sprite.frameHeight);
+    v.Field("frameCount", sprite.frameCount);
+    v.Field("secondsPerFrame", sprite.secondsPerFrame);
+}
+
+template <typename V>
+void VisitFields(V& v, EnemyRecord& enemy) {
+    v.Field("id", enemy.config.id);
+    v.Field("name", enemy.config.name);
+    v.Field("biome", enemy.config.biome);
+    v.Field("maxHealth", enemy.config.maxHealth);
+    v.Field("speed", enemy.config.speed);
+    v.Field("spawnRate", enemy.config.spawnRate);
+    v.Field("collisionRadius", enemy.config.collisionRadius);
+    v.Field("range", enemy.range);
+    v.Field("weapon", enemy.weaponName);
+    v.Group("sprite", enemy.sprite);
+}
+
+// Uma chave por bioma/origem ("biome.Cave = ...", "source.Shop = ..."), na ordem dos enums.
+constexpr const char* kLootBiomeKeys[] = {"biome.Lobby", "biome.Cave", "biome.Mansion", "biome.Dungeon", "biome.Unknown"};
+constexpr const char* kLootSourceKeys[] = {"source.Chest", "source.Shop"};
+static_assert(std::size(kLootBiomeKeys) == static_cast<std::size_t>(LootTableSet::kBiomeCount), "kLootBiomeKeys fora de sincronia com BiomeType");
+static_assert(std::size(kLootSourceKeys) == static_cast<std::size_t>(kLootSourceCount), "kLootSourceKeys fora de sincronia com LootSource");
+
+template <typename V>
+void VisitFields(V& v, LootWeights& loot) {
+    v.Field("rarityWeights", loot.rarityWeights);
+    v.Field("luckPerRarity", loot.luckPerRarity);
+    for (std::size_t i = 0; i < loot.biomeCategoryWeights.size(); ++i) {
+        v.Field(kLootBiomeKeys[i], loot.biomeCategoryWeights[i]);
+    }
+    for (std::size_t i = 0; i < loot.sourceCategoryWeights.size(); ++i) {
+        v.Field(kLootSourceKeys[i], loot.sourceCategoryWeights[i]);
+    }
+}
+
+// ---- Leitura de valores em texto ----
+
+std::string_view Trim(std::string_view text) {
+    const char* whitespace = " \t\r\n";
+    std::size_t first = text.find_first_not_of(whitespace);
+    if (first == std::string_view::npos) {
+        return {};
+    }
+    std::size_t last = text.find_last_not_of(whitespace);
+    return text.substr(first, last - first + 1);
+}
+
+// Separa uma lista "a, b, c" em partes já sem espaços.
+std::vector<std::string_view> SplitList(std::string_view text, char separator = ',') {
+    std::vector<std::string_view> parts;
+    std::size_t start = 0;
+    while (start <= text.size()) {
+        std::size_t end = text.find(separator, start);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        parts.push_back(Trim(text.substr(start, end - start)));
+        start = end + 1;
+    }
+    return parts;
+}
+
+bool ParseValue(std::string_view text, float& out) {
+    std::string buffer(text);
+    char* end = nullptr;
+    float value = std::strtof(buffer.c_str(), &end);
+    if (buffer.empty() || end != buffer.c_str() + buffer.size()) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+bool ParseValue(std::string_view text, int& out) {
+    std::string buffer(text);
+    char* end = nullptr;
+    long value = std::strtol(buffer.c_str(), &end, 10);
+    if (buffer.empty() || end != buffer.c_str() + buffer.size()) {
+        return false;
+    }
+    out = static_cast<int>(value);
+    return true;
+}
+
+bool ParseValue(std::string_view text, bool& out) {
+    if (text == "true") {
+        out = true;
+        return true;
+    }
+    if (text == "false") {
+        out = false;
+        return true;
+    }
+    return false;
+}
+
+bool ParseValue(std::string_view text, std::string& out) {
+    out.assign(text);
+    return true;
+}
+
+bool ParseValue(std::string_view text, Vector2& out) {
+    std::vector<std::string_view> parts = SplitList(text);
+    Vector2 value{};
+    if (parts.size() != 2 || !ParseValue(parts[0], value.x) || !ParseValue(parts[1], value.y)) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+bool ParseValue(std::string_view text, Color& out) {
+    std::vector<std::string_view> parts = SplitList(text);
+    if (parts.size() != 3 && parts.size() != 4) {
+        return false;
+    }
+    int channels[4] = {0, 0, 0, 255};
+    for (std::size_t i = 0; i < parts.size(); ++i) {
+        if (!ParseValue(parts[i], channels[i]) || channels[i] < 0 || channels[i] > 255) {
+            return false;
+        }
+    }
+    out = Color{static_cast<unsigned char>(channels[0]), static_cast<unsigned char>(channels[1]),
+                static_cast<unsigned char>(channels[2]), static_cast<unsigned char>(channels[3])};
+    return true;
+}
+
+bool ParseValue(std::string_view text, std::vector<float>& out) {
+    std::vector<float> values;
+    if (!text.empty()) {
+        for (std::string_view part : SplitList(text)) {
+            float value = 0.0f;
+            if (!ParseValue(part, value)) {
+                return false;
+            }
+            values.push_back(value);
+        }
+    }
+    out = std::move(values);
+    return true;
+}
+
+// Lista de pontos separados por ';' ("x, y; x, y").
+bool ParseValue(std::string_view text, std::vector<Vector2>& out) {
+    std::vector<Vector2> values;
+    if (!text.empty()) {
+        for (std::string_view part : SplitList(text, ';')) {
+            Vector2 value{};
+            if (!ParseValue(part, value)) {
+                return false;
+            }
+            values.push_back(value);
+        }
+    }
+    out = std::move(values);
+    return true;
+}
+
+template <typename Enum, typename = std::enable_if_t<std::is_enum_v<Enum>>>
+bool ParseValue(std::string_view text, Enum& out) {
+    for (int i = 0; i < EnumCount<Enum>(); ++i) {
+        if (text == EnumNames<Enum>::kNames[i]) {
+            out = static_cast<Enum>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Aplica "chave = valor" a uma struct percorrendo seus campos até achar o caminho (ex.: projectile.common.damage).
+class TextFieldSetter {
+public:
+    TextFieldSetter(std::string_view key, std::string_view value) : key_(key), value_(value) {}
+
+    template <typename T>
+    void Field(const char* name, T& field) {
+        if (!matched_ && key_.substr(consumed_) == name) {
+            matched_ = true;
+            parsed_ = ParseValue(value_, field);
+        }
+    }
+
+    template <typename T>
+    void Group(const char* name, T& group) {
+        if (matched_) {
+            return;
+        }
+        std::string_view rest = key_.substr(consumed_);
+        std::size_t length = std::strlen(name);
+        if (rest.size() > length && rest.compare(0, length, name) == 0 && rest[length] == '.') {
+            consumed_ += length + 1;
+            VisitFields(*this, group);
+            consumed_ -= length + 1;
+        }
+    }
+
+    // Listas de sub-blocos vêm de seções próprias ([thrown]), não de chaves.
+    template <typename Container>
+    void List(const char*, Container&) {}
+
+    bool Matched() const { return matched_; }
+    bool Parsed() const { return parsed_; }
+
+private:
+    std::string_view key_;
+    std::string_view value_;
+    std::size_t consumed_{0};
+    bool matched_{false};
+    bool parsed_{false};
+};
+
+// ---- Cache binário ----
+
+class BinaryWriter {
+public:
+    template <typename T>
+    void Field(const char*, T& value) {
+        Write(value);
+    }
+
+    template <typename T>
+    void Group(const char*, T& group) {
+        VisitFields(*this, group);
+    }
+
+    template <typename Container>
+    void List(const char*, Container& items) {
+        WriteCount(items.size());
+        for (auto& item : items) {
+            VisitFields(*this, item);
+        }
+    }
+
+    void WriteRaw(const void* data, std::size_t size) {
+        const char* bytes = static_cast<const char*>(data);
+        bytes_.insert(bytes_.end(), bytes, bytes + size);
+    }
+
+    void WriteCount(std::size_t count) { Write(static_cast<std::uint32_t>(count)); }
+
+    const std::string& Bytes() const { return bytes_; }
+
+private:
+    template <typename T>
+    void Write(const T& value) {
+        if constexpr (std::is_enum_v<T>) {
+            Write(static_cast<std::int32_t>(value));
+        } else {
+            static_assert(std::is_trivially_copyable_v<T>, "tipo sem serialização");
+            WriteRaw(&value, sizeof(T));
+        }
+    }
+
+    void Write(const std::string& value) {
+        WriteCount(value.size());
+        WriteRaw(value.data(), value.size());
+    }
+
+    template <typename T>
+    void Write(const std::vector<T>& values) {
+        WriteCount(values.size());
+        for (const T& value : values) {
+            Write(value);
+        }
+    }
+
+    std::string bytes_;
+};
+
+class BinaryReader {
+public:
+    BinaryReader(const char* data, std::size_t size) : data_(data), size_(size) {}
+
+    template <typename T>
+    void Field(const char*, T& value) {
+        Read(value);
+    }
+
+    template <typename T>
+    void Group(const char*, T& group) {
+        VisitFields(*this, group);
+    }
+
+    template <typename Container>
+    void List(const char*, Container& items) {
+        std::size_t count = ReadCount();
+        items.assign(count, typename Container::value_type{});
+        for (auto& item : items) {
+            VisitFields(*this, item);
+        }
+    }
+
+    bool ReadRaw(void* out, std::size_t size) {
+        if (!ok_ || size > size_ - offset_) {
+            ok_ = false;
+            return false;
+        }
+        std::memcpy(out, data_ + offset_, size);
+        offset_ += size;
+        return true;
+    }
+
+    // Contagens acima dos bytes restantes só podem vir de arquivo corrompido.
+    std::size_t ReadCount() {
+        std::uint32_t count = 0;
+        Read(count);
+        if (count > size_ - offset_) {
+            ok_ = false;
+            return 0;
+        }
+        return count;
+    }
+
+    bool Ok() const { return ok_; }
+    bool AtEnd() const { return offset_ == size_; }
+
+private:
+    template <typename T>
+    void Read(T& value) {
+        if constexpr (std::is_enum_v<T>) {
+            std::int32_t raw = 0;
+            Read(raw);
+            if (raw < 0 || raw >= EnumCount<T>()) {
+                ok_ = false;
+                raw = 0;
+            }
+            value = static_cast<T>(raw);
+        } else {
+            ReadRaw(&value, sizeof(T));
+        }
+    }
+
+    void Read(std::string& value) {
+        std::size_t count = ReadCount();
+        value.resize(count);
+        if (count > 0) {
+            ReadRaw(value.data(), count);
+        }
+    }
+
+    template <typename T>
+    void Read(std::vector<T>& values) {
+        std::size_t count = ReadCount();
+        values.assign(count, T{});
+        for (T& value : values) {
+            Read(value);
+        }
+    }
+
+    const char* data_;
+    std::size_t size_;
+    std::size_t offset_{0};
+    bool ok_{true};
+};
+
+// Mesma ordem na escrita e na leitura: armas, itens, receitas, inimigos.
+template <typename V>
+void VisitGameData(V& v, GameData& data) {
+    v.List("weapons", data.weapons);
+    v.List("items", data.items);
+    v.List("recipes", data.recipes);
+    v.List("enemies", data.enemies);
+    v.Group("loot", data.loot);
+}
+
+// FNV-1a de 64 bits sobre a versão do cache e o conteúdo dos arquivos de texto.
+std::uint64_t FingerprintTexts(const DataTexts& texts) {
+    std::uint64_t hash = 1469598103934665603ULL;
+    auto mix = [&hash](const void* data, std::size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ULL;
+        }
+    };
+    mix(&kCacheVersion, sizeof(kCacheVersion));
+    for (const std::string& text : texts) {
+        const std::uint64_t size = text.size();
+        mix(&size, sizeof(size));
+        mix(text.data(), text.size());
+    }
+    return hash;
+}
+
+bool LoadCache(const char* path, std::uint64_t fingerprint, GameData& outData) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    BinaryReader reader(bytes.data(), bytes.size());
+    char magic[4] = {};
+    std::uint32_t version = 0;
+    std::uint64_t storedFingerprint = 0;
+    reader.ReadRaw(magic, sizeof(magic));
+    reader.ReadRaw(&version, sizeof(version));
+    reader.ReadRaw(&storedFingerprint, sizeof(storedFingerprint));
+    if (!reader.Ok() || std::memcmp(magic, kCacheMagic, sizeof(magic)) != 0 || version != kCacheVersion ||
+        storedFingerprint != fingerprint) {
+        return false;
+    }
+
+    GameData data;
+    VisitGameData(reader, data);
+    if (!reader.Ok() || !reader.AtEnd()) {
+        std::cerr << "[Data] Cache " << path << " corrompido; refazendo o parse" << std::endl;
+        return false;
+    }
+    outData = std::move(data);
+    return true;
+}
+
+// Grava em arquivo temporário e renomeia, para que uma gravação interrompida não deixe cache pela metade.
+void SaveCache(const char* path, std::uint64_t fingerprint, GameData& data) {
+    BinaryWriter writer;
+    writer.WriteRaw(kCacheMagic, sizeof(kCacheMagic));
+    writer.WriteRaw(&kCacheVersion, sizeof(kCacheVersion));
+    writer.WriteRaw(&fingerprint, sizeof(fingerprint));
+    VisitGameData(writer, data);
+
+    const std::string tempPath = std::string(path) + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.write(writer.Bytes().data(), static_cast<std::streamsize>(writer.Bytes().size()))) {
+            std::cerr << "[Data] Nao foi possivel gravar " << tempPath << std::endl;
+            return;
+        }
+    }
+    std::remove(path);
+    if (std::rename(tempPath.c_str(), path) != 0) {
+        std::cerr << "[Data] Nao foi possivel gravar " << path << std::endl;
+        std::remove(tempPath.c_str());
+    }
+}
+
+// ---- Parse dos arquivos de texto ----
+
+// Contexto de erros de um arquivo; cada erro é reportado com arquivo:linha e contado.
+struct ParseContext {
+    const char* fileName{nullptr};
+    int errors{0};
+
+    void Error(int line, const std::string& message) {
+        std::cerr << "[Data] " << fileName << ":" << line << ": " << message << std::endl;
+        ++errors;
+    }
+};
+
+// Percorre as linhas ignorando vazias e comentários (#); chama onSection("nome") para "[nome]"
+// e onField(chave, valor) para "chave = valor".
+template <typename SectionFn, typename FieldFn>
+void ForEachDataLine(std::string_view text, ParseContext& context, SectionFn onSection, FieldFn onField) {
+    int lineNumber = 0;
+    std::size_t start = 0;
+    while (start < text.size()) {
+        std::size_t end = text.find('\n', start);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        std::string_view line = Trim(text.substr(start, end - start));
+        start = end + 1;
+        ++lineNumber;
+
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+        if (line.front() == '[') {
+            if (line.back() != ']') {
+                context.Error(lineNumber, "secao sem ']'");
+                continue;
+            }
+            onSection(lineNumber, Trim(line.substr(1, line.size() - 2)));
+            continue;
+        }
+        std::size_t equals = line.find('=');
+        if (equals == std::string_view::npos) {
+            context.Error(lineNumber, "linha sem '=': " + std::string(line));
+            continue;
+        }
+        onField(lineNumber, Trim(line.substr(0, equals)), Trim(line.substr(equals + 1)));
+    }
+}
+
+template <typename T>
+void ApplyField(T* target, std::string_view key, std::string_view value, ParseContext& context, int line) {
+    if (target == nullptr) {
+        context.Error(line, "chave fora de um bloco: " + std::string(key));
+        return;
+    }
+    TextFieldSetter setter(key, value);
+    VisitFields(setter, *target);
+    if (!setter.Matched()) {
+        context.Error(line, "chave desconhecida: " + std::string(key));
+    } else if (!setter.Parsed()) {
+        context.Error(line, "valor invalido para " + std::string(key) + ": " + std::string(value));
+    }
+}
+
+void ParseWeapons(std::string_view text, ParseContext& context, GameData& data) {
+    WeaponBlueprint* weapon = nullptr;
+    ThrownProjectileBlueprint* thrown = nullptr;
+    ForEachDataLine(
+        text, context,
+        [&](int line, std::string_view section) {
+            if (section == "weapon") {
+                weapon = &data.weapons.emplace_back();
+                thrown = nullptr;
+            } else if (section == "thrown") {
+                if (weapon == nullptr) {
+                    context.Error(line, "[thrown] antes de qualquer [weapon]");
+                    return;
+                }
+                thrown = &weapon->projectile.thrownProjectiles.emplace_back();
+            } else {
+                context.Error(line, "secao desconhecida: " + std::string(section));
+                weapon = nullptr;
+                thrown = nullptr;
+            }
+        },
+        [&](int line, std::string_view key, std::string_view value) {
+            if (thrown != nullptr) {
+                ApplyField(thrown, key, value, context, line);
+            } else {
+                ApplyField(weapon, key, value, context, line);
+            }
+        });
+}
+
+void ParseItems(std::string_view text, ParseContext& context, GameData& data) {
+    ItemRecord* item = nullptr;
+    ForgeRecipe* recipe = nullptr;
+    ForEachDataLine(
+        text, context,
+        [&](int line, std::string_view section) {
+            item = nullptr;
+            recipe = nullptr;
+            if (section == "item") {
+                item = &data.items.emplace_back();
+            } else if (section == "recipe") {
+                recipe = &data.recipes.emplace_back();
+            } else {
+                context.Error(line, "secao desconhecida: " + std::string(section));
+            }
+        },
+        [&](int line, std::string_view key, std::string_view value) {
+            if (recipe != nullptr) {
+                ApplyField(recipe, key, value, context, line);
+            } else {
+                ApplyField(item, key, value, context, line);
+            }
+        });
+}
+
+void ParseEnemies(std::string_view text, ParseContext& context, GameData& data) {
+    EnemyRecord* enemy = nullptr;
+    ForEachDataLine(
+        text, context,
+        [&](int line, std::string_view section) {
+            enemy = nullptr;
+            if (section == "enemy") {
+                enemy = &data.enemies.emplace_back();
+            } else {
+                context.Error(line, "secao desconhecida: " + std::string(section));
+            }
+        },
+        [&](int line, std::string_view key, std::string_view value) {
+            ApplyField(enemy, key, value, context, line);
+        });
+}
+
+// Um único bloco [loot]; chaves ausentes ficam vazias e são apontadas por ValidateGameData.
+void ParseLoot(std::string_view text, ParseContext& context, GameData& data) {
+    LootWeights* loot = nullptr;
+    bool seen = false;
+    ForEachDataLine(
+        text, context,
+        [&](int line, std::string_view section) {
+            loot = nullptr;
+            if (section != "loot") {
+                context.Error(line, "secao desconhecida: " + std::string(section));
+            } else if (seen) {
+                context.Error(line, "[loot] repetido");
+            } else {
+                seen = true;
+                loot = &data.loot;
+            }
+        },
+        [&](int line, std::string_view key, std::string_view value) {
+            ApplyField(loot, key, value, context, line);
+        });
+}
+
+bool HasWeapon(const GameData& data, const std::string& name) {
+    return std::any_of(data.weapons.begin(), data.weapons.end(), [&name](const WeaponBlueprint& weapon) {
+        return weapon.name == name;
+    });
+}
+
+// Confere referências entre arquivos (armas citadas por itens/inimigos, ids repetidos) e os pesos de loot.
+int ValidateGameData(const GameData& data) {
+    int errors = 0;
+    auto report = [&errors](const std::string& message) {
+        std::cerr << "[Data] " << message << std::endl;
+        ++errors;
+    };
+
+    for (std::size_t i = 0; i < data.weapons.size(); ++i) {
+        const std::string& name = data.weapons[i].name;
+        if (name.empty()) {
+            report("arma sem name");
+        }
+        for (std::size_t j = 0; j < i; ++j) {
+            if (data.weapons[j].name == name) {
+                report("arma repetida: " + name);
+            }
+        }
+    }
+
+    std::vector<int> itemIds;
+    for (const ItemRecord& item : data.items) {
+        const ItemDefinition& def = item.definition;
+        if (def.id <= 0 || def.id > ItemRegistry::kMaxItemId || def.name.empty()) {
+            report("item sem id valido ou sem nome (id " + std::to_string(def.id) + ")");
+        }
+        if (!item.weaponName.empty() && !HasWeapon(data, item.weaponName)) {
+            report("item " + def.name + " usa arma inexistente: " + item.weaponName);
+        }
+        itemIds.push_back(def.id);
+    }
+    std::sort(itemIds.begin(), itemIds.end());
+    for (std::size_t i = 1; i < itemIds.size(); ++i) {
+        if (itemIds[i] == itemIds[i - 1]) {
+            report("id de item repetido: " + std::to_string(itemIds[i]));
+        }
+    }
+
+    for (const ForgeRecipe& recipe : data.recipes) {
+        auto known = [&itemIds](int id) { return std::binary_search(itemIds.begin(), itemIds.end(), id); };
+        if (!known(recipe.inputA) || !known(recipe.inputB) || !known(recipe.resultId)) {
+            report("receita com item inexistente: " + std::to_string(recipe.inputA) + " + " +
+                   std::to_string(recipe.inputB) + " -> " + std::to_string(recipe.resultId));
+        }
+    }
+
+    for (const EnemyRecord& enemy : data.enemies) {
+        if (!enemy.weaponName.empty() && !HasWeapon(data, enemy.weaponName)) {
+            report("inimigo " + enemy.config.name + " usa arma inexistente: " + enemy.weaponName);
+        }
+    }
+
+    const LootWeights& loot = data.loot;
+    auto allNonNegative = [](const std::vector<float>& weights) {
+        return std::all_of(weights.begin(), weights.end(), [](float weight) { return weight >= 0.0f; });
+    };
+    if (loot.rarityWeights.empty() || !allNonNegative(loot.rarityWeights)) {
+        report("loot sem rarityWeights validos");
+    }
+    if (loot.luckPerRarity < 0.0f) {
+        report("loot com luckPerRarity negativo");
+    }
+    auto checkCategories = [&](const char* key, const std::vector<float>& weights) {
+        if (weights.size() != static_cast<std::size_t>(EnumCount<ItemCategory>()) || !allNonNegative(weights)) {
+            report(std::string("loot ") + key + " precisa de " + std::to_string(EnumCount<ItemCategory>()) +
+                   " pesos nao negativos (um por categoria)");
+        }
+    };
+    for (std::size_t i = 0; i < loot.biomeCategoryWeights.size(); ++i) {
+        checkCategories(kLootBiomeKeys[i], loot.biomeCategoryWeights[i]);
+    }
+    for (std::size_t i = 0; i < loot.sourceCategoryWeights.size(); ++i) {
+        checkCategories(kLootSourceKeys[i], loot.sourceCategoryWeights[i]);
+    }
+    return errors;
+}
+
+// Faz o parse dos quatro arquivos; devolve o total de erros (0 = dados completos).
+int ParseGameData(const DataTexts& texts, GameData& outData) {
+    int errors = 0;
+    ParseContext weapons{kDataFileNames[0]};
+    ParseWeapons(texts[0], weapons, outData);
+    ParseContext items{kDataFileNames[1]};
+    ParseItems(texts[1], items, outData);
+    ParseContext enemies{kDataFileNames[2]};
+    ParseEnemies(texts[2], enemies, outData);
+    ParseContext loot{kDataFileNames[3]};
+    ParseLoot(texts[3], loot, outData);
+    errors += weapons.errors + items.errors + enemies.errors + loot.errors;
+    errors += ValidateGameData(outData);
+    return errors;
+}
+
+// ---- Estado global ----
+
+GameData g_gameData;
+std::uint32_t g_gameDataVersion = 0;
+bool g_loadAttempted = false;
+std::string g_dataDirectory = "assets/data";
+#if defined(GAME_HOT_RELOAD)
+DirectoryWatcher g_dataWatcher;
+#endif
+
+// Arquivo solto tem prioridade sobre o assets.pak para que edições de balanceamento valham sem reempacotar.
+bool ReadDataFile(const std::string& path, std::string& outText) {
+    std::ifstream file(path, std::ios::binary);
+    if (file) {
+        outText.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return true;
+    }
+    AssetBlob blob{};
+    if (FindPackedAsset(path, blob)) {
+        outText.assign(reinterpret_cast<const char*>(blob.data), blob.size);
+        return true;
+    }
+    return false;
+}
+
+bool ReadDataTexts(const std::string& directory, DataTexts& outTexts, bool logMissing) {
+    for (std::size_t i = 0; i < kDataFileCount; ++i) {
+        const std::string path = directory + "/" + kDataFileNames[i];
+        if (!ReadDataFile(path, outTexts[i])) {
+            if (logMissing) {
+                std::cerr << "[Data] Arquivo de dados nao encontrado: " << path << std::endl;
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+// Publica dados novos. Blueprints com o mesmo nome são sobrescritos no lugar: itens, armas empunhadas e inimigos
+// guardam ponteiros para eles. Os vetores internos (thrownProjectiles) podem mudar de endereço, por isso projéteis
+// vivos precisam ser descartados antes desta chamada (beforePublish de PollGameDataHotReload).
+void PublishGameData(GameData&& fresh) {
+    for (WeaponBlueprint& weapon : fresh.weapons) {
+        auto it = std::find_if(g_gameData.weapons.begin(), g_gameData.weapons.end(), [&weapon](const WeaponBlueprint& existing) {
+            return existing.name == weapon.name;
+        });
+        if (it != g_gameData.weapons.end()) {
+            *it = std::move(weapon);
+        } else {
+            g_gameData.weapons.push_back(std::move(weapon));
+        }
+    }
+    g_gameData.items = std::move(fresh.items);
+    g_gameData.recipes = std::move(fresh.recipes);
+    g_gameData.enemies = std::move(fresh.enemies);
+    g_gameData.loot = std::move(fresh.loot);
+    ++g_gameDataVersion;
+}
+
+} // namespace
+
+bool LoadGameData(const std::string& dataDirectory) {
+    g_loadAttempted = true;
+    g_dataDirectory = dataDirectory;
+
+    DataTexts texts;
+    if (!ReadDataTexts(dataDirectory, texts, true)) {
+        return false;
+    }
+
+    const std::uint64_t fingerprint = FingerprintTexts(texts);
+    GameData fresh;
+    if (!LoadCache(kCachePath, fingerprint, fresh)) {
+        // Mesma regra da recarga: dados com erro não são publicados (nem gravados no cache).
+        int errors = ParseGameData(texts, fresh);
+        if (errors > 0) {
+            std::cerr << "[Data] " << errors << " erro(s) nos arquivos de dados; nada foi carregado" << std::endl;
+            return false;
+        }
+        SaveCache(kCachePath, fingerprint, fresh);
+    }
+    PublishGameData(std::move(fresh));
+
+#if defined(GAME_HOT_RELOAD)
+    if (g_dataWatcher.Directory() != dataDirectory || !g_dataWatcher.IsActive()) {
+        g_dataWatcher.Start(dataDirectory);
+    }
+#endif
+    return true;
+}
+
+const GameData& GetGameData() {
+    if (!g_loadAttempted) {
+        LoadGameData(g_dataDirectory);
+    }
+    return g_gameData;
+}
+
+std::uint32_t GetGameDataVersion() {
+    return g_gameDataVersion;
+}
+
+const WeaponBlueprint* FindWeaponBlueprint(std::string_view name) {
+    for (const WeaponBlueprint& weapon : GetGameData().weapons) {
+        if (weapon.name == name) {
+            return &weapon;
+        }
+    }
+    return nullptr;
+}
+
+bool PollGameDataHotReload(const std::function<void()>& beforePublish) {
+#if defined(GAME_HOT_RELOAD)
+    if (!g_dataWatcher.Poll()) {
+        return false;
+    }
+
+    // Editores às vezes removem o arquivo antes de gravar o novo; a próxima notificação tenta de novo.
+    DataTexts texts;
+    if (!ReadDataTexts(g_dataDirectory, texts, false)) {
+        return false;
+    }
+
+    GameData fresh;
+    int errors = ParseGameData(texts, fresh);
+    if (errors > 0) {
+        std::cerr << "[Data] Recarga ignorada: " << errors << " erro(s); mantendo os dados anteriores" << std::endl;
+        return false;
+    }
+    SaveCache(kCachePath, FingerprintTexts(texts), fresh);
+    if (beforePublish) {
+        beforePublish();
+    }
+    PublishGameData(std::move(fresh));
+    std::cerr << "[Data] Dados recarregados de " << g_dataDirectory << std::endl;
+    return true;
+#else
+    (void)beforePublish;
+    return false;
+#endif
+}
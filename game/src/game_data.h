@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "enemy_common.h"
+#include "forge_recipes.h"
+#include "item_registry.h"
+#include "loot_tables.h"
+#include "room_types.h"
+#include "weapon.h"
+
+// Item como descrito em assets/data/items.txt; arma e habilidade ficam por nome até o inventário resolvê-las.
+struct ItemRecord {
+    ItemDefinition definition; // weaponBlueprint, value e activeAbility são preenchidos ao registrar
+    std::string weaponName;
+    std::string abilityName;
+};
+
+// Preset de inimigo descrito em assets/data/enemies.txt.
+struct EnemyRecord {
+    EnemyConfig config{};
+    float range{240.0f};
+    std::string weaponName;
+    EnemySpriteInfo sprite{};
+};
+
+// Pesos do sorteio de loot descritos no bloco [loot] de assets/data/loot.txt. As listas por categoria seguem a
+// ordem de ItemCategory (None, Weapon, Armor, Consumable, Material, Result).
+struct LootWeights {
+    std::vector<float> rarityWeights;  // Peso base por raridade (1 = comum ... N = mais rara)
+    float luckPerRarity{2.0f};         // Ganho de peso por degrau de raridade a cada 1.0 de sorte
+    std::array<std::vector<float>, LootTableSet::kBiomeCount> biomeCategoryWeights; // Indexado por BiomeType
+    std::array<std::vector<float>, kLootSourceCount> sourceCategoryWeights;         // Indexado por LootSource
+};
+
+// Conteúdo de balanceamento carregado dos arquivos de dados (armas, itens, receitas, inimigos e loot).
+struct GameData {
+    std::deque<WeaponBlueprint> weapons; // deque: ponteiros para blueprints continuam válidos ao recarregar
+    std::vector<ItemRecord> items;
+    std::vector<ForgeRecipe> recipes;
+    std::vector<EnemyRecord> enemies;
+    LootWeights loot;
+};
+
+// Recebe a pasta dos arquivos de dados; lê weapons/items/enemies/loot.txt (soltos ou do assets.pak) uma vez.
+// Se game_data.cache corresponde ao conteúdo atual dos arquivos, carrega o binário sem refazer o parse;
+// senão faz o parse e regrava o cache. Retorna false se algum arquivo está ausente ou tem erros; nesse caso
+// nada é publicado.
+bool LoadGameData(const std::string& dataDirectory = "assets/data");
+
+// Dados carregados (carrega da pasta padrão no primeiro acesso, se LoadGameData ainda não foi chamado).
+const GameData& GetGameData();
+
+// Incrementado a cada carga bem-sucedida; quem copia dados (registro de itens, spawner) compara para saber se está atrasado.
+std::uint32_t GetGameDataVersion();
+
+// Blueprint da arma com o nome exato informado (nullptr se não existe). O ponteiro vale até o fim do programa.
+const WeaponBlueprint* FindWeaponBlueprint(std::string_view name);
+
+// Em builds com GAME_HOT_RELOAD verifica se algum arquivo de dados foi salvo e, se o novo conteúdo não tem erros,
+// chama beforePublish e troca os dados no lugar (blueprints existentes são sobrescritos, não realocados).
+// beforePublish é o ponto para descartar quem referencia blueprints (projéteis vivos) antes da troca.
+// Retorna true quando houve recarga; sem GAME_HOT_RELOAD sempre retorna false.
+bool PollGameDataHotReload(const std::function<void()>& beforePublish = {});
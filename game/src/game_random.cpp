@@ -0,0 +1,60 @@
+#include "game_random.h"
+
+#include <array>
+
+namespace {
+
+constexpr std::size_t kStreamCount = static_cast<std::size_t>(RandomStreamId::Count);
+constexpr std::uint64_t kStreamSaltBase = 0x5EED5EED00000000ULL;
+
+std::uint64_t g_gameRandomSeed = 0;
+std::array<RandomStream, kStreamCount> g_streams{};
+
+} // namespace
+
+void RandomStream::Seed(std::uint64_t seed) {
+    std::uint64_t mix = seed;
+    for (std::uint64_t& word : state_) {
+        mix += 0x9E3779B97F4A7C15ULL;
+        word = MixSeed(mix);
+    }
+}
+
+int RandomStream::RangeInt(int minInclusive, int maxInclusive) {
+    if (maxInclusive < minInclusive) {
+        const int swap = minInclusive;
+        minInclusive = maxInclusive;
+        maxInclusive = swap;
+    }
+    const std::uint64_t span = static_cast<std::uint64_t>(static_cast<std::int64_t>(maxInclusive) - minInclusive) + 1;
+    if (span > 0xFFFFFFFFULL) {
+        return static_cast<int>(static_cast<std::int32_t>(NextU32()));
+    }
+    const std::uint32_t range = static_cast<std::uint32_t>(span);
+    std::uint64_t product = static_cast<std::uint64_t>(NextU32()) * range;
+    std::uint32_t low = static_cast<std::uint32_t>(product);
+    if (low < range) {
+        // Rejeita a faixa que daria mais peso a alguns resultados.
+        const std::uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            product = static_cast<std::uint64_t>(NextU32()) * range;
+            low = static_cast<std::uint32_t>(product);
+        }
+    }
+    return static_cast<int>(static_cast<std::int64_t>(minInclusive) + static_cast<std::int64_t>(product >> 32));
+}
+
+void SeedGameRandom(std::uint64_t worldSeed) {
+    g_gameRandomSeed = worldSeed;
+    for (std::size_t i = 0; i < kStreamCount; ++i) {
+        g_streams[i].Seed(DeriveSeed(worldSeed, kStreamSaltBase + i));
+    }
+}
+
+std::uint64_t GetGameRandomSeed() {
+    return g_gameRandomSeed;
+}
+
+RandomStream& GameRandom(RandomStreamId id) {
+    return g_streams[static_cast<std::size_t>(id)];
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+// Finalizador do SplitMix64: espalha bem os bits de entradas próximas (coordenadas, índices, contadores).
+constexpr std::uint64_t MixSeed(std::uint64_t value) {
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+// Seed filha de (seed, salt) sem estado; a mesma entrada gera sempre a mesma seed.
+constexpr std::uint64_t DeriveSeed(std::uint64_t seed, std::uint64_t salt) {
+    return MixSeed(seed ^ MixSeed(salt));
+}
+
+// Gerador xoshiro256** (32 bytes de estado, construção barata). Atende UniformRandomBitGenerator, mas os sorteios do
+// jogo usam os helpers abaixo: as distribuições da std variam entre bibliotecas e quebrariam a reprodução por seed.
+class RandomStream {
+public:
+    using result_type = std::uint64_t;
+
+    RandomStream() { Seed(0); }
+    explicit RandomStream(std::uint64_t seed) { Seed(seed); }
+
+    // Reinicia o estado a partir de uma seed de 64 bits (expandida com SplitMix64).
+    void Seed(std::uint64_t seed);
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~result_type{0}; }
+
+    result_type operator()() {
+        const std::uint64_t result = RotateLeft(state_[1] * 5, 7) * 9;
+        const std::uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = RotateLeft(state_[3], 45);
+        return result;
+    }
+
+    std::uint32_t NextU32() { return static_cast<std::uint32_t>((*this)() >> 32); }
+    // Uniforme em [0, 1).
+    float NextFloat() { return static_cast<float>((*this)() >> 40) * (1.0f / 16777216.0f); }
+    double NextDouble() { return static_cast<double>((*this)() >> 11) * (1.0 / 9007199254740992.0); }
+    // Uniforme em [minInclusive, maxInclusive], sem viés (método de Lemire).
+    int RangeInt(int minInclusive, int maxInclusive);
+    float RangeFloat(float minInclusive, float maxExclusive) {
+        return minInclusive + (maxExclusive - minInclusive) * NextFloat();
+    }
+    double RangeDouble(double minInclusive, double maxExclusive) {
+        return minInclusive + (maxExclusive - minInclusive) * NextDouble();
+    }
+    // True com a probabilidade informada (0..1).
+    bool Chance(float probability) { return NextFloat() < probability; }
+
+    // Stream filho independente; avança este stream uma posição.
+    RandomStream Split(std::uint64_t salt) { return RandomStream(DeriveSeed((*this)(), salt)); }
+
+    // Fisher-Yates com RangeInt (std::shuffle não tem algoritmo padronizado).
+    template <typename RandomIt>
+    void Shuffle(RandomIt first, RandomIt last) {
+        const auto count = std::distance(first, last);
+        for (auto i = count - 1; i > 0; --i) {
+            const auto j = RangeInt(0, static_cast<int>(i));
+            std::iter_swap(first + i, first + j);
+        }
+    }
+
+private:
+    static constexpr std::uint64_t RotateLeft(std::uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+    std::uint64_t state_[4];
+};
+
+// Streams do serviço central, um por subsistema; cada um avança sozinho, então sortear mais em um
+// (ex.: mais disparos) não muda a sequência dos outros.
+enum class RandomStreamId {
+    Enemies,     // Composição e posição dos inimigos spawnados
+    Combat,      // Esquiva do jogador e seeds dos sistemas de projéteis
+    Loot,        // Seeds de lojas/baús, moedas dropadas
+    Forge,       // Sucesso da forja
+    Effects,     // Só visual (jitter de números de dano)
+    Count
+};
+
+// Reinicia todos os streams a partir da seed da run; chamar no início de cada run.
+void SeedGameRandom(std::uint64_t worldSeed);
+// Seed usada no último SeedGameRandom (0 antes da primeira chamada).
+std::uint64_t GetGameRandomSeed();
+// Stream do subsistema; válido até o fim do programa.
+RandomStream& GameRandom(RandomStreamId id);
@@ -1,13 +1,20 @@
 #include "hud.h"
 
+#include "alloc_stats.h"
 #include "font_manager.h"
 #include "player.h"
 #include "raylib.h"
+#include "render_stats.h"
+#include "rlgl.h"
+#include "texture_manager.h"
 #include "ui_inventory.h"
 #include "weapon.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
+#include <cstdio>
 #include <string>
 #include <unordered_map>
 
@@ -25,8 +32,6 @@ constexpr Color kHealthTextColor{0, 0, 0, 255}; // Cor do texto numérico da bar
 
 constexpr float kSlotSize = 64.0f; // Tamanho padrao de cada slot de equipamento/arma
 constexpr float kSlotSpacing = 12.0f; // Espaco entre slots
-constexpr int kEquipmentSlotCount = 5; // Quantidade de slots exibidos para equipamentos
-constexpr int kWeaponSlotCount = 2; // Quantidade de slots para armas
 constexpr float kEquipmentBottomPadding = 32.0f; // Distancia da fileira de equipamentos ate a base da tela
 constexpr float kEquipmentRightPadding = 32.0f; // Distancia dos equipamentos ate a lateral direita
 constexpr float kWeaponGroupGap = 32.0f; // Separacao horizontal entre equipamentos e armas
@@ -42,54 +47,27 @@ constexpr Color kHudLabelColor{0, 0, 0, 255}; // Cor principal dos rotulos de HU
 constexpr Color kHudLabelOutlineColor{255, 255, 255, 255}; // Cor do contorno dos rotulos
 constexpr float kHudLabelOutlineThickness = 1.0f; // Espessura usada para o contorno de texto
 constexpr float kSlotSpritePadding = 0.0f; // Margem interna aplicada quando ajusta sprites aos slots
+constexpr int kCooldownBuckets = 16; // Degraus da sombra de recarga; so a troca de degrau redesenha o HUD
+constexpr Color kCooldownShadeColor{10, 12, 20, 170}; // Cor da sombra que cobre o slot enquanto a habilidade recarrega
+constexpr float kHudLayerMargin = 8.0f; // Folga acima da barra/slots incluida na faixa em cache
+constexpr Color kHudRedrawDebugColor{255, 214, 64, 255}; // Cor do contorno/texto do debug de redesenho
 
-struct HudSpriteCacheEntry { // Entrada cacheando textura carregada para icones do HUD
-    Texture2D texture{}; // Textura carregada da sprite
-    bool attemptedLoad{false}; // Indica se ja tentamos carregar o arquivo correspondente
-};
-
-std::unordered_map<std::string, HudSpriteCacheEntry> g_hudSpriteCache{}; // Cache global de sprites usados pelo HUD
+std::unordered_map<std::string, TextureHandle> g_hudSpriteHandles{}; // Handles adquiridos no gerenciador de texturas para icones do HUD
 
 float ResolveBarYPosition() { // Nao recebe parametros; calcula a coordenada Y da barra de vida com base no padding configurado
     return static_cast<float>(GetScreenHeight()) - kHealthBarBottomPadding - kHealthBarHeight;
 }
 
-Texture2D LoadHudTexture(const std::string& path) { // Recebe um caminho e tenta carregar a textura correspondente, aplicando filtro adequado
-    if (path.empty()) {
-        return Texture2D{};
-    }
-    if (!FileExists(path.c_str())) {
-        return Texture2D{};
-    }
-    Texture2D texture = LoadTexture(path.c_str());
-    if (texture.id != 0) {
-        SetTextureFilter(texture, TEXTURE_FILTER_POINT);
-    }
-    return texture;
-}
-
-Texture2D AcquireHudTexture(const std::string& path) { // Recebe caminho, verifica cache e garante que a textura esteja carregada antes de retornar
-    if (path.empty()) {
-        return Texture2D{};
-    }
-    auto& entry = g_hudSpriteCache[path];
-    if (!entry.attemptedLoad) {
-        entry.attemptedLoad = true;
-        entry.texture = LoadHudTexture(path);
+const TextureRegion& AcquireHudTexture(const std::string& path) { // Recebe caminho, resolve o handle uma unica vez e devolve a textura do gerenciador compartilhado
+    auto it = g_hudSpriteHandles.find(path);
+    if (it == g_hudSpriteHandles.end()) {
+        it = g_hudSpriteHandles.emplace(path, AcquireTexture(path, TEXTURE_FILTER_POINT)).first;
     }
-    return entry.texture;
+    return GetTextureRegion(it->second);
 }
 
 const ItemDefinition* FindHudItemDefinition(const InventoryUIState& state, int itemId) { // Recebe estado/informação do item e procura definition correspondente nos registros para uso no HUD
-    if (itemId <= 0) {
-        return nullptr;
-    }
-    for (const ItemDefinition& def : state.items) {
-        if (def.id == itemId) {
-            return &def;
-        }
-    }
-    return nullptr;
+    return state.items.Find(itemId);
 }
 
 Color RarityToColor(int rarity) { // Recebe nivel de raridade e devolve a cor associada para contorno do slot
@@ -127,27 +105,27 @@ bool DrawHudWeaponSprite(const WeaponBlueprint& blueprint, const Rectangle& rect
     if (sprite.spritePath.empty()) {
         return false;
     }
-    Texture2D texture = AcquireHudTexture(sprite.spritePath);
-    if (texture.id == 0) {
+    const TextureRegion& region = AcquireHudTexture(sprite.spritePath);
+    if (region.texture.id == 0) {
         return false;
     }
 
     Vector2 size = sprite.drawSize;
     if (size.x <= 0.0f) {
-        size.x = static_cast<float>(texture.width);
+        size.x = region.bounds.width;
     }
     if (size.y <= 0.0f) {
-        size.y = static_cast<float>(texture.height);
+        size.y = region.bounds.height;
     }
 
-    Rectangle src{0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     Vector2 center{
         rect.x + rect.width * 0.5f + sprite.drawOffset.x,
         rect.y + rect.height * 0.5f + sprite.drawOffset.y
     };
     Rectangle dest{center.x, center.y, size.x, size.y};
     Vector2 origin{size.x * 0.5f, size.y * 0.5f};
-    DrawTexturePro(texture, src, dest, origin, sprite.rotationDegrees, WHITE);
+    DrawTextureRegion(region, src, dest, origin, sprite.rotationDegrees, WHITE);
     return true;
 }
 
@@ -155,24 +133,24 @@ bool DrawHudItemSprite(const ItemDefinition& def, const Rectangle& rect) { // Re
     if (def.inventorySpritePath.empty()) {
         return false;
     }
-    Texture2D texture = AcquireHudTexture(def.inventorySpritePath);
-    if (texture.id == 0) {
+    const TextureRegion& region = AcquireHudTexture(def.inventorySpritePath);
+    if (region.texture.id == 0) {
         return false;
     }
 
     Vector2 drawSize = def.inventorySpriteDrawSize;
     if (drawSize.x <= 0.0f || drawSize.y <= 0.0f) {
-        float maxDim = static_cast<float>(std::max(texture.width, texture.height));
+        float maxDim = std::max(region.bounds.width, region.bounds.height);
         float targetDim = std::max(0.0f, std::min(rect.width, rect.height) - kSlotSpritePadding);
         float scale = (maxDim > 0.0f) ? std::min(1.0f, targetDim / maxDim) : 1.0f;
-        drawSize = Vector2{static_cast<float>(texture.width) * scale, static_cast<float>(texture.height) * scale};
+        drawSize = Vector2{region.bounds.width * scale, region.bounds.height * scale};
     }
 
-    Rectangle src{0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     Vector2 center{rect.x + rect.width * 0.5f, rect.y + rect.height * 0.5f};
     Rectangle dest{center.x, center.y, drawSize.x, drawSize.y};
     Vector2 origin{dest.width * 0.5f, dest.height * 0.5f};
-    DrawTexturePro(texture, src, dest, origin, 0.0f, WHITE);
+    DrawTextureRegion(region, src, dest, origin, 0.0f, WHITE);
     return true;
 }
 
@@ -195,21 +173,21 @@ void DrawHudSlotLabel(const std::string& label, const Rectangle& rect) { // Rece
         return;
     }
     const float fontSize = 16.0f;
-    const Font& font = GetGameFont();
+    const Font& font = GetGameFont(fontSize);
     Vector2 textSize = MeasureTextEx(font, label.c_str(), fontSize, 0.0f);
     Vector2 pos{
         rect.x + (rect.width - textSize.x) * 0.5f,
         rect.y + (rect.height - textSize.y) * 0.5f
     };
-    DrawTextEx(font, label.c_str(), pos, fontSize, 0.0f, kHudLabelColor);
+    Counted::DrawTextEx(font, label.c_str(), pos, fontSize, 0.0f, kHudLabelColor);
 }
 
 void DrawHudSlot(const InventoryUIState& state,
                  const Rectangle& rect,
                  int itemId,
                  const std::string& label) { // Desenha fundo/contorno do slot e tenta renderizar icone ou label de fallback
-    DrawRectangleRec(rect, kSlotBackgroundColor);
-    DrawRectangleLinesEx(rect, 2.0f, ResolveSlotBorderColor(state, itemId));
+    Counted::DrawRectangleRec(rect, kSlotBackgroundColor);
+    Counted::DrawRectangleLinesEx(rect, 2.0f, ResolveSlotBorderColor(state, itemId));
     if (!DrawHudIcon(state, rect, itemId)) {
         DrawHudSlotLabel(label, rect);
     }
@@ -221,7 +199,7 @@ void DrawTextWithOutline(const std::string& text,
                          float spacing,
                          Color fillColor,
                          Color outlineColor) { // Desenha texto com contorno renderizando offsets e depois o preenchimento principal
-    const Font& font = GetGameFont();
+    const Font& font = GetGameFont(fontSize);
     const Vector2 offsets[] = {
         {-kHudLabelOutlineThickness, 0.0f},
         {kHudLabelOutlineThickness, 0.0f},
@@ -230,9 +208,9 @@ void DrawTextWithOutline(const std::string& text,
     };
     for (const Vector2& offset : offsets) {
         Vector2 outlinePos{position.x + offset.x, position.y + offset.y};
-        DrawTextEx(font, text.c_str(), outlinePos, fontSize, spacing, outlineColor);
+        Counted::DrawTextEx(font, text.c_str(), outlinePos, fontSize, spacing, outlineColor);
     }
-    DrawTextEx(font, text.c_str(), position, fontSize, spacing, fillColor);
+    Counted::DrawTextEx(font, text.c_str(), position, fontSize, spacing, fillColor);
 }
 
 float EquipmentRowStartX(float screenWidth) { // Recebe largura da tela e calcula X inicial dos slots de equipamento
@@ -254,9 +232,8 @@ void DrawEquipmentRow(const InventoryUIState& state, float startX, float slotY)
     for (int i = 0; i < kEquipmentSlotCount; ++i) {
         float x = startX + static_cast<float>(i) * (kSlotSize + kSlotSpacing);
         Rectangle rect{x, slotY, kSlotSize, kSlotSize};
-        int itemId = (i < static_cast<int>(state.equipmentSlotIds.size())) ? state.equipmentSlotIds[i] : 0;
-        std::string label = (i < static_cast<int>(state.equipmentSlots.size())) ? state.equipmentSlots[i] : std::string();
-        DrawHudSlot(state, rect, itemId, label);
+        int itemId = state.equipmentSlotIds[i];
+        DrawHudSlot(state, rect, itemId, state.items.NameOf(itemId));
     }
 }
 
@@ -264,15 +241,14 @@ void DrawWeaponRow(const InventoryUIState& state, float startX, float slotY) { /
     for (int i = 0; i < kWeaponSlotCount; ++i) {
         float x = startX + static_cast<float>(i) * (kSlotSize + kSlotSpacing);
         Rectangle rect{x, slotY, kSlotSize, kSlotSize};
-        int itemId = (i < static_cast<int>(state.weaponSlotIds.size())) ? state.weaponSlotIds[i] : 0;
-        std::string label = (i < static_cast<int>(state.weaponSlots.size())) ? state.weaponSlots[i] : std::string();
-        DrawHudSlot(state, rect, itemId, label);
+        int itemId = state.weaponSlotIds[i];
+        DrawHudSlot(state, rect, itemId, state.items.NameOf(itemId));
     }
 }
 
 void DrawEquipmentLabel(float screenWidth, float screenHeight) { // Recebe dimensoes da tela e desenha o rotulo "equipamento" acima da fileira
     const std::string text = "equipamento";
-    const Font& font = GetGameFont();
+    const Font& font = GetGameFont(kEquipmentLabelFontSize);
     Vector2 textSize = MeasureTextEx(font, text.c_str(), kEquipmentLabelFontSize, 0.0f);
     float x = std::max(0.0f, screenWidth - kEquipmentLabelRightOffset - textSize.x);
     float y = std::max(0.0f, screenHeight - kEquipmentLabelBottomOffset - textSize.y);
@@ -281,7 +257,7 @@ void DrawEquipmentLabel(float screenWidth, float screenHeight) { // Recebe dimen
 
 void DrawWeaponLabel(float startX, float slotY) { // Desenha o rotulo "armas" alinhado aos slots correspondentes
     const std::string text = "armas";
-    const Font& font = GetGameFont();
+    const Font& font = GetGameFont(kWeaponLabelFontSize);
     float rowWidth = kSlotSize * kWeaponSlotCount + kSlotSpacing * static_cast<float>(kWeaponSlotCount - 1);
     Vector2 textSize = MeasureTextEx(font, text.c_str(), kWeaponLabelFontSize, 0.0f);
     float x = startX + (rowWidth - textSize.x) * 0.5f + kWeaponLabelOffset.x;
@@ -301,35 +277,219 @@ void DrawEquipmentAndWeapons(const InventoryUIState& state) { // Compoe a secao
     DrawWeaponLabel(weaponStartX, slotY);
 }
 
-} // namespace
+// Valores que definem o desenho do HUD; enquanto nenhum muda o quadro reaproveita a textura em cache.
+struct HudLayerKey {
+    int currentHp{0};
+    int maxHp{0};
+    int filledWidth{0}; // Largura em pixels da parte cheia da barra
+    std::array<int, kEquipmentSlotCount> equipmentIds{};
+    std::array<int, kWeaponSlotCount> weaponIds{};
+    std::array<int, kEquipmentSlotCount> cooldownBuckets{}; // 0 = pronto; 1..kCooldownBuckets = fracao restante
+    int screenWidth{0};
+    int screenHeight{0};
+    unsigned int fontGeneration{0};
+    std::uint64_t textureGeneration{0}; // Icones que terminam de carregar apos o ultimo redesenho
+
+    bool operator==(const HudLayerKey& other) const {
+        return currentHp == other.currentHp && maxHp == other.maxHp && filledWidth == other.filledWidth &&
+               equipmentIds == other.equipmentIds && weaponIds == other.weaponIds &&
+               cooldownBuckets == other.cooldownBuckets && screenWidth == other.screenWidth &&
+               screenHeight == other.screenHeight && fontGeneration == other.fontGeneration &&
+               textureGeneration == other.textureGeneration;
+    }
+};
 
-void DrawHUD(const PlayerCharacter& player, const InventoryUIState& inventoryState) { // Recebe o jogador e o estado de inventario, calcula barra de HP e desenha slots + textos no HUD, sem retorno
-    const float barX = kHealthBarLeftPadding;
-    const float barY = ResolveBarYPosition();
-    const float totalWidth = kHealthBarWidth;
-    const float totalHeight = kHealthBarHeight;
+// Faixa inferior da tela (barra de vida + slots) composta em render texture com alfa pre-multiplicado.
+struct HudLayerCache {
+    RenderTexture2D target{};
+    HudLayerKey key{};
+    bool valid{false};
+    float stripTop{0.0f};
+};
 
+HudLayerCache g_hudLayer{};
+
+// Estado do debug de redesenho (console: hud.redraws).
+bool g_hudRedrawDebug = false;
+int g_hudRedrawsInWindow = 0;
+int g_hudRedrawsPerSecond = 0;
+double g_hudRedrawWindowStart = 0.0;
+
+int ResolveCooldownBucket(const InventoryUIState& state, int slot, int itemId) { // Converte o tempo restante da habilidade do slot em degrau 0..kCooldownBuckets
+    if (itemId <= 0 || slot >= static_cast<int>(state.equipmentAbilityCooldowns.size())) {
+        return 0;
+    }
+    const float remaining = state.equipmentAbilityCooldowns[slot];
+    const ItemDefinition* def = FindHudItemDefinition(state, itemId);
+    if (remaining <= 0.0f || def == nullptr || def->activeAbility.cooldownSeconds <= 0.0f) {
+        return 0;
+    }
+    float fraction = std::clamp(remaining / def->activeAbility.cooldownSeconds, 0.0f, 1.0f);
+    return std::max(1, static_cast<int>(std::ceil(fraction * static_cast<float>(kCooldownBuckets))));
+}
+
+HudLayerKey BuildHudLayerKey(const PlayerCharacter& player, const InventoryUIState& state) { // Coleta os valores exibidos pelo HUD neste quadro
+    HudLayerKey key{};
     const float maxHealth = std::max(player.derivedStats.maxHealth, 1.0f);
     const float clampedHealth = std::clamp(player.currentHealth, 0.0f, maxHealth);
     const float hpPercent = std::clamp(clampedHealth / maxHealth, 0.0f, 1.0f);
+    key.currentHp = static_cast<int>(std::round(clampedHealth));
+    key.maxHp = static_cast<int>(std::round(maxHealth));
+    key.filledWidth = static_cast<int>(kHealthBarWidth * hpPercent);
 
-    const float filledWidth = totalWidth * hpPercent;
+    for (int i = 0; i < kEquipmentSlotCount; ++i) {
+        key.equipmentIds[i] = state.equipmentSlotIds[i];
+        key.cooldownBuckets[i] = ResolveCooldownBucket(state, i, key.equipmentIds[i]);
+    }
+    for (int i = 0; i < kWeaponSlotCount; ++i) {
+        key.weaponIds[i] = state.weaponSlotIds[i];
+    }
+
+    key.screenWidth = GetScreenWidth();
+    key.screenHeight = GetScreenHeight();
+    key.fontGeneration = GetGameFontGeneration();
+    key.textureGeneration = GetTextureResidencyGeneration();
+    return key;
+}
+
+void DrawCooldownShades(const HudLayerKey& key) { // Escurece a parte superior dos slots de equipamento proporcional ao degrau de recarga
+    const float screenWidth = static_cast<float>(key.screenWidth);
+    const float slotY = SlotRowY(static_cast<float>(key.screenHeight));
+    const float startX = EquipmentRowStartX(screenWidth);
+    for (int i = 0; i < kEquipmentSlotCount; ++i) {
+        if (key.cooldownBuckets[i] <= 0) {
+            continue;
+        }
+        float height = kSlotSize * static_cast<float>(key.cooldownBuckets[i]) / static_cast<float>(kCooldownBuckets);
+        float x = startX + static_cast<float>(i) * (kSlotSize + kSlotSpacing);
+        Counted::DrawRectangleRec(Rectangle{x, slotY, kSlotSize, height}, kCooldownShadeColor);
+    }
+}
+
+void DrawHudContents(const HudLayerKey& key, const InventoryUIState& state) { // Desenha barra de HP, texto e slots a partir dos valores da chave
+    const float barX = kHealthBarLeftPadding;
+    const float barY = ResolveBarYPosition();
+    const float totalWidth = kHealthBarWidth;
+    const float totalHeight = kHealthBarHeight;
+
+    const float filledWidth = static_cast<float>(key.filledWidth);
     const float filledX = barX + (totalWidth - filledWidth);
 
-    DrawRectangle(static_cast<int>(barX), static_cast<int>(barY), static_cast<int>(totalWidth), static_cast<int>(totalHeight), kEmptyColor);
-    DrawRectangle(static_cast<int>(filledX), static_cast<int>(barY), static_cast<int>(filledWidth), static_cast<int>(totalHeight), kFilledColor);
+    Counted::DrawRectangle(static_cast<int>(barX), static_cast<int>(barY), static_cast<int>(totalWidth), static_cast<int>(totalHeight), kEmptyColor);
+    Counted::DrawRectangle(static_cast<int>(filledX), static_cast<int>(barY), key.filledWidth, static_cast<int>(totalHeight), kFilledColor);
 
-    const int currentHpValue = static_cast<int>(std::round(clampedHealth));
-    const int maxHpValue = static_cast<int>(std::round(maxHealth));
-    std::string hpText = std::to_string(currentHpValue) + "/" + std::to_string(maxHpValue);
+    char hpText[32];
+    std::snprintf(hpText, sizeof(hpText), "%d/%d", key.currentHp, key.maxHp);
 
-    const Font& font = GetGameFont();
-    const Vector2 textSize = MeasureTextEx(font, hpText.c_str(), kHealthBarFontSize, kHealthBarTextSpacing);
+    const Font& font = GetGameFont(kHealthBarFontSize);
+    const Vector2 textSize = MeasureTextEx(font, hpText, kHealthBarFontSize, kHealthBarTextSpacing);
     const Vector2 textPos{
         barX + (totalWidth * 0.5f) - (textSize.x * 0.5f),
         barY + (totalHeight * 0.5f) - (textSize.y * 0.5f)
     };
-    DrawTextEx(font, hpText.c_str(), textPos, kHealthBarFontSize, kHealthBarTextSpacing, kHealthTextColor);
+    Counted::DrawTextEx(font, hpText, textPos, kHealthBarFontSize, kHealthBarTextSpacing, kHealthTextColor);
+
+    DrawEquipmentAndWeapons(state);
+    DrawCooldownShades(key);
+}
+
+bool RefreshHudLayer(const HudLayerKey& key, const InventoryUIState& state) { // Recompoe a textura se a chave mudou; retorna true quando houve redesenho
+    if (g_hudLayer.valid && g_hudLayer.key == key) {
+        return false;
+    }
+
+    const float screenHeight = static_cast<float>(key.screenHeight);
+    const float stripTop = std::max(0.0f, std::min(ResolveBarYPosition(), SlotRowY(screenHeight)) - kHudLayerMargin);
+    const int width = key.screenWidth;
+    const int height = static_cast<int>(std::ceil(screenHeight - stripTop));
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    RenderTexture2D& target = g_hudLayer.target;
+    if (target.id == 0 || target.texture.width != width || target.texture.height != height) {
+        if (target.id != 0) {
+            UnloadRenderTexture(target);
+        }
+        target = LoadRenderTexture(width, height);
+        SetTextureFilter(target.texture, TEXTURE_FILTER_POINT);
+    }
+
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+    // Cor multiplicada pelo alfa e alfa acumulado: a textura sai pre-multiplicada e compoe igual ao desenho direto.
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    rlPushMatrix();
+    rlTranslatef(0.0f, -stripTop, 0.0f);
+    DrawHudContents(key, state);
+    rlPopMatrix();
+    EndBlendMode();
+    EndTextureMode();
+
+    g_hudLayer.key = key;
+    g_hudLayer.valid = true;
+    g_hudLayer.stripTop = stripTop;
+    return true;
+}
+
+void DrawHudRedrawDebug(bool redrewThisFrame) { // Mostra redesenhos por segundo e contorna a faixa no quadro em que ela foi refeita
+    const double now = GetTime();
+    if (redrewThisFrame) {
+        ++g_hudRedrawsInWindow;
+    }
+    if (now - g_hudRedrawWindowStart >= 1.0) {
+        g_hudRedrawsPerSecond = g_hudRedrawsInWindow;
+        g_hudRedrawsInWindow = 0;
+        g_hudRedrawWindowStart = now;
+    }
+    if (!g_hudRedrawDebug) {
+        return;
+    }
 
-    DrawEquipmentAndWeapons(inventoryState);
+    const Texture2D& texture = g_hudLayer.target.texture;
+    if (redrewThisFrame) {
+        Counted::DrawRectangleLinesEx(Rectangle{0.0f, g_hudLayer.stripTop, static_cast<float>(texture.width), static_cast<float>(texture.height)},
+                                      2.0f,
+                                      kHudRedrawDebugColor);
+    }
+    char text[48];
+    std::snprintf(text, sizeof(text), "HUD: %d redesenhos/s", g_hudRedrawsPerSecond);
+    DrawTextWithOutline(text, Vector2{kHealthBarLeftPadding, g_hudLayer.stripTop - 20.0f}, kEquipmentLabelFontSize, 0.0f,
+                        kHudRedrawDebugColor, kHudLabelColor);
+}
+
+} // namespace
+
+void DrawHUD(const PlayerCharacter& player, const InventoryUIState& inventoryState) { // Recebe o jogador e o estado de inventario; redesenha a faixa do HUD so quando algo exibido mudou e a compoe na tela
+    RenderStatsScope statsScope(RenderSubsystem::Hud);
+    AllocScope allocScope(AllocTag::Hud);
+    const HudLayerKey key = BuildHudLayerKey(player, inventoryState);
+    const bool redrew = RefreshHudLayer(key, inventoryState);
+    if (!g_hudLayer.valid) {
+        return;
+    }
+
+    const Texture2D& texture = g_hudLayer.target.texture;
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    Counted::DrawTexturePro(texture,
+                            Rectangle{0.0f, 0.0f, static_cast<float>(texture.width), -static_cast<float>(texture.height)},
+                            Rectangle{0.0f, g_hudLayer.stripTop, static_cast<float>(texture.width), static_cast<float>(texture.height)},
+                            Vector2{0.0f, 0.0f},
+                            0.0f,
+                            WHITE);
+    EndBlendMode();
+
+    DrawHudRedrawDebug(redrew);
+}
+
+void ToggleHudRedrawDebug() { // Sem parametros; liga/desliga o contador de redesenhos do HUD
+    g_hudRedrawDebug = !g_hudRedrawDebug;
+}
+
+void UnloadHudCache() { // Sem parametros; libera a render texture do HUD
+    if (g_hudLayer.target.id != 0) {
+        UnloadRenderTexture(g_hudLayer.target);
+    }
+    g_hudLayer = HudLayerCache{};
 }
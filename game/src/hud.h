@@ -5,3 +5,9 @@ struct InventoryUIState;
 
 // Recebe o jogador e o estado do inventario para desenhar os elementos de HUD correspondentes na tela.
 void DrawHUD(const PlayerCharacter& player, const InventoryUIState& inventoryState);
+
+// Sem parametros; liga/desliga o debug que mostra quantas vezes por segundo a faixa do HUD foi redesenhada.
+void ToggleHudRedrawDebug();
+
+// Sem parametros; libera a render texture usada pelo HUD em cache (chamar antes de CloseWindow).
+void UnloadHudCache();
@@ -0,0 +1,305 @@
+#include "input_replay.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+constexpr char kReplayMagic[4] = {'C', 'J', 'R', 'P'};
+constexpr std::uint32_t kReplayVersion = 1;
+
+// Espelha AutomationEventType de rcore.c (raylib 5.x), que não é exportado em raylib.h.
+enum AutomationEventKind : unsigned int {
+    kEventKeyUp = 1,
+    kEventKeyDown = 2,
+    kEventMouseButtonUp = 5,
+    kEventMouseButtonDown = 6,
+    kEventMousePosition = 7,
+    kEventMouseWheel = 8
+};
+
+constexpr int kKeyCount = 512;        // MAX_KEYBOARD_KEYS do raylib
+constexpr int kMouseButtonCount = 7;  // MOUSE_BUTTON_LEFT..MOUSE_BUTTON_BACK
+
+// Registro gravado por tick.
+struct ReplayTick {
+    std::uint64_t worldHash{0};
+    float deltaSeconds{0.0f};
+    float mouseWorldX{0.0f};
+    float mouseWorldY{0.0f};
+};
+
+struct InputSession {
+    InputSessionMode mode{InputSessionMode::Off};
+    std::string path;
+    std::uint64_t worldSeed{0};
+    std::vector<ReplayTick> ticks;
+    std::vector<AutomationEvent> events;
+    std::uint32_t tick{0};          // Tick atual (índice em ticks)
+    std::size_t nextEvent{0};       // Próximo evento a injetar na reprodução
+    // Estado de input como o jogo o viu no último tick (gravação compara; reprodução reaplica o mouse).
+    std::array<bool, kKeyCount> keyDown{};
+    std::array<bool, kMouseButtonCount> buttonDown{};
+    int mouseX{0};
+    int mouseY{0};
+    // Tempo de CPU de cada tick (BeginInputTick..EndInputTick), para comparar antes/depois de mudanças no motor.
+    std::vector<float> tickMilliseconds;
+    std::chrono::steady_clock::time_point tickStart{};
+    std::uint32_t divergentTicks{0};
+    std::uint32_t firstDivergentTick{0};
+};
+
+InputSession g_session;
+
+AutomationEvent MakeEvent(std::uint32_t frame, unsigned int type, int param0, int param1 = 0) {
+    AutomationEvent event{};
+    event.frame = frame;
+    event.type = type;
+    event.params[0] = param0;
+    event.params[1] = param1;
+    return event;
+}
+
+// Compara o input do raylib com o do tick anterior e guarda só as mudanças.
+void CaptureTickEvents(InputSession& session) {
+    for (int key = 1; key < kKeyCount; ++key) {
+        const bool down = IsKeyDown(key);
+        if (down != session.keyDown[static_cast<std::size_t>(key)]) {
+            session.keyDown[static_cast<std::size_t>(key)] = down;
+            session.events.push_back(MakeEvent(session.tick, down ? kEventKeyDown : kEventKeyUp, key));
+        }
+    }
+    for (int button = 0; button < kMouseButtonCount; ++button) {
+        const bool down = IsMouseButtonDown(button);
+        if (down != session.buttonDown[static_cast<std::size_t>(button)]) {
+            session.buttonDown[static_cast<std::size_t>(button)] = down;
+            session.events.push_back(MakeEvent(session.tick, down ? kEventMouseButtonDown : kEventMouseButtonUp, button));
+        }
+    }
+    const Vector2 mouse = GetMousePosition();
+    const int mouseX = static_cast<int>(std::lround(mouse.x));
+    const int mouseY = static_cast<int>(std::lround(mouse.y));
+    if (session.tick == 0 || mouseX != session.mouseX || mouseY != session.mouseY) {
+        session.mouseX = mouseX;
+        session.mouseY = mouseY;
+        session.events.push_back(MakeEvent(session.tick, kEventMousePosition, mouseX, mouseY));
+    }
+    const Vector2 wheel = GetMouseWheelMoveV();
+    const int wheelX = static_cast<int>(std::lround(wheel.x));
+    const int wheelY = static_cast<int>(std::lround(wheel.y));
+    if (wheelX != 0 || wheelY != 0) {
+        session.events.push_back(MakeEvent(session.tick, kEventMouseWheel, wheelX, wheelY));
+    }
+    // O arquivo guarda mouse e roda em inteiros; reaplicar os valores arredondados faz a gravação ver o mesmo
+    // que a reprodução verá.
+    PlayAutomationEvent(MakeEvent(session.tick, kEventMousePosition, mouseX, mouseY));
+    PlayAutomationEvent(MakeEvent(session.tick, kEventMouseWheel, wheelX, wheelY));
+}
+
+// Injeta os eventos do tick atual e reafirma a posição do mouse (o cursor real não interfere na reprodução).
+void InjectTickEvents(InputSession& session) {
+    bool wheelMoved = false;
+    while (session.nextEvent < session.events.size() && session.events[session.nextEvent].frame <= session.tick) {
+        const AutomationEvent& event = session.events[session.nextEvent++];
+        if (event.type == kEventMousePosition) {
+            session.mouseX = event.params[0];
+            session.mouseY = event.params[1];
+            continue;
+        }
+        if (event.type == kEventMouseWheel) {
+            wheelMoved = true;
+        }
+        PlayAutomationEvent(event);
+    }
+    PlayAutomationEvent(MakeEvent(session.tick, kEventMousePosition, session.mouseX, session.mouseY));
+    if (!wheelMoved) {
+        PlayAutomationEvent(MakeEvent(session.tick, kEventMouseWheel, 0, 0));
+    }
+}
+
+template <typename T>
+void WritePod(std::ofstream& file, const T& value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool ReadPod(std::ifstream& file, T& value) {
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+bool WriteSessionFile(const InputSession& session) {
+    std::ofstream file(session.path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return false;
+    }
+    file.write(kReplayMagic, sizeof(kReplayMagic));
+    WritePod(file, kReplayVersion);
+    WritePod(file, session.worldSeed);
+    WritePod(file, static_cast<std::uint32_t>(session.ticks.size()));
+    WritePod(file, static_cast<std::uint32_t>(session.events.size()));
+    file.write(reinterpret_cast<const char*>(session.ticks.data()),
+               static_cast<std::streamsize>(session.ticks.size() * sizeof(ReplayTick)));
+    file.write(reinterpret_cast<const char*>(session.events.data()),
+               static_cast<std::streamsize>(session.events.size() * sizeof(AutomationEvent)));
+    return static_cast<bool>(file);
+}
+
+// Média, percentis e máximo do tempo por tick.
+void PrintTickTimeSummary(const InputSession& session) {
+    if (session.tickMilliseconds.empty()) {
+        return;
+    }
+    std::vector<float> sorted = session.tickMilliseconds;
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0.0;
+    for (float value : sorted) {
+        total += value;
+    }
+    auto percentile = [&sorted](double fraction) {
+        const std::size_t index = static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1));
+        return sorted[index];
+    };
+    std::cerr << "[Replay] " << sorted.size() << " ticks | media " << total / static_cast<double>(sorted.size())
+              << " ms | p50 " << percentile(0.50) << " ms | p95 " << percentile(0.95) << " ms | p99 "
+              << percentile(0.99) << " ms | max " << sorted.back() << " ms" << std::endl;
+}
+
+} // namespace
+
+bool StartInputRecording(const std::string& path, std::uint64_t worldSeed) {
+    g_session = InputSession{};
+    g_session.mode = InputSessionMode::Recording;
+    g_session.path = path;
+    g_session.worldSeed = worldSeed;
+    std::cerr << "[Replay] Gravando sessao em " << path << std::endl;
+    return true;
+}
+
+bool StartInputReplay(const std::string& path, std::uint64_t& worldSeed) {
+    std::ifstream file(path, std::ios::binary);
+    char magic[sizeof(kReplayMagic)]{};
+    std::uint32_t version = 0;
+    std::uint64_t seed = 0;
+    std::uint32_t tickCount = 0;
+    std::uint32_t eventCount = 0;
+    if (!file || !file.read(magic, sizeof(magic)) || std::memcmp(magic, kReplayMagic, sizeof(magic)) != 0 ||
+        !ReadPod(file, version) || version != kReplayVersion || !ReadPod(file, seed) || !ReadPod(file, tickCount) ||
+        !ReadPod(file, eventCount)) {
+        std::cerr << "[Replay] Arquivo de sessao invalido: " << path << std::endl;
+        return false;
+    }
+
+    InputSession session{};
+    session.ticks.resize(tickCount);
+    session.events.resize(eventCount);
+    if (!file.read(reinterpret_cast<char*>(session.ticks.data()), static_cast<std::streamsize>(tickCount * sizeof(ReplayTick))) ||
+        !file.read(reinterpret_cast<char*>(session.events.data()),
+                   static_cast<std::streamsize>(eventCount * sizeof(AutomationEvent)))) {
+        std::cerr << "[Replay] Arquivo de sessao truncado: " << path << std::endl;
+        return false;
+    }
+
+    session.mode = InputSessionMode::Replaying;
+    session.path = path;
+    session.worldSeed = seed;
+    g_session = std::move(session);
+    worldSeed = seed;
+    std::cerr << "[Replay] Reproduzindo " << tickCount << " ticks de " << path << std::endl;
+    return true;
+}
+
+void InjectKeyState(int key, bool down) {
+    PlayAutomationEvent(MakeEvent(g_session.tick, down ? kEventKeyDown : kEventKeyUp, key));
+}
+
+void InjectMouseButtonState(int button, bool down) {
+    PlayAutomationEvent(MakeEvent(g_session.tick, down ? kEventMouseButtonDown : kEventMouseButtonUp, button));
+}
+
+void InjectMousePosition(Vector2 screenPosition) {
+    PlayAutomationEvent(MakeEvent(g_session.tick, kEventMousePosition, static_cast<int>(std::lround(screenPosition.x)),
+                                  static_cast<int>(std::lround(screenPosition.y))));
+}
+
+InputSessionMode GetInputSessionMode() {
+    return g_session.mode;
+}
+
+float BeginInputTick(float frameDeltaSeconds) {
+    InputSession& session = g_session;
+    if (session.mode == InputSessionMode::Off) {
+        return frameDeltaSeconds;
+    }
+    session.tickStart = std::chrono::steady_clock::now();
+    if (session.mode == InputSessionMode::Recording) {
+        CaptureTickEvents(session);
+        ReplayTick record{};
+        record.deltaSeconds = frameDeltaSeconds;
+        session.ticks.push_back(record);
+        return frameDeltaSeconds;
+    }
+    if (session.tick >= session.ticks.size()) {
+        return frameDeltaSeconds;
+    }
+    InjectTickEvents(session);
+    return session.ticks[session.tick].deltaSeconds;
+}
+
+void EndInputTick(Vector2 mouseWorld, std::uint64_t worldHash) {
+    InputSession& session = g_session;
+    if (session.mode == InputSessionMode::Off || session.tick >= session.ticks.size()) {
+        return;
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - session.tickStart;
+    session.tickMilliseconds.push_back(std::chrono::duration<float, std::milli>(elapsed).count());
+
+    ReplayTick& record = session.ticks[session.tick];
+    if (session.mode == InputSessionMode::Recording) {
+        record.worldHash = worldHash;
+        record.mouseWorldX = mouseWorld.x;
+        record.mouseWorldY = mouseWorld.y;
+    } else if (record.worldHash != worldHash || record.mouseWorldX != mouseWorld.x || record.mouseWorldY != mouseWorld.y) {
+        if (session.divergentTicks == 0) {
+            session.firstDivergentTick = session.tick;
+            std::cerr << "[Replay] Estado divergiu no tick " << session.tick << " (hash gravado " << record.worldHash
+                      << ", atual " << worldHash << ")" << std::endl;
+        }
+        ++session.divergentTicks;
+    }
+    ++session.tick;
+}
+
+bool IsInputReplayFinished() {
+    return g_session.mode == InputSessionMode::Replaying && g_session.tick >= g_session.ticks.size();
+}
+
+void StopInputSession() {
+    InputSession& session = g_session;
+    if (session.mode == InputSessionMode::Recording) {
+        // Tick aberto sem EndInputTick (janela fechada no meio do quadro) não entra no arquivo.
+        session.ticks.resize(std::min<std::size_t>(session.ticks.size(), session.tick));
+        if (WriteSessionFile(session)) {
+            std::cerr << "[Replay] " << session.ticks.size() << " ticks e " << session.events.size()
+                      << " eventos gravados em " << session.path << std::endl;
+        } else {
+            std::cerr << "[Replay] Falha ao gravar " << session.path << std::endl;
+        }
+    }
+    if (session.mode != InputSessionMode::Off) {
+        PrintTickTimeSummary(session);
+    }
+    if (session.mode == InputSessionMode::Replaying) {
+        if (session.divergentTicks == 0) {
+            std::cerr << "[Replay] Estado identico ao gravado em todos os ticks" << std::endl;
+        } else {
+            std::cerr << "[Replay] " << session.divergentTicks << " ticks divergentes (primeiro: "
+                      << session.firstDivergentTick << ")" << std::endl;
+        }
+    }
+    g_session = InputSession{};
+}
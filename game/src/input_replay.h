@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "raylib.h"
+
+// Gravação e reprodução determinística de sessões (`--record <arquivo>` / `--replay <arquivo>`).
+// O arquivo guarda a seed da run, um registro por tick (delta, mouse no mundo, hash do estado do mundo) e os
+// eventos de input no formato AutomationEvent do raylib, só quando teclas/botões/mouse mudam. Na reprodução os
+// eventos são injetados com PlayAutomationEvent, então todo código que lê input do raylib (inclusive raygui) vê
+// exatamente o que foi gravado. Texto digitado no console de debug (GetCharPressed) não é gravado.
+
+enum class InputSessionMode {
+    Off,
+    Recording,
+    Replaying
+};
+
+// Começa a gravar a partir do próximo tick; worldSeed é a seed da primeira run.
+bool StartInputRecording(const std::string& path, std::uint64_t worldSeed);
+// Carrega a sessão; worldSeed recebe a seed gravada. Retorna false se o arquivo não existe ou é inválido.
+bool StartInputReplay(const std::string& path, std::uint64_t& worldSeed);
+InputSessionMode GetInputSessionMode();
+
+// Chamar no início do tick, antes de qualquer leitura de input. Gravando, registra as mudanças de input do tick;
+// reproduzindo, injeta os eventos gravados. Retorna o delta que o tick deve usar (o gravado, na reprodução).
+float BeginInputTick(float frameDeltaSeconds);
+// Chamar no fim do tick (antes de EndDrawing): grava ou confere mouse no mundo e hash do mundo e mede o tempo do tick.
+void EndInputTick(Vector2 mouseWorld, std::uint64_t worldHash);
+// True quando a reprodução já consumiu todos os ticks gravados.
+bool IsInputReplayFinished();
+// Gravando, escreve o arquivo; nos dois modos imprime o resumo de tempos por tick (e divergências na reprodução).
+void StopInputSession();
+
+// Injeção direta de input (mesmo caminho da reprodução), usada pelo bot de exploração. Chamar antes de
+// BeginInputTick para que uma gravação simultânea registre o input injetado.
+void InjectKeyState(int key, bool down);
+void InjectMouseButtonState(int button, bool down);
+void InjectMousePosition(Vector2 screenPosition);
+
+// Hash FNV-1a incremental do estado do mundo, usado para detectar divergência na reprodução.
+class WorldStateHasher {
+public:
+    void Add(const void* data, std::size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash_ = (hash_ ^ bytes[i]) * 1099511628211ULL;
+        }
+    }
+    void Add(std::uint64_t value) { Add(&value, sizeof(value)); }
+    void Add(int value) { Add(&value, sizeof(value)); }
+    void Add(float value) { Add(&value, sizeof(value)); }
+    void Add(Vector2 value) {
+        Add(value.x);
+        Add(value.y);
+    }
+
+    std::uint64_t Value() const { return hash_; }
+
+private:
+    std::uint64_t hash_{1469598103934665603ULL};
+};
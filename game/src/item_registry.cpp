@@ -0,0 +1,68 @@
+#include "item_registry.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace {
+
+const std::string kEmptyItemName{};
+
+// Contador compartilhado entre registros: um registro recriado (nova run, recarga de dados) nunca repete a geração de outro.
+std::uint32_t g_lastRegistryGeneration = 0;
+
+} // namespace
+
+void ItemRegistry::Clear() {
+    definitions_.clear();
+    indexById_.clear();
+    byName_.clear();
+    generation_ = ++g_lastRegistryGeneration;
+}
+
+const ItemDefinition* ItemRegistry::Add(ItemDefinition definition) {
+    const int id = definition.id;
+    if (id <= 0 || id > kMaxItemId) {
+        std::cerr << "[Items] Id de item fora da faixa suportada: " << id << std::endl;
+        return nullptr;
+    }
+
+    const std::size_t slot = static_cast<std::size_t>(id);
+    if (slot >= indexById_.size()) {
+        indexById_.resize(slot + 1, -1);
+    }
+
+    auto byNameLess = [this](std::int32_t lhs, std::string_view rhs) {
+        return std::string_view(definitions_[static_cast<std::size_t>(lhs)].name) < rhs;
+    };
+
+    std::int32_t index = indexById_[slot];
+    if (index >= 0) {
+        // Substituição: tira a posição antiga do índice de nomes antes de trocar o nome.
+        byName_.erase(std::find(byName_.begin(), byName_.end(), index));
+        definitions_[static_cast<std::size_t>(index)] = std::move(definition);
+    } else {
+        index = static_cast<std::int32_t>(definitions_.size());
+        definitions_.push_back(std::move(definition));
+        indexById_[slot] = index;
+    }
+
+    const std::string& name = definitions_[static_cast<std::size_t>(index)].name;
+    byName_.insert(std::lower_bound(byName_.begin(), byName_.end(), std::string_view(name), byNameLess), index);
+    generation_ = ++g_lastRegistryGeneration;
+    return &definitions_[static_cast<std::size_t>(index)];
+}
+
+int ItemRegistry::FindIdByName(std::string_view name) const {
+    auto it = std::lower_bound(byName_.begin(), byName_.end(), name, [this](std::int32_t lhs, std::string_view rhs) {
+        return std::string_view(definitions_[static_cast<std::size_t>(lhs)].name) < rhs;
+    });
+    if (it == byName_.end() || definitions_[static_cast<std::size_t>(*it)].name != name) {
+        return 0;
+    }
+    return definitions_[static_cast<std::size_t>(*it)].id;
+}
+
+const std::string& ItemRegistry::NameOf(int id) const {
+    const ItemDefinition* def = Find(id);
+    return def ? def->name : kEmptyItemName;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "raylib.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "player.h"
+
+struct PlayerCharacter;
+struct WeaponBlueprint;
+struct InventoryUIState;
+
+// Agrupa itens em categorias para filtros, regras de pilha e crafting.
+enum class ItemCategory {
+    None,
+    Weapon,
+    Armor,
+    Consumable,
+    Material,
+    Result
+};
+
+using ItemAbilityHandler = std::function<bool(InventoryUIState&, PlayerCharacter&, int)>;
+
+// Representa habilidade ativa vinculada a um item (ex.: poção ou artefato).
+struct ItemActiveAbility {
+    std::string name;
+    std::string description;
+    float cooldownSeconds{0.0f};
+    bool consumesItemOnUse{false};
+    ItemAbilityHandler handler{};
+
+    bool IsValid() const { return static_cast<bool>(handler); }
+};
+
+// Metadados de um item disponível no protótipo do inventário.
+struct ItemDefinition {
+    int id{0};
+    std::string name;
+    ItemCategory category{ItemCategory::None};
+    std::string description;
+    int rarity{1};
+    int baseValue{0};
+    int value{0};
+    const WeaponBlueprint* weaponBlueprint{nullptr};
+    PlayerAttributes attributeBonuses{};
+    std::string inventorySpritePath;
+    Vector2 inventorySpriteDrawSize{0.0f, 0.0f};
+    ItemActiveAbility activeAbility{};
+
+    bool HasActiveAbility() const { return activeAbility.IsValid(); }
+};
+
+// Conteúdo de um slot: só o id e a quantidade; nome e categoria vêm do registro de itens na hora de desenhar.
+struct ItemSlot {
+    int itemId{0};
+    int quantity{0};
+};
+
+// Registro das definições de item montado uma vez na inicialização.
+// Ids são inteiros pequenos, então a busca por id indexa uma tabela densa (O(1), sem varrer as definições).
+// Cada nome fica guardado só na própria definição; a busca por nome usa um índice ordenado sem cópias de string.
+class ItemRegistry {
+public:
+    // Maior id aceito pela tabela densa; ids acima disso são recusados com aviso.
+    static constexpr int kMaxItemId = 1 << 16;
+
+    // Remove todas as definições.
+    void Clear();
+
+    // Registra a definição (substituindo outra com o mesmo id) e devolve o registro armazenado, ou nullptr se o id é inválido.
+    // Ponteiros devolvidos continuam válidos até o próximo Add/Clear.
+    const ItemDefinition* Add(ItemDefinition definition);
+
+    // Definição pelo id (nullptr se inexistente).
+    const ItemDefinition* Find(int id) const {
+        if (id <= 0 || static_cast<std::size_t>(id) >= indexById_.size()) {
+            return nullptr;
+        }
+        std::int32_t index = indexById_[static_cast<std::size_t>(id)];
+        return (index >= 0) ? &definitions_[static_cast<std::size_t>(index)] : nullptr;
+    }
+
+    // Id do item com o nome exato informado (0 se inexistente).
+    int FindIdByName(std::string_view name) const;
+
+    // Nome do item por referência à definição; string vazia compartilhada se o id não existe.
+    const std::string& NameOf(int id) const;
+
+    // Definições na ordem de registro (usada para sorteios de loja/baú).
+    const std::vector<ItemDefinition>& Definitions() const { return definitions_; }
+
+    std::size_t Size() const { return definitions_.size(); }
+    bool Empty() const { return definitions_.empty(); }
+
+    // Muda a cada Add/Clear (única entre todos os registros); caches derivados (ex.: tabelas de loot) comparam para saber se precisam refazer.
+    std::uint32_t Generation() const { return generation_; }
+
+private:
+    std::vector<ItemDefinition> definitions_;
+    std::vector<std::int32_t> indexById_; // id -> posição em definitions_; -1 = id livre
+    std::vector<std::int32_t> byName_;    // Posições de definitions_ ordenadas por nome
+    std::uint32_t generation_{0};
+};
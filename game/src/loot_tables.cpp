@@ -0,0 +1,142 @@
+#include "loot_tables.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "game_data.h"
+
+namespace {
+
+constexpr float kLuckStepSize = 0.05f;   // Largura de cada faixa de sorte no cache
+constexpr int kMaxLuckStep = 40;         // Sorte acima de 2.0 é tratada como 2.0
+
+// Multiplicador da categoria numa lista de loot.txt; listas incompletas (dados não carregados) zeram o peso.
+double CategoryWeight(const std::vector<float>& weights, ItemCategory category) {
+    const std::size_t index = static_cast<std::size_t>(category);
+    return index < weights.size() ? static_cast<double>(weights[index]) : 0.0;
+}
+
+} // namespace
+
+void AliasTable::Build(const std::vector<double>& weights) {
+    threshold_.clear();
+    alias_.clear();
+    columnCount_ = 0;
+
+    double total = 0.0;
+    for (double weight : weights) {
+        total += std::max(0.0, weight);
+    }
+    const std::size_t count = weights.size();
+    if (count == 0 || total <= 0.0) {
+        return;
+    }
+
+    // Vose: normaliza para média 1 e emparelha colunas abaixo da média com colunas acima.
+    std::vector<double> scaled(count);
+    std::vector<std::uint32_t> small;
+    std::vector<std::uint32_t> large;
+    small.reserve(count);
+    large.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        scaled[i] = std::max(0.0, weights[i]) * static_cast<double>(count) / total;
+        (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+    }
+
+    constexpr double kScale = 4294967296.0; // 2^32
+    constexpr std::uint32_t kAlways = std::numeric_limits<std::uint32_t>::max();
+    threshold_.assign(count, kAlways);
+    alias_.resize(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        alias_[i] = static_cast<std::uint32_t>(i);
+    }
+
+    while (!small.empty() && !large.empty()) {
+        std::uint32_t low = small.back();
+        small.pop_back();
+        std::uint32_t high = large.back();
+
+        threshold_[low] = static_cast<std::uint32_t>(std::min(kScale - 1.0, scaled[low] * kScale));
+        alias_[low] = high;
+        scaled[high] -= 1.0 - scaled[low];
+        if (scaled[high] < 1.0) {
+            large.pop_back();
+            small.push_back(high);
+        }
+    }
+    // Sobras (erro de arredondamento) ficam com probabilidade cheia na própria coluna.
+    columnCount_ = count;
+}
+
+int LootTableSet::LuckStep(float luckBonus) {
+    if (!(luckBonus > 0.0f)) {
+        return 0;
+    }
+    return std::min(kMaxLuckStep, static_cast<int>(std::lround(luckBonus / kLuckStepSize)));
+}
+
+double LootTableSet::ItemWeight(const ItemDefinition& def, LootSource source, BiomeType biome, float luckBonus) {
+    if (def.id <= 0) {
+        return 0.0;
+    }
+    const LootWeights& loot = GetGameData().loot;
+    const int rarityLevels = static_cast<int>(loot.rarityWeights.size());
+    if (rarityLevels == 0) {
+        return 0.0;
+    }
+    // Raridades fora da faixa de rarityWeights usam o extremo mais próximo.
+    const int biomeIndex = std::clamp(static_cast<int>(biome), 0, kBiomeCount - 1);
+    const int rarityIndex = std::clamp(def.rarity, 1, rarityLevels) - 1;
+    const double luck = static_cast<double>(LuckStep(luckBonus)) * kLuckStepSize;
+
+    double weight = static_cast<double>(loot.rarityWeights[static_cast<std::size_t>(rarityIndex)]);
+    weight *= CategoryWeight(loot.biomeCategoryWeights[static_cast<std::size_t>(biomeIndex)], def.category);
+    weight *= CategoryWeight(loot.sourceCategoryWeights[static_cast<std::size_t>(source)], def.category);
+    weight *= 1.0 + luck * static_cast<double>(loot.luckPerRarity) * static_cast<double>(rarityIndex);
+    return weight;
+}
+
+void LootTableSet::Clear() {
+    for (std::deque<CachedTable>& bucket : tables_) {
+        bucket.clear();
+    }
+    hasGeneration_ = false;
+}
+
+const LootTable& LootTableSet::Get(const ItemRegistry& items, LootSource source, BiomeType biome, float luckBonus) {
+    // Pesos de loot.txt podem mudar sem o registro de itens mudar (hot reload), então a versão dos dados também é chave.
+    const std::uint32_t dataVersion = GetGameDataVersion();
+    if (!hasGeneration_ || registryGeneration_ != items.Generation() || dataVersion_ != dataVersion) {
+        Clear();
+        registryGeneration_ = items.Generation();
+        dataVersion_ = dataVersion;
+        hasGeneration_ = true;
+    }
+
+    const int biomeIndex = std::clamp(static_cast<int>(biome), 0, kBiomeCount - 1);
+    const int luckStep = LuckStep(luckBonus);
+    std::deque<CachedTable>& bucket = tables_[static_cast<std::size_t>(static_cast<int>(source) * kBiomeCount + biomeIndex)];
+    for (const CachedTable& cached : bucket) {
+        if (cached.luckStep == luckStep) {
+            return cached.table;
+        }
+    }
+
+    CachedTable compiled{};
+    compiled.luckStep = luckStep;
+    std::vector<double> weights;
+    weights.reserve(items.Size());
+    compiled.table.entries.reserve(items.Size());
+    for (const ItemDefinition& def : items.Definitions()) {
+        double weight = ItemWeight(def, source, static_cast<BiomeType>(biomeIndex), luckBonus);
+        if (weight <= 0.0) {
+            continue;
+        }
+        compiled.table.entries.push_back(LootEntry{def.id, weight});
+        weights.push_back(weight);
+    }
+    compiled.table.alias.Build(weights);
+    bucket.push_back(std::move(compiled));
+    return bucket.back().table;
+}
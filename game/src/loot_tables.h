@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "item_registry.h"
+#include "room_types.h"
+
+// Tabela de Walker/Vose: sorteia um índice com pesos arbitrários em O(1) (uma coluna + um teste de limiar).
+// A construção é O(n) e só acontece quando a tabela de loot é compilada.
+class AliasTable {
+public:
+    // Recebe pesos não negativos; pesos todos zero resultam em tabela vazia.
+    void Build(const std::vector<double>& weights);
+
+    // Recebe 64 bits aleatórios: os 32 altos escolhem a coluna, os 32 baixos decidem entre ela e o alias.
+    // Usa só aritmética inteira, então a mesma seed gera a mesma sequência em qualquer plataforma.
+    std::size_t Sample(std::uint64_t randomBits) const {
+        const std::size_t column = static_cast<std::size_t>(((randomBits >> 32) * columnCount_) >> 32);
+        const std::uint32_t coin = static_cast<std::uint32_t>(randomBits);
+        return (coin < threshold_[column]) ? column : static_cast<std::size_t>(alias_[column]);
+    }
+
+    std::size_t Size() const { return threshold_.size(); }
+    bool Empty() const { return threshold_.empty(); }
+
+private:
+    std::vector<std::uint32_t> threshold_; // Probabilidade de ficar na própria coluna, em escala 2^32
+    std::vector<std::uint32_t> alias_;
+    std::uint64_t columnCount_{0};
+};
+
+// Origem do sorteio; cada uma tem filtros próprios sobre as definições de item.
+enum class LootSource {
+    Chest,
+    Shop
+};
+
+constexpr int kLootSourceCount = static_cast<int>(LootSource::Shop) + 1;
+
+// Entrada compilada de uma tabela de loot.
+struct LootEntry {
+    int itemId{0};
+    double weight{0.0};
+};
+
+// Tabela de loot pronta para sorteio.
+struct LootTable {
+    std::vector<LootEntry> entries;
+    AliasTable alias;
+
+    bool Empty() const { return alias.Empty(); }
+
+    // Recebe 64 bits aleatórios e devolve o id sorteado (0 se a tabela está vazia).
+    int Sample(std::uint64_t randomBits) const {
+        return alias.Empty() ? 0 : entries[alias.Sample(randomBits)].itemId;
+    }
+};
+
+// Tabelas de loot por origem, bioma e faixa de sorte, compiladas sob demanda a partir do registro de itens.
+// O peso de cada item vem da raridade (itens raros pesam menos), do multiplicador da categoria no bioma
+// e do luckBonus do jogador, que desloca o peso para raridades altas; os pesos vêm de assets/data/loot.txt.
+// A sorte é quantizada em faixas, então cada combinação é compilada uma vez e reaproveitada até o registro
+// de itens ou os dados de jogo (GetGameDataVersion) mudarem.
+class LootTableSet {
+public:
+    static constexpr int kBiomeCount = static_cast<int>(BiomeType::Unknown) + 1;
+
+    // Recebe a origem, o bioma e a sorte atual do jogador; devolve a tabela compilada correspondente.
+    const LootTable& Get(const ItemRegistry& items, LootSource source, BiomeType biome, float luckBonus);
+
+    // Peso teórico do item na tabela (usado pelo benchmark para validar a distribuição).
+    static double ItemWeight(const ItemDefinition& def, LootSource source, BiomeType biome, float luckBonus);
+
+    // Quantiza a sorte na faixa usada como chave do cache.
+    static int LuckStep(float luckBonus);
+
+    // Descarta todas as tabelas compiladas.
+    void Clear();
+
+private:
+    struct CachedTable {
+        int luckStep{-1};
+        LootTable table;
+    };
+
+    std::uint32_t registryGeneration_{0};
+    std::uint32_t dataVersion_{0};
+    bool hasGeneration_{false};
+    std::array<std::deque<CachedTable>, kLootSourceCount * kBiomeCount> tables_{}; // deque: referências devolvidas por Get continuam válidas
+};
@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <cmath>
 #include <cctype>
+#include <cstdlib>
 #include <cstring>
 #include <optional>
 #include <limits>
@@ -24,14 +25,25 @@
 #include "projectile.h"
 #include "player.h"
 #include "weapon.h"
-#include "weapon_blueprints.h"
+#include "game_data.h"
 #include "raygui.h"
 #include "ui_inventory.h"
 #include "font_manager.h"
 #include "chest.h"
+#include "damage_numbers.h"
 #include "hud.h"
 #include "enemy_spawner.h"
 #include "enemy_common.h"
+#include "alloc_stats.h"
+#include "game_random.h"
+#include "input_replay.h"
+#include "explore_bot.h"
+#include "sprite_batch.h"
+#include "texture_manager.h"
+#include "asset_archive.h"
+#include "render_queue.h"
+#include "render_stats.h"
+#include "profiler.h"
 
 namespace {
 
@@ -62,16 +74,6 @@ struct CharacterSpriteResources {
     int currentFrame{0};
 };
 
-// Dados temporários de um pop-up de dano desenhado na tela.
-struct DamageNumber {
-    Vector2 position{};
-    float amount{0.0f};
-    bool isCritical{false};
-    bool isReward{false};
-    float age{0.0f};
-    float lifetime{1.0f};
-};
-
 // Informações pré-calculadas para desenhar uma porta específica na cena.
 struct DoorRenderData {
     Doorway* doorway{nullptr};
@@ -84,7 +86,6 @@ struct DoorRenderData {
     bool isLocked{false};
     Vector2 promptAnchor{};
     BiomeType biome{BiomeType::Unknown};
-    bool drawAfterPlayer{false};
     bool fromActiveRoom{false};
     bool drawAboveMask{false};
 };
@@ -111,77 +112,6 @@ constexpr float HORIZONTAL_CORRIDOR_MASK_VERTICAL_OFFSET = static_cast<float>(TI
 // Offset aplicado ao boneco de treinamento em relação ao centro da sala inicial.
 const Vector2 kTrainingDummyOffset{TILE_SIZE * 2.5f, 0.0f};
 
-// Atualiza timers, move números de dano para cima e remove entradas cujo tempo expirou.
-void UpdateDamageNumbers(std::vector<DamageNumber>& numbers, float deltaSeconds) {
-    for (auto& number : numbers) {
-        number.age += deltaSeconds;
-        number.position.y -= 26.0f * deltaSeconds;
-    }
-
-    numbers.erase(
-        std::remove_if(numbers.begin(), numbers.end(), [](const DamageNumber& number) {
-            return number.age >= number.lifetime;
-        }),
-        numbers.end());
-}
-
-// Renderiza todos os números de dano ativos com fade out e indicador crítico.
-void DrawDamageNumbers(const std::vector<DamageNumber>& numbers) {
-    if (numbers.empty()) {
-        return;
-    }
-
-    const Font& font = GetGameFont();
-
-    for (const auto& number : numbers) {
-        float alpha = 1.0f - (number.age / number.lifetime);
-        if (alpha <= 0.0f) {
-            continue;
-        }
-
-        int displayValue = static_cast<int>(std::lround(number.amount));
-        if (displayValue < 0) {
-            displayValue = 0;
-        }
-
-        std::string text;
-        if (number.isReward) {
-            text = "+" + std::to_string(displayValue);
-        } else {
-            text = std::to_string(displayValue);
-            if (number.isCritical) {
-                text.push_back('!');
-            }
-        }
-
-        const float fontSize = number.isCritical ? 30.0f : 24.0f;
-        Color baseColor = number.isReward
-            ? Color{255, 227, 96, 255}
-            : (number.isCritical ? Color{255, 120, 120, 255} : Color{235, 235, 240, 255});
-        baseColor.a = static_cast<unsigned char>(std::clamp(alpha, 0.0f, 1.0f) * 255.0f);
-
-        Vector2 measure = MeasureTextEx(font, text.c_str(), fontSize, 0.0f);
-        Vector2 drawPos{number.position.x - measure.x * 0.5f, number.position.y - measure.y};
-        DrawTextEx(font, text.c_str(), drawPos, fontSize, 0.0f, baseColor);
-    }
-}
-
-// Cria uma nova entrada de número de dano com valores padrão e adiciona à lista.
-void PushDamageNumber(std::vector<DamageNumber>& numbers,
-                      const Vector2& position,
-                      float amount,
-                      bool isCritical,
-                      float lifetime = 1.0f,
-                      bool isReward = false) {
-    DamageNumber number{};
-    number.amount = amount;
-    number.isCritical = isCritical;
-    number.isReward = isReward;
-    number.lifetime = lifetime;
-    number.position = position;
-    numbers.push_back(number);
-}
-
 // Recupera a forja rastreada pelo inventário (se existir na sala atual).
 ForgeInstance* ResolveTrackedForge(RoomManager& manager, const InventoryUIState& uiState) {
     if (!uiState.hasActiveForge) {
@@ -228,9 +158,6 @@ void SaveActiveStations(InventoryUIState& uiState, RoomManager& manager) {
 
 // Decrementa cooldowns das habilidades de equipamentos conforme o delta de tempo.
 void UpdateEquipmentAbilityCooldowns(InventoryUIState& state, float deltaSeconds) {
-    if (state.equipmentAbilityCooldowns.empty()) {
-        return;
-    }
     for (float& timer : state.equipmentAbilityCooldowns) {
         if (timer > 0.0f) {
             timer = std::max(0.0f, timer - deltaSeconds);
@@ -243,9 +170,6 @@ bool TryActivateEquipmentAbility(InventoryUIState& state, PlayerCharacter& playe
     if (slotIndex < 0 || slotIndex >= static_cast<int>(state.equipmentSlotIds.size())) {
         return false;
     }
-    if (slotIndex >= static_cast<int>(state.equipmentAbilityCooldowns.size())) {
-        return false;
-    }
     int itemId = state.equipmentSlotIds[slotIndex];
     if (itemId <= 0) {
         return false;
@@ -498,17 +422,9 @@ std::string TrimCommand(const std::string& text) {
     return text.substr(start, end - start);
 }
 
-// Procura um item definido na lista de definições com base no ID.
+// Procura um item definido no registro com base no ID.
 const ItemDefinition* FindDebugItemDefinitionById(const InventoryUIState& state, int itemId) {
-    if (itemId <= 0) {
-        return nullptr;
-    }
-    for (const ItemDefinition& def : state.items) {
-        if (def.id == itemId) {
-            return &def;
-        }
-    }
-    return nullptr;
+    return state.items.Find(itemId);
 }
 
 // Zera o buffer de entrada do console para evitar caracteres residuais.
@@ -535,10 +451,7 @@ void ResetDebugInventoryContext(DebugConsoleState& state, InventoryUIState& inve
         inventory.chestSupportsTakeAll = false;
         inventory.selectedChestIndex = -1;
         inventory.chestTitle.clear();
-        inventory.chestItemIds.clear();
-        inventory.chestItems.clear();
-        inventory.chestQuantities.clear();
-        inventory.chestTypes.clear();
+        inventory.chestSlotCount = 0;
     } else if (state.inventoryContext == Context::Forge) {
         inventory.selectedForgeSlot = -1;
         inventory.pendingForgeBreak = false;
@@ -588,7 +501,7 @@ void ActivateDebugShopContext(DebugConsoleState& state, InventoryUIState& invent
     state.inventoryContext = DebugConsoleState::InventoryContext::Shop;
     state.shopInstance = std::make_unique<ShopInstance>();
     state.shopInstance->items.clear();
-    state.shopInstance->baseSeed = static_cast<std::uint64_t>(GetRandomValue(0, std::numeric_limits<int>::max()));
+    state.shopInstance->baseSeed = GameRandom(RandomStreamId::Loot)();
     state.shopInstance->rerollCount = 0;
     ResetShopTradeState(inventory);
     inventory.mode = InventoryViewMode::Shop;
@@ -642,7 +555,7 @@ bool ExecuteDebugCommand(const std::string& rawCommand,
             0.0f,
             Rectangle{0.0f, 0.0f, 0.0f, 0.0f},
             8,
-            static_cast<std::uint64_t>(GetRandomValue(0, std::numeric_limits<int>::max())));
+            GameRandom(RandomStreamId::Loot)());
         return ActivateDebugChestContext(state, inventory, manager, std::move(chest));
     }
 
@@ -668,6 +581,27 @@ bool ExecuteDebugCommand(const std::string& rawCommand,
         }
     }
 
+    if (command == "hud.redraws") {
+        ToggleHudRedrawDebug();
+        return true;
+    }
+
+#if defined(GAME_PROFILER)
+    if (command == "profiler.toggle") {
+        ToggleProfilerOverlay();
+        return true;
+    }
+
+    if (command == "profiler.csv.start") {
+        return StartRenderStatsCsv("render_stats.csv");
+    }
+
+    if (command == "profiler.csv.stop") {
+        StopRenderStatsCsv();
+        return true;
+    }
+#endif
+
     constexpr const char* kHealthPrefix = "player.currentHealth.set";
     if (command.rfind(kHealthPrefix, 0) == 0) {
         std::string valueText = TrimCommand(command.substr(std::strlen(kHealthPrefix)));
@@ -704,8 +638,8 @@ void DrawDebugConsoleOverlay(DebugConsoleState& state) {
     DrawRectangleRec(panel, Color{22, 28, 40, 235});
     DrawRectangleLinesEx(panel, 2.0f, Color{200, 210, 230, 255});
 
-    const Font& font = GetGameFont();
     constexpr float kTitleFontSize = 28.0f;
+    const Font& font = GetGameFont(kTitleFontSize);
     const char* title = "Debug tool";
     Vector2 titleSize = MeasureTextEx(font, title, kTitleFontSize, 0.0f);
     Vector2 titlePos{panel.x + (panel.width - titleSize.x) * 0.5f, panel.y + 24.0f};
@@ -729,18 +663,26 @@ void FlushTextInputBuffer() {
     }
 }
 
-// Tenta carregar uma textura caso o arquivo exista; caso contrário emite log e retorna vazio.
+// Carrega a textura do assets.pak (quando aberto) ou do arquivo solto; sem nenhum dos dois emite log e retorna vazio.
+// Síncrono de propósito: o clip de animação precisa das dimensões da textura logo após o carregamento.
 Texture2D LoadTextureIfExists(const std::string& path) {
     if (path.empty()) {
         return Texture2D{};
     }
 
-    if (!FileExists(path.c_str())) {
+    Texture2D texture{};
+    AssetBlob packed{};
+    if (FindPackedAsset(path, packed)) {
+        Image image = LoadImageFromMemory(GetFileExtension(path.c_str()), packed.data, static_cast<int>(packed.size));
+        texture = LoadTextureFromImage(image);
+        UnloadImage(image);
+    } else if (FileExists(path.c_str())) {
+        texture = LoadTexture(path.c_str());
+    } else {
         std::cerr << "[Character] Sprite nao encontrado: " << path << std::endl;
         return Texture2D{};
     }
 
-    Texture2D texture = LoadTexture(path.c_str());
     if (texture.id != 0) {
         SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
     }
@@ -870,26 +812,82 @@ bool DrawCharacterSprite(const CharacterSpriteResources& resources,
     return true;
 }
 
+// Textura que DrawCharacterSprite usará no quadro (chave de lote na fila de renderização).
+unsigned int CharacterSpriteTextureId(const CharacterSpriteResources& resources, bool isMoving) {
+    if (isMoving && resources.walking.id != 0 && resources.frameCount > 0) {
+        return resources.walking.id;
+    }
+    return resources.idle.id;
+}
+
+// Callbacks da fila de renderização; object/context apontam para dados vivos durante o quadro.
+void DrawQueuedPlayer(const RenderCommand& command) {
+    const auto& sprites = *static_cast<const CharacterSpriteResources*>(command.object);
+    Vector2 position{command.params[0], command.params[1]};
+    if (!DrawCharacterSprite(sprites, position, command.params[2] != 0.0f)) {
+        // Fallback simples caso sprites não estejam disponíveis.
+        Rectangle renderRect{
+            position.x - PLAYER_RENDER_HALF_WIDTH,
+            position.y - PLAYER_RENDER_HALF_HEIGHT,
+            PLAYER_RENDER_HALF_WIDTH * 2.0f,
+            PLAYER_RENDER_HALF_HEIGHT * 2.0f
+        };
+        DrawRectangleRec(renderRect, Color{120, 180, 220, 255});
+        DrawRectangleLinesEx(renderRect, 2.0f, Color{30, 60, 90, 255});
+    }
+}
+
+// Lote reaproveitado entre quadros para sprites/barras de vida de inimigos adjacentes na fila.
+SpriteBatch g_enemySpriteBatch;
+
+void DrawQueuedEnemies(const RenderCommand* const* commands, std::size_t count) {
+    RenderStatsScope statsScope(RenderSubsystem::Enemies);
+    AllocScope allocScope(AllocTag::Enemies);
+    for (std::size_t i = 0; i < count; ++i) {
+        const RenderCommand& command = *commands[i];
+        EnemyDrawContext drawContext{};
+        drawContext.roomVisibility = command.params[0];
+        drawContext.isActiveRoom = (command.params[1] != 0.0f);
+        const Enemy& enemy = *static_cast<const Enemy*>(command.object);
+        if (!enemy.AppendToBatch(g_enemySpriteBatch, drawContext)) {
+            g_enemySpriteBatch.Flush();
+            enemy.Draw(drawContext);
+        }
+    }
+    g_enemySpriteBatch.Flush();
+}
+
+void DrawQueuedDoor(const RenderCommand& command) {
+    const auto& renderer = *static_cast<const RoomRenderer*>(command.context);
+    const auto& doorData = *static_cast<const DoorRenderData*>(command.object);
+    renderer.DrawDoorSprite(doorData.hitbox, doorData.doorway->direction, doorData.biome, doorData.alpha);
+}
+
+void DrawQueuedForge(const RenderCommand& command) {
+    static_cast<const RoomRenderer*>(command.context)->DrawForgeInstance(*static_cast<const ForgeInstance*>(command.object), true);
+}
+
+void DrawQueuedShop(const RenderCommand& command) {
+    static_cast<const RoomRenderer*>(command.context)->DrawShopInstance(*static_cast<const ShopInstance*>(command.object), true);
+}
+
+void DrawQueuedChest(const RenderCommand& command) {
+    static_cast<const RoomRenderer*>(command.context)->DrawChestInstance(*static_cast<const Chest*>(command.object), true);
+}
+
 // Soma todos os bônus passivos fornecidos pelas armas equipadas.
 PlayerAttributes GatherWeaponPassiveBonuses(const WeaponState& leftWeapon,
                                             const WeaponState& rightWeapon) {
     PlayerAttributes totals{};
     if (leftWeapon.blueprint != nullptr) {
-        totals = AddAttributes(totals, leftWeapon.blueprint->passiveBonuses);
+        AddAttributesInPlace(totals, leftWeapon.blueprint->passiveBonuses);
     }
     if (rightWeapon.blueprint != nullptr) {
-        totals = AddAttributes(totals, rightWeapon.blueprint->passiveBonuses);
+        AddAttributesInPlace(totals, rightWeapon.blueprint->passiveBonuses);
     }
     return totals;
 }
 
-// Reaplica os bônus das armas ao jogador e recalcula os atributos derivados.
-void RefreshPlayerWeaponBonuses(PlayerCharacter& player,
-                                const WeaponState& leftWeapon,
-                                const WeaponState& rightWeapon) {
-    player.weaponBonuses = GatherWeaponPassiveBonuses(leftWeapon, rightWeapon);
-    player.RecalculateStats();
-}
 
 // Garante que o WeaponState esteja alinhado com o item alocado no slot de armas da UI.
 bool SyncWeaponStateFromSlot(const InventoryUIState& inventoryUI,
@@ -921,6 +919,23 @@ bool SyncEquippedWeapons(const InventoryUIState& inventoryUI,
     return changed;
 }
 
+// Pipeline de stats do quadro: só reagrega equipamento/armas cujos slots mudaram de versão,
+// só recalcula o jogador se algum bloco de modificadores mudou e só refaz a arma se o jogador ou o blueprint mudou.
+void UpdatePlayerStats(const InventoryUIState& inventoryUI,
+                       PlayerCharacter& player,
+                       WeaponState& leftWeapon,
+                       WeaponState& rightWeapon) {
+    SyncEquipmentBonuses(inventoryUI, player);
+    if (!player.HasModifiersFrom(StatModifierSource::Weapons, inventoryUI.weaponSlotVersion)) {
+        SyncEquippedWeapons(inventoryUI, leftWeapon, rightWeapon);
+        player.SetModifiers(StatModifierSource::Weapons, GatherWeaponPassiveBonuses(leftWeapon, rightWeapon),
+                            inventoryUI.weaponSlotVersion);
+    }
+    player.RefreshStats();
+    leftWeapon.RefreshDerivedStats(player);
+    rightWeapon.RefreshDerivedStats(player);
+}
+
 // Entidade usada em sala inicial para testes de dano/mecânicas.
 struct TrainingDummy {
     Vector2 position{};
@@ -940,6 +955,31 @@ std::uint64_t GenerateWorldSeed() {
     return seed;
 }
 
+// Valor que segue `name` na linha de comando (ex.: `--seed 42`); nullptr quando ausente.
+const char* FindArgumentValue(int argc, char** argv, const char* name) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], name) == 0) {
+            return argv[i + 1];
+        }
+    }
+    return nullptr;
+}
+
+// Lê `--seed <n>` da linha de comando (decimal ou 0x hex); std::nullopt quando ausente ou inválido.
+std::optional<std::uint64_t> ParseSeedArgument(int argc, char** argv) {
+    const char* text = FindArgumentValue(argc, argv, "--seed");
+    if (text == nullptr) {
+        return std::nullopt;
+    }
+    char* end = nullptr;
+    const unsigned long long value = std::strtoull(text, &end, 0);
+    if (end == text || *end != '\0') {
+        std::cerr << "[Run] seed invalida: " << text << std::endl;
+        return std::nullopt;
+    }
+    return static_cast<std::uint64_t>(value);
+}
+
 // Converte coordenadas em tiles para coordenadas em pixels (tamanho padrão do tile).
 float TileToPixel(int tile) {
     return static_cast<float>(tile * TILE_SIZE);
@@ -1411,22 +1451,56 @@ bool ShouldTransitionThroughDoor(const Doorway& door, const Vector2& position, c
 } // namespace
 
 // Loop principal do jogo: inicializa Raylib, controla estados das salas, jogador e UI.
-int main() {
-    SetConfigFlags(FLAG_WINDOW_UNDECORATED | FLAG_WINDOW_TOPMOST | FLAG_VSYNC_HINT);
+// Argumento opcional `--seed <n>` fixa a seed da primeira run (decimal ou 0x hex).
+int main(int argc, char** argv) {
+    // `--bot <salas>`: teste de resistência com o bot de exploração (ignorado junto com `--replay`).
+    int botRooms = 0;
+    if (const char* botArgument = FindArgumentValue(argc, argv, "--bot")) {
+        if (FindArgumentValue(argc, argv, "--replay") == nullptr) {
+            botRooms = std::max(0, std::atoi(botArgument));
+        }
+    }
+    const bool botMode = botRooms > 0;
+    // O bot roda com janela oculta e sem limite de FPS; a simulação usa delta fixo.
+    SetConfigFlags(botMode ? FLAG_WINDOW_HIDDEN : (FLAG_WINDOW_UNDECORATED | FLAG_WINDOW_TOPMOST | FLAG_VSYNC_HINT));
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Prototype - Room Generation");
     const int monitorIndex = GetCurrentMonitor();
     const Vector2 monitorPosition = GetMonitorPosition(monitorIndex);
     SetWindowPosition(static_cast<int>(monitorPosition.x), static_cast<int>(monitorPosition.y));
-    SetTargetFPS(60);
+    SetTargetFPS(botMode ? 0 : 60);
+    // Usa assets.pak quando presente (gerado por `make assets_pak`); caso contrário lê os arquivos soltos.
+    OpenAssetArchive("assets.pak");
+    // Armas, itens e inimigos vêm de assets/data (ou de game_data.cache quando os arquivos não mudaram).
+    // Sem dados completos não há armas nem itens para jogar: aborta em vez de abrir um mundo vazio.
+    if (!LoadGameData("assets/data")) {
+        std::cerr << "[Data] Erro fatal: dados de jogo ausentes ou invalidos em assets/data" << std::endl;
+        CloseWindow();
+        return 1;
+    }
     LoadGameFont("assets/font/alagard.ttf", 32);
+    InitTextureManager();
 
-    std::uint64_t worldSeed = GenerateWorldSeed();
+    std::uint64_t worldSeed = 0;
+    if (std::optional<std::uint64_t> seedArgument = ParseSeedArgument(argc, argv)) {
+        worldSeed = *seedArgument;
+    } else {
+        worldSeed = GenerateWorldSeed();
+    }
+    // `--replay` usa a seed gravada no arquivo; `--record` grava a seed escolhida acima.
+    if (const char* replayPath = FindArgumentValue(argc, argv, "--replay")) {
+        StartInputReplay(replayPath, worldSeed);
+    } else if (const char* recordPath = FindArgumentValue(argc, argv, "--record")) {
+        StartInputRecording(recordPath, worldSeed);
+    }
+    ExploreBot exploreBot;
+    if (botMode) {
+        exploreBot.Start(botRooms, worldSeed, "soak_stats.csv");
+    }
     RoomManager roomManager{worldSeed};
     RoomRenderer roomRenderer;
     ProjectileSystem projectileSystem;
     ProjectileSystem enemyProjectileSystem;
     EnemySpawner enemySpawner;
-    std::mt19937 enemyRng(static_cast<std::mt19937::result_type>(worldSeed));
     using EnemyList = std::vector<std::unique_ptr<Enemy>>;
     std::unordered_map<RoomCoords, EnemyList, RoomCoordsHash> roomEnemies;
     std::unordered_set<RoomCoords, RoomCoordsHash> roomsWithSpawnedEnemies;
@@ -1444,11 +1518,13 @@ int main() {
     trainingDummy.radius = 52.0f;
 
 
-    std::vector<DamageNumber> damageNumbers;
+    DamageNumberPool damageNumbers;
     std::vector<DoorRenderData> doorRenderData;
     doorRenderData.reserve(8);
     std::vector<DoorMaskData> doorMaskData;
     doorMaskData.reserve(16);
+    // Reaproveitada entre quadros para não realocar os buffers de ordenação.
+    RenderQueue renderQueue;
     std::unordered_map<RoomCoords, RoomRevealState, RoomCoordsHash> roomRevealStates;
 
     // Garante que a lista de inimigos para a sala indicada já foi gerada/spawnada.
@@ -1457,8 +1533,9 @@ int main() {
         if (roomsWithSpawnedEnemies.count(coords) > 0) {
             return;
         }
+        AllocScope allocScope(AllocTag::Enemies);
         EnemyList& storage = roomEnemies[coords];
-        enemySpawner.SpawnEnemiesForRoom(room, storage, enemyRng);
+        enemySpawner.SpawnEnemiesForRoom(room, storage, GameRandom(RandomStreamId::Enemies));
         roomsWithSpawnedEnemies.insert(coords);
     };
 
@@ -1473,19 +1550,31 @@ int main() {
     // Reseta completamente o estado da run, com opção de gerar nova seed procedural.
     auto BeginNewRun = [&](bool regenerateSeed) {
         if (regenerateSeed) {
-            worldSeed = GenerateWorldSeed();
+            // Gravando/reproduzindo, a próxima seed deriva da anterior para a reprodução seguir a mesma sequência.
+            worldSeed = GetInputSessionMode() == InputSessionMode::Off ? GenerateWorldSeed() : MixSeed(worldSeed);
         }
 
         roomManager = RoomManager{worldSeed};
-        enemyRng.seed(static_cast<std::mt19937::result_type>(worldSeed));
+        // Todo sorteio da run sai de streams derivados desta seed; com ela (--seed) a run se repete.
+        SeedGameRandom(worldSeed);
+        projectileSystem.SeedRandom(GameRandom(RandomStreamId::Combat)());
+        enemyProjectileSystem.SeedRandom(GameRandom(RandomStreamId::Combat)());
+        std::cerr << "[Run] seed " << worldSeed << std::endl;
         roomEnemies.clear();
         roomsWithSpawnedEnemies.clear();
         roomRevealStates.clear();
-        damageNumbers.clear();
+        damageNumbers.Clear();
         projectileSystem.Clear();
         enemyProjectileSystem.Clear();
 
+        // O registro de itens e as receitas sobrevivem entre runs; só são remontados quando os dados mudam.
+        ItemRegistry itemRegistry = std::move(inventoryUI.items);
+        ForgeRecipeBook forgeRecipes = std::move(inventoryUI.forgeRecipes);
+        const std::uint32_t itemDataVersion = inventoryUI.gameDataVersion;
         inventoryUI = InventoryUIState{};
+        inventoryUI.items = std::move(itemRegistry);
+        inventoryUI.forgeRecipes = std::move(forgeRecipes);
+        inventoryUI.gameDataVersion = itemDataVersion;
         InitializeInventoryUIDummyData(inventoryUI);
         inventoryUI.open = false;
         inventoryUI.mode = InventoryViewMode::Inventory;
@@ -1510,11 +1599,7 @@ int main() {
         player = CreateKnightCharacter();
         leftHandWeapon = WeaponState{};
         rightHandWeapon = WeaponState{};
-        SyncEquipmentBonuses(inventoryUI, player);
-        SyncEquippedWeapons(inventoryUI, leftHandWeapon, rightHandWeapon);
-        RefreshPlayerWeaponBonuses(player, leftHandWeapon, rightHandWeapon);
-        leftHandWeapon.RecalculateDerivedStats(player);
-        rightHandWeapon.RecalculateDerivedStats(player);
+        UpdatePlayerStats(inventoryUI, player, leftHandWeapon, rightHandWeapon);
 
         roomManager.EnsureNeighborsGenerated(roomManager.GetCurrentCoords());
         playerPosition = RoomCenter(roomManager.GetCurrentRoom().Layout());
@@ -1538,10 +1623,53 @@ int main() {
         debugConsole.chestInstance.reset();
     };
 
+    // Contadores do mundo amostrados pelo bot de exploração (crescimento ao longo da sessão).
+    auto collectSoakSample = [&]() {
+        SoakSample sample{};
+        sample.storedRooms = roomManager.Rooms().size();
+        sample.enemyRoomLists = roomEnemies.size();
+        for (const auto& enemyEntry : roomEnemies) {
+            sample.enemies += enemyEntry.second.size();
+        }
+        sample.revealStates = roomRevealStates.size();
+        sample.playerProjectiles = projectileSystem.ActiveCount();
+        sample.enemyProjectiles = enemyProjectileSystem.ActiveCount();
+        return sample;
+    };
+
     BeginNewRun(false);
 
-    while (!WindowShouldClose()) {
-        const float delta = GetFrameTime();
+    while (!WindowShouldClose() && !IsInputReplayFinished() && !exploreBot.IsFinished()) {
+        float frameDelta = GetFrameTime();
+        if (exploreBot.IsActive()) {
+            // O bot decide com o estado do fim do tick anterior e injeta o input antes de qualquer leitura.
+            ExploreBotView botView{};
+            botView.playerPosition = playerPosition;
+            botView.camera = camera;
+            botView.room = &roomManager.GetCurrentRoom();
+            botView.rooms = &roomManager;
+            auto botEnemies = roomEnemies.find(roomManager.GetCurrentCoords());
+            botView.enemies = botEnemies != roomEnemies.end() ? &botEnemies->second : nullptr;
+            botView.inventoryOpen = inventoryUI.open;
+            botView.chestOpen = inventoryUI.open && inventoryUI.hasActiveChest;
+            exploreBot.Tick(botView, ExploreBot::kFixedDeltaSeconds);
+            frameDelta = ExploreBot::kFixedDeltaSeconds;
+        }
+        // Gravando, registra o input do tick; reproduzindo, injeta o input gravado e usa o delta gravado.
+        const float delta = BeginInputTick(frameDelta);
+        // HOT_RELOAD=TRUE: arquivos de dados salvos trocam os blueprints sem reiniciar
+        // (desligado durante gravação/reprodução, que dependem dos dados não mudarem no meio da sessão).
+        // Projéteis vivos apontam para blueprints que a recarga vai sobrescrever: são descartados antes da troca.
+        auto clearLiveProjectiles = [&]() {
+            projectileSystem.Clear();
+            enemyProjectileSystem.Clear();
+        };
+        if (GetInputSessionMode() == InputSessionMode::Off && PollGameDataHotReload(clearLiveProjectiles)) {
+            enemySpawner.Reload();
+            ReloadItemDefinitions(inventoryUI);
+            // Blueprints mudaram no lugar (mesmo ponteiro): força o recálculo das stats das armas.
+            player.statsDirty = true;
+        }
         UpdateEquipmentAbilityCooldowns(inventoryUI, delta);
 
         bool shiftHeld = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
@@ -1584,25 +1712,11 @@ int main() {
             }
         }
 
-        SyncEquipmentBonuses(inventoryUI, player);
-
-        if (SyncEquippedWeapons(inventoryUI, leftHandWeapon, rightHandWeapon)) {
-            RefreshPlayerWeaponBonuses(player, leftHandWeapon, rightHandWeapon);
-        }
+        UpdatePlayerStats(inventoryUI, player, leftHandWeapon, rightHandWeapon);
 
         leftHandWeapon.Update(delta);
         rightHandWeapon.Update(delta);
 
-        leftHandWeapon.RecalculateDerivedStats(player);
-        rightHandWeapon.RecalculateDerivedStats(player);
-
-        if (!inventoryUI.weaponSlots.empty()) {
-            inventoryUI.weaponSlots[0] = leftHandWeapon.blueprint ? leftHandWeapon.blueprint->name : "--";
-        }
-        if (inventoryUI.weaponSlots.size() >= 2) {
-            inventoryUI.weaponSlots[1] = rightHandWeapon.blueprint ? rightHandWeapon.blueprint->name : "--";
-        }
-
         Vector2 input{0.0f, 0.0f};
         if (!inventoryUI.open && !debugInputBlocked && !playerDead) {
             if (IsKeyDown(KEY_W)) input.y -= 1.0f;
@@ -1714,6 +1828,7 @@ int main() {
                 continue;
             }
             bool playerInside = (enemyEntry.first == roomManager.GetCurrentCoords());
+            AllocScope allocScope(AllocTag::Enemies);
             for (auto& enemyPtr : enemyEntry.second) {
                 if (!enemyPtr) {
                     continue;
@@ -1757,8 +1872,7 @@ int main() {
         if (!inventoryUI.open && !debugInputBlocked && !playerDead) {
             // Dispara habilidades de equipamento para slots 1-5 usando teclas numéricas.
             const KeyboardKey abilityKeys[] = {KEY_ONE, KEY_TWO, KEY_THREE, KEY_FOUR, KEY_FIVE};
-            int trackedSlots = std::min<int>(5, static_cast<int>(inventoryUI.equipmentSlotIds.size()));
-            for (int slot = 0; slot < trackedSlots; ++slot) {
+            for (int slot = 0; slot < kEquipmentSlotCount; ++slot) {
                 if (IsKeyPressed(abilityKeys[slot])) {
                     TryActivateEquipmentAbility(inventoryUI, player, slot);
                 }
@@ -1773,17 +1887,13 @@ int main() {
             };
 
             if (leftHandWeapon.CanFire() && weaponInputActive(leftHandWeapon, MOUSE_LEFT_BUTTON)) {
-                ProjectileBlueprint projectileConfig = leftHandWeapon.blueprint->projectile;
-                leftHandWeapon.ApplyDerivedToProjectile(projectileConfig);
-                projectileSystem.SpawnProjectile(projectileConfig, spawnContext);
+                projectileSystem.SpawnProjectile(leftHandWeapon.blueprint->projectile, spawnContext, leftHandWeapon.MakeShotOverrides());
                 float appliedCooldown = leftHandWeapon.ResetCooldown();
                 rightHandWeapon.EnforceMinimumCooldown(appliedCooldown);
             }
 
             if (rightHandWeapon.CanFire() && weaponInputActive(rightHandWeapon, MOUSE_RIGHT_BUTTON)) {
-                ProjectileBlueprint projectileConfig = rightHandWeapon.blueprint->projectile;
-                rightHandWeapon.ApplyDerivedToProjectile(projectileConfig);
-                projectileSystem.SpawnProjectile(projectileConfig, spawnContext);
+                projectileSystem.SpawnProjectile(rightHandWeapon.blueprint->projectile, spawnContext, rightHandWeapon.MakeShotOverrides());
                 float appliedCooldown = rightHandWeapon.ResetCooldown();
                 leftHandWeapon.EnforceMinimumCooldown(appliedCooldown);
             }
@@ -1809,7 +1919,7 @@ int main() {
                     if (!enemyPtr || !enemyPtr->IsAlive() || !enemyPtr->HasCompletedFade()) {
                         continue;
                     }
-                    auto hits = projectileSystem.CollectDamageEvents(
+                    const auto& hits = projectileSystem.CollectDamageEvents(
                         enemyPtr->GetPosition(),
                         enemyPtr->GetCollisionRadius(),
                         reinterpret_cast<std::uintptr_t>(enemyPtr.get()),
@@ -1827,7 +1937,7 @@ int main() {
                         bool died = enemyPtr->TakeDamage(modifiedDamage);
                         float actualDamage = std::max(0.0f, healthBefore - enemyPtr->GetCurrentHealth());
                         if (actualDamage > 0.0f) {
-                            PushDamageNumber(damageNumbers, enemyPtr->GetPosition(), actualDamage, hit.isCritical);
+                            damageNumbers.Push(enemyPtr->GetPosition(), actualDamage, hit.isCritical);
 
                             if (lifeStealPercent > 0.0f) {
                                 float healAmount = actualDamage * lifeStealPercent;
@@ -1839,12 +1949,12 @@ int main() {
 
                         if (died) {
                             // Recompensa pequenas moedas ao eliminar inimigos e mostra feedback visual.
-                            int coinsEarned = GetRandomValue(1, 5);
+                            int coinsEarned = GameRandom(RandomStreamId::Loot).RangeInt(1, 5);
                             inventoryUI.coins += coinsEarned;
+                            MarkInventoryDirty(inventoryUI);
                             Vector2 rewardPosition = enemyPtr->GetPosition();
                             rewardPosition.y -= 40.0f;
-                            PushDamageNumber(
-                                damageNumbers,
+                            damageNumbers.Push(
                                 rewardPosition,
                                 static_cast<float>(coinsEarned),
                                 false,
@@ -1875,7 +1985,7 @@ int main() {
         // Atualiza disparos inimigos e coleta dano recebido pelo jogador.
         enemyProjectileSystem.Update(delta);
 
-        auto playerHits = enemyProjectileSystem.CollectDamageEvents(
+        const auto& playerHits = enemyProjectileSystem.CollectDamageEvents(
             playerPosition,
             PLAYER_COLLISION_RADIUS,
             reinterpret_cast<std::uintptr_t>(&player),
@@ -1887,11 +1997,8 @@ int main() {
         const float curseDamageMultiplier = std::max(0.0f, player.derivedStats.damageTakenMultiplierFromCurse);
 
         for (const auto& hit : playerHits) {
-            if (dodgeChance > 0.0f) {
-                float roll = static_cast<float>(GetRandomValue(0, 10000)) / 10000.0f;
-                if (roll < dodgeChance) {
-                    continue;
-                }
+            if (dodgeChance > 0.0f && GameRandom(RandomStreamId::Combat).Chance(dodgeChance)) {
+                continue;
             }
 
             float incomingDamage = hit.amount;
@@ -1905,7 +2012,7 @@ int main() {
             incomingDamage = std::max(1.0f, incomingDamage);
 
             player.currentHealth = std::max(0.0f, player.currentHealth - incomingDamage);
-            PushDamageNumber(damageNumbers, playerPosition, incomingDamage, hit.isCritical);
+            damageNumbers.Push(playerPosition, incomingDamage, hit.isCritical);
         }
 
         // Quando a vida chega a zero, fecha UIs ativos e reseta estados persistidos.
@@ -1940,10 +2047,7 @@ int main() {
             inventoryUI.chestSupportsDeposit = false;
             inventoryUI.chestSupportsTakeAll = false;
             inventoryUI.chestTitle.clear();
-            inventoryUI.chestItemIds.clear();
-            inventoryUI.chestItems.clear();
-            inventoryUI.chestQuantities.clear();
-            inventoryUI.chestTypes.clear();
+            inventoryUI.chestSlotCount = 0;
         }
 
         Room& interactionRoom = roomManager.GetCurrentRoom();
@@ -1951,6 +2055,9 @@ int main() {
         activeShop = interactionRoom.GetShop();
         activeChest = interactionRoom.GetChest();
         const RoomCoords interactionCoords = interactionRoom.GetCoords();
+        // Lojas e baus sorteiam com a tabela do bioma da sala e a sorte atual do jogador.
+        inventoryUI.lootBiome = interactionRoom.GetBiome();
+        inventoryUI.lootLuckBonus = player.derivedStats.luckBonus;
 
         // Marca a sala atual como totalmente revelada no mapa visual.
         roomRevealStates[interactionCoords].alpha = 1.0f;
@@ -1976,95 +2083,98 @@ int main() {
             return 0.0f;
         };
 
-        doorRenderData.clear();
-        doorMaskData.clear();
-        doorRenderData.reserve(roomManager.Rooms().size() * 4);
-        doorMaskData.reserve(roomManager.Rooms().size() * 4);
-        std::unordered_set<DoorInstance*> animatedDoorInstances;
-        animatedDoorInstances.reserve(16);
-
-        // Percorre todas as portas conhecidas para pré-calcular dados de renderização e máscaras.
-        for (auto& entry : roomManager.Rooms()) {
-            Room& room = *entry.second;
-            float roomVisibility = resolveRoomVisibility(room);
-            if (roomVisibility <= 0.0f) {
-                continue;
-            }
-
-            bool isActiveRoom = (room.GetCoords() == interactionCoords);
-            RoomLayout& layout = room.Layout();
-            BiomeType biome = room.GetBiome();
-
-            for (Doorway& door : layout.doors) {
-                if (door.sealed || !door.targetGenerated || !door.doorState) {
+        {
+            // Pré-passe de portas: containers temporários deste bloco aparecem como "doors" no rastreio de alocações.
+            AllocScope allocScope(AllocTag::Doors);
+            doorRenderData.clear();
+            doorMaskData.clear();
+            doorRenderData.reserve(roomManager.Rooms().size() * 4);
+            doorMaskData.reserve(roomManager.Rooms().size() * 4);
+            std::unordered_set<DoorInstance*> animatedDoorInstances;
+            animatedDoorInstances.reserve(16);
+
+            // Percorre todas as portas conhecidas para pré-calcular dados de renderização e máscaras.
+            for (auto& entry : roomManager.Rooms()) {
+                Room& room = *entry.second;
+                float roomVisibility = resolveRoomVisibility(room);
+                if (roomVisibility <= 0.0f) {
                     continue;
                 }
 
-                DoorInstance& doorState = *door.doorState;
-                DoorInstance* instancePtr = door.doorState.get();
-                Rectangle doorHitbox = ComputeDoorHitbox(layout, door);
-                Rectangle doorCollisionHitbox = ComputeDoorCollisionHitbox(layout, door, doorHitbox);
-
-                if (doorState.opening && !doorState.open) {
-                    if (animatedDoorInstances.insert(instancePtr).second) {
-                        doorState.fadeProgress = std::min(DOOR_FADE_DURATION, doorState.fadeProgress + delta);
-                        if (doorState.fadeProgress >= DOOR_FADE_DURATION) {
-                            doorState.fadeProgress = DOOR_FADE_DURATION;
-                            doorState.open = true;
-                            doorState.maskActive = false;
+                bool isActiveRoom = (room.GetCoords() == interactionCoords);
+                RoomLayout& layout = room.Layout();
+                BiomeType biome = room.GetBiome();
+
+                for (Doorway& door : layout.doors) {
+                    if (door.sealed || !door.targetGenerated || !door.doorState) {
+                        continue;
+                    }
+
+                    DoorInstance& doorState = *door.doorState;
+                    DoorInstance* instancePtr = door.doorState.get();
+                    Rectangle doorHitbox = ComputeDoorHitbox(layout, door);
+                    Rectangle doorCollisionHitbox = ComputeDoorCollisionHitbox(layout, door, doorHitbox);
+
+                    if (doorState.opening && !doorState.open) {
+                        if (animatedDoorInstances.insert(instancePtr).second) {
+                            doorState.fadeProgress = std::min(DOOR_FADE_DURATION, doorState.fadeProgress + delta);
+                            if (doorState.fadeProgress >= DOOR_FADE_DURATION) {
+                                doorState.fadeProgress = DOOR_FADE_DURATION;
+                                doorState.open = true;
+                                doorState.maskActive = false;
+                            }
                         }
                     }
-                }
 
-                float doorAlpha = DoorVisibilityAlpha(doorState);
-                if (!doorState.open) {
-                    float revealAmount = 1.0f - doorAlpha;
-                    if (revealAmount > 0.0f) {
-                        RoomRevealState& revealState = roomRevealStates[door.targetCoords];
-                        revealState.alpha = std::max(revealState.alpha, revealAmount);
+                    float doorAlpha = DoorVisibilityAlpha(doorState);
+                    if (!doorState.open) {
+                        float revealAmount = 1.0f - doorAlpha;
+                        if (revealAmount > 0.0f) {
+                            RoomRevealState& revealState = roomRevealStates[door.targetCoords];
+                            revealState.alpha = std::max(revealState.alpha, revealAmount);
+                        }
                     }
-                }
 
-                if (!doorState.open && doorState.maskActive) {
-                    DoorMaskData mask{};
-                    mask.alpha = doorAlpha * roomVisibility;
-                    if (door.corridorTiles.width > 0 && door.corridorTiles.height > 0) {
-                        Rectangle corridorMask = TileRectToPixels(door.corridorTiles);
-                        if (ClipCorridorMaskBehindDoor(door.direction, doorHitbox, corridorMask)) {
-                            if (door.direction == Direction::East || door.direction == Direction::West) {
-                                const float wallThickness = static_cast<float>(TILE_SIZE);
-                                corridorMask.y -= wallThickness;
-                                corridorMask.height += wallThickness * 2.0f;
-                                // Ajuste o offset/extra height usando as constantes declaradas no topo do arquivo.
-                                corridorMask.y -= HORIZONTAL_CORRIDOR_MASK_VERTICAL_OFFSET;
-                                corridorMask.height += HORIZONTAL_CORRIDOR_MASK_VERTICAL_OFFSET;
-                                corridorMask.height += HORIZONTAL_CORRIDOR_MASK_EXTRA_HEIGHT;
+                    if (!doorState.open && doorState.maskActive) {
+                        DoorMaskData mask{};
+                        mask.alpha = doorAlpha * roomVisibility;
+                        if (door.corridorTiles.width > 0 && door.corridorTiles.height > 0) {
+                            Rectangle corridorMask = TileRectToPixels(door.corridorTiles);
+                            if (ClipCorridorMaskBehindDoor(door.direction, doorHitbox, corridorMask)) {
+                                if (door.direction == Direction::East || door.direction == Direction::West) {
+                                    const float wallThickness = static_cast<float>(TILE_SIZE);
+                                    corridorMask.y -= wallThickness;
+                                    corridorMask.height += wallThickness * 2.0f;
+                                    // Ajuste o offset/extra height usando as constantes declaradas no topo do arquivo.
+                                    corridorMask.y -= HORIZONTAL_CORRIDOR_MASK_VERTICAL_OFFSET;
+                                    corridorMask.height += HORIZONTAL_CORRIDOR_MASK_VERTICAL_OFFSET;
+                                    corridorMask.height += HORIZONTAL_CORRIDOR_MASK_EXTRA_HEIGHT;
+                                }
+                                mask.hasCorridorMask = true;
+                                mask.corridorMask = corridorMask;
                             }
-                            mask.hasCorridorMask = true;
-                            mask.corridorMask = corridorMask;
+                        }
+                        if (mask.hasCorridorMask) {
+                            doorMaskData.push_back(mask);
                         }
                     }
-                    if (mask.hasCorridorMask) {
-                        doorMaskData.push_back(mask);
+
+                    if (doorState.open) {
+                        continue;
                     }
-                }
 
-                if (doorState.open) {
-                    continue;
+                    DoorRenderData data{};
+                    data.doorway = &door;
+                    data.instance = &doorState;
+                    data.biome = biome;
+                    data.frontView = (door.direction == Direction::North || door.direction == Direction::South);
+                    data.hitbox = doorHitbox;
+                    data.collisionHitbox = doorCollisionHitbox;
+                    data.alpha = doorAlpha * roomVisibility;
+                    data.fromActiveRoom = isActiveRoom;
+                    data.drawAboveMask = (door.direction == Direction::North || door.direction == Direction::South);
+                    doorRenderData.push_back(data);
                 }
-
-                DoorRenderData data{};
-                data.doorway = &door;
-                data.instance = &doorState;
-                data.biome = biome;
-                data.frontView = (door.direction == Direction::North || door.direction == Direction::South);
-                data.hitbox = doorHitbox;
-                data.collisionHitbox = doorCollisionHitbox;
-                data.alpha = doorAlpha * roomVisibility;
-                data.drawAfterPlayer = (data.hitbox.y > playerPosition.y);
-                data.fromActiveRoom = isActiveRoom;
-                data.drawAboveMask = (door.direction == Direction::North || door.direction == Direction::South);
-                doorRenderData.push_back(data);
             }
         }
 
@@ -2222,10 +2332,7 @@ int main() {
                 inventoryUI.chestSupportsTakeAll = false;
                 inventoryUI.activeChestCoords = RoomCoords{};
                 inventoryUI.chestTitle.clear();
-                inventoryUI.chestItemIds.clear();
-                inventoryUI.chestItems.clear();
-                inventoryUI.chestQuantities.clear();
-                inventoryUI.chestTypes.clear();
+                inventoryUI.chestSlotCount = 0;
             }
         }
 
@@ -2248,23 +2355,19 @@ int main() {
         if (dummyActive) {
             // Converte impactos do jogador no dummy em números de dano com jitter visual.
             float dummyImmunity = trainingDummy.isImmune ? trainingDummy.immunitySecondsRemaining : 0.0f;
-            std::vector<ProjectileSystem::DamageEvent> damageEvents = projectileSystem.CollectDamageEvents(
+            const std::vector<ProjectileSystem::DamageEvent>& damageEvents = projectileSystem.CollectDamageEvents(
                 trainingDummy.position,
                 trainingDummy.radius,
                 reinterpret_cast<std::uintptr_t>(&trainingDummy),
                 dummyImmunity);
             for (const auto& event : damageEvents) {
-                DamageNumber number{};
-                number.amount = event.amount;
-                number.isCritical = event.isCritical;
-                number.lifetime = event.isCritical ? 1.4f : 1.0f;
-                int jitterX = GetRandomValue(-12, 12);
-                int jitterY = GetRandomValue(-6, 6);
-                number.position = Vector2{
+                int jitterX = GameRandom(RandomStreamId::Effects).RangeInt(-12, 12);
+                int jitterY = GameRandom(RandomStreamId::Effects).RangeInt(-6, 6);
+                Vector2 numberPosition{
                     trainingDummy.position.x + static_cast<float>(jitterX),
                     trainingDummy.position.y - trainingDummy.radius + static_cast<float>(jitterY)
                 };
-                damageNumbers.push_back(number);
+                damageNumbers.Push(numberPosition, event.amount, event.isCritical, event.isCritical ? 1.4f : 1.0f);
 
                 trainingDummy.immunitySecondsRemaining = std::max(trainingDummy.immunitySecondsRemaining,
                                                                    event.suggestedImmunitySeconds);
@@ -2272,7 +2375,7 @@ int main() {
             }
         }
 
-        UpdateDamageNumbers(damageNumbers, delta);
+        damageNumbers.Update(delta);
 
         // Seleciona a porta mais próxima dentro do raio de interação para mostrar o prompt contextual.
         DoorRenderData* activeDoorPrompt = nullptr;
@@ -2322,7 +2425,11 @@ int main() {
         Camera2D renderCamera = camera;
         renderCamera.target = snappedPlayerPosition;
 
+        // Sobe para a GPU sprites decodificados em background, limitado por quadro.
+        UpdateTextureManager();
+
         BeginDrawing();
+        BeginRenderStatsFrame();
         ClearBackground(Color{24, 26, 33, 255});
 
         BeginMode2D(renderCamera);
@@ -2343,120 +2450,69 @@ int main() {
 
             const char* label = "Dummy de treino";
             const float labelSize = 20.0f;
-            const Font& font = GetGameFont();
+            const Font& font = GetGameFont(labelSize);
             Vector2 labelMeasure = MeasureTextEx(font, label, labelSize, 0.0f);
             Vector2 labelPos{trainingDummy.position.x - labelMeasure.x * 0.5f, trainingDummy.position.y + trainingDummy.radius + 10.0f};
             DrawTextEx(font, label, labelPos, labelSize, 0.0f, Color{210, 220, 240, 220});
         }
 
-        bool drawForgeAfterPlayer = false;
-        bool drawShopAfterPlayer = false;
-        bool drawChestAfterPlayer = false;
+        // Uma única submissão por drawable; a fila ordena por camada/Y/prioridade/textura e desenha em sequência.
+        // Profundidade é o Y do centro do jogador: props comparam a âncora com os pés (meia altura abaixo);
+        // no empate a prioridade mantém o jogador na frente do prop.
+        renderQueue.Clear();
         if (activeForge != nullptr) {
-            float playerBottom = playerPosition.y + PLAYER_HALF_HEIGHT;
-            bool playerInFront = (playerBottom >= activeForge->anchorY);
-            if (playerInFront) {
-                roomRenderer.DrawForgeInstance(*activeForge, true);
-            } else {
-                drawForgeAfterPlayer = true;
-            }
+            RenderCommand command{DrawQueuedForge, activeForge, &roomRenderer};
+            renderQueue.Submit(RenderLayer::World, activeForge->anchorY - PLAYER_HALF_HEIGHT, RenderPriority::Prop, roomRenderer.ForgeTextureId(*activeForge), command);
         }
-
         if (activeShop != nullptr) {
-            float playerBottom = playerPosition.y + PLAYER_HALF_HEIGHT;
-            bool playerInFront = (playerBottom >= activeShop->anchorY);
-            if (playerInFront) {
-                roomRenderer.DrawShopInstance(*activeShop, true);
-            } else {
-                drawShopAfterPlayer = true;
-            }
+            RenderCommand command{DrawQueuedShop, activeShop, &roomRenderer};
+            renderQueue.Submit(RenderLayer::World, activeShop->anchorY - PLAYER_HALF_HEIGHT, RenderPriority::Prop, roomRenderer.ShopTextureId(*activeShop), command);
         }
-
         if (activeChest != nullptr) {
-            float playerBottom = playerPosition.y + PLAYER_HALF_HEIGHT;
-            bool playerInFront = (playerBottom >= activeChest->AnchorY());
-            if (playerInFront) {
-                roomRenderer.DrawChestInstance(*activeChest, true);
-            } else {
-                drawChestAfterPlayer = true;
-            }
+            RenderCommand command{DrawQueuedChest, activeChest, &roomRenderer};
+            renderQueue.Submit(RenderLayer::World, activeChest->AnchorY() - PLAYER_HALF_HEIGHT, RenderPriority::Prop, roomRenderer.ChestTextureId(), command);
         }
 
-        // Helper que desenha inimigos em duas passagens (antes e depois do jogador) para manter parallax.
-        auto drawEnemies = [&](bool drawAfterPlayer) {
-            for (const auto& enemyEntry : roomEnemies) {
-                const Room* enemyRoom = roomManager.TryGetRoom(enemyEntry.first);
-                if (enemyRoom == nullptr) {
-                    continue;
-                }
-                float roomVisibility = resolveRoomVisibility(*enemyRoom);
-                if (roomVisibility <= 0.0f) {
-                    continue;
-                }
-                bool isActiveRoom = (enemyRoom->GetCoords() == roomManager.GetCurrentCoords());
-                for (const auto& enemyPtr : enemyEntry.second) {
-                    if (!enemyPtr || !enemyPtr->IsAlive()) {
-                        continue;
-                    }
-                    bool enemyAfterPlayer = false;
-                    if (isActiveRoom) {
-                        enemyAfterPlayer = (enemyPtr->GetPosition().y >= playerPosition.y);
-                    }
-                    if (enemyAfterPlayer != drawAfterPlayer) {
-                        continue;
-                    }
-                    EnemyDrawContext drawContext{};
-                    drawContext.roomVisibility = roomVisibility;
-                    drawContext.isActiveRoom = isActiveRoom;
-                    enemyPtr->Draw(drawContext);
-                }
+        for (const DoorRenderData& doorData : doorRenderData) {
+            if (doorData.doorway == nullptr) {
+                continue;
             }
-        };
+            RenderCommand command{DrawQueuedDoor, &doorData, &roomRenderer};
+            RenderLayer layer = doorData.drawAboveMask ? RenderLayer::AboveMask : RenderLayer::World;
+            renderQueue.Submit(layer, doorData.hitbox.y, RenderPriority::Prop, roomRenderer.DoorTextureId(doorData.doorway->direction, doorData.biome), command);
+        }
 
-        // Helper que desenha portas respeitando camada (abaixo/acima do jogador e mask).
-        auto drawDoors = [&](bool drawAfterPlayer, bool aboveMask) {
-            for (const DoorRenderData& doorData : doorRenderData) {
-                if (doorData.drawAfterPlayer != drawAfterPlayer || doorData.drawAboveMask != aboveMask || doorData.doorway == nullptr) {
+        for (const auto& enemyEntry : roomEnemies) {
+            const Room* enemyRoom = roomManager.TryGetRoom(enemyEntry.first);
+            if (enemyRoom == nullptr) {
+                continue;
+            }
+            float roomVisibility = resolveRoomVisibility(*enemyRoom);
+            if (roomVisibility <= 0.0f) {
+                continue;
+            }
+            bool isActiveRoom = (enemyRoom->GetCoords() == roomManager.GetCurrentCoords());
+            for (const auto& enemyPtr : enemyEntry.second) {
+                if (!enemyPtr || !enemyPtr->IsAlive()) {
                     continue;
                 }
-                roomRenderer.DrawDoorSprite(doorData.hitbox, doorData.doorway->direction, doorData.biome, doorData.alpha);
+                RenderCommand command{nullptr, enemyPtr.get(), nullptr, {roomVisibility, isActiveRoom ? 1.0f : 0.0f}, DrawQueuedEnemies};
+                renderQueue.Submit(RenderLayer::World, enemyPtr->GetPosition().y, RenderPriority::Enemy, enemyPtr->GetBatchTextureId(), command);
             }
-        };
-
-        drawDoors(false, false);
-        drawEnemies(false);
-
-        if (!DrawCharacterSprite(playerSprites, snappedPlayerPosition, playerIsMoving)) {
-            // Fallback simples caso sprites não estejam disponíveis.
-            Rectangle renderRect{
-                snappedPlayerPosition.x - PLAYER_RENDER_HALF_WIDTH,
-                snappedPlayerPosition.y - PLAYER_RENDER_HALF_HEIGHT,
-                PLAYER_RENDER_HALF_WIDTH * 2.0f,
-                PLAYER_RENDER_HALF_HEIGHT * 2.0f
-            };
-            DrawRectangleRec(renderRect, Color{120, 180, 220, 255});
-            DrawRectangleLinesEx(renderRect, 2.0f, Color{30, 60, 90, 255});
         }
 
-        drawEnemies(true);
-        drawDoors(true, false);
-
-        if (drawForgeAfterPlayer && activeForge != nullptr) {
-            roomRenderer.DrawForgeInstance(*activeForge, true);
-        }
-        if (drawShopAfterPlayer && activeShop != nullptr) {
-            roomRenderer.DrawShopInstance(*activeShop, true);
-        }
-        if (drawChestAfterPlayer && activeChest != nullptr) {
-            roomRenderer.DrawChestInstance(*activeChest, true);
+        {
+            RenderCommand command{DrawQueuedPlayer, &playerSprites, nullptr, {snappedPlayerPosition.x, snappedPlayerPosition.y, playerIsMoving ? 1.0f : 0.0f}};
+            renderQueue.Submit(RenderLayer::World, playerPosition.y, RenderPriority::Player, CharacterSpriteTextureId(playerSprites, playerIsMoving), command);
         }
 
+        renderQueue.Sort();
+        renderQueue.Flush(RenderLayer::World);
+
         projectileSystem.Draw();
         enemyProjectileSystem.Draw();
 
-        if (!damageNumbers.empty()) {
-            DrawDamageNumbers(damageNumbers);
-        }
+        damageNumbers.Draw();
 
         for (const auto& entry : roomManager.Rooms()) {
             const Room& room = *entry.second;
@@ -2477,14 +2533,13 @@ int main() {
             DrawRectangleRec(mask.corridorMask, maskColor);
         }
 
-        drawDoors(false, true);
-        drawDoors(true, true);
+        renderQueue.Flush(RenderLayer::AboveMask);
 
         // Sequência de prompts contextuais para estações e portas próximas.
         if (activeForge != nullptr && forgeNearby) {
             const char* promptText = activeForge->IsBroken() ? "Forja quebrada (E para inspecionar)" : "Pressione E para usar a forja";
-            const Font& font = GetGameFont();
             const float fontSize = 22.0f;
+            const Font& font = GetGameFont(fontSize);
             Vector2 textSize = MeasureTextEx(font, promptText, fontSize, 0.0f);
             float bubblePadding = 12.0f;
             float bubbleWidth = textSize.x + bubblePadding * 2.0f;
@@ -2501,8 +2556,8 @@ int main() {
 
         if (activeShop != nullptr && shopNearby) {
             const char* promptText = "Pressione E para acessar a loja";
-            const Font& font = GetGameFont();
             const float fontSize = 22.0f;
+            const Font& font = GetGameFont(fontSize);
             Vector2 textSize = MeasureTextEx(font, promptText, fontSize, 0.0f);
             float bubblePadding = 12.0f;
             float bubbleWidth = textSize.x + bubblePadding * 2.0f;
@@ -2519,8 +2574,8 @@ int main() {
 
         if (activeChest != nullptr && chestNearby) {
             const char* promptText = "Pressione E para abrir o bau";
-            const Font& font = GetGameFont();
             const float fontSize = 22.0f;
+            const Font& font = GetGameFont(fontSize);
             Vector2 textSize = MeasureTextEx(font, promptText, fontSize, 0.0f);
             float bubblePadding = 12.0f;
             float bubbleWidth = textSize.x + bubblePadding * 2.0f;
@@ -2540,8 +2595,8 @@ int main() {
                 continue;
             }
             const char* promptText = doorData.isLocked ? "A porta esta trancada" : "Pressione E para abrir a porta";
-            const Font& font = GetGameFont();
             const float fontSize = 22.0f;
+            const Font& font = GetGameFont(fontSize);
             Vector2 textSize = MeasureTextEx(font, promptText, fontSize, 0.0f);
             float bubblePadding = 12.0f;
             float bubbleWidth = textSize.x + bubblePadding * 2.0f;
@@ -2583,7 +2638,48 @@ int main() {
         // Persiste conteúdo de forjas/lojas/baús caso jogador saia abruptamente com Alt+F4.
         SaveActiveStations(inventoryUI, roomManager);
 
+        // Overlay fica fora do quadro medido para não contar os próprios desenhos.
+        EndRenderStatsFrame();
+        DrawProfilerOverlay();
+
+        if (GetInputSessionMode() != InputSessionMode::Off) {
+            // Resumo do estado do mundo no fim do tick; a reprodução compara com o valor gravado.
+            WorldStateHasher worldHash;
+            worldHash.Add(playerPosition);
+            worldHash.Add(player.currentHealth);
+            worldHash.Add(inventoryUI.coins);
+            const RoomCoords currentCoords = roomManager.GetCurrentCoords();
+            worldHash.Add(currentCoords.x);
+            worldHash.Add(currentCoords.y);
+            auto enemiesIt = roomEnemies.find(currentCoords);
+            if (enemiesIt != roomEnemies.end()) {
+                worldHash.Add(static_cast<int>(enemiesIt->second.size()));
+                for (const auto& enemy : enemiesIt->second) {
+                    worldHash.Add(enemy->GetPosition());
+                    worldHash.Add(enemy->GetCurrentHealth());
+                }
+            }
+            worldHash.Add(static_cast<std::uint64_t>(projectileSystem.ActiveCount()));
+            worldHash.Add(static_cast<std::uint64_t>(enemyProjectileSystem.ActiveCount()));
+            EndInputTick(mouseWorld, worldHash.Value());
+        }
+
         EndDrawing();
+        // ALLOC_TRACKING=TRUE: fecha o quadro de alocações (inclui o desenho e a troca de buffers).
+        EndAllocStatsFrame();
+
+        if (exploreBot.IsActive()) {
+            if (exploreBot.WantsSample()) {
+                exploreBot.RecordSample(collectSoakSample());
+            }
+            // O bot revive no lugar em vez de reiniciar a run: o mundo precisa crescer durante toda a sessão.
+            if (playerDead) {
+                exploreBot.NotePlayerDeath();
+                player.currentHealth = player.derivedStats.maxHealth;
+                playerDead = false;
+                restartRequested = false;
+            }
+        }
 
         if (restartRequested) {
             BeginNewRun(true);
@@ -2591,10 +2687,20 @@ int main() {
         }
     }
 
+    exploreBot.Finish(collectSoakSample());
+    // Grava o arquivo de `--record` e imprime o resumo de tempos (e divergências de `--replay`).
+    StopInputSession();
+    PrintAllocStatsSummary();
+
     // Limpeza final dos recursos globais e da janela Raylib.
     EnemyCommon::ShutdownSpriteCache();
     UnloadCharacterSprites(playerSprites);
+    UnloadInventoryUICache();
+    UnloadHudCache();
     UnloadGameFont();
+    StopRenderStatsCsv();
+    ShutdownTextureManager();
+    CloseAssetArchive();
     CloseWindow();
     return 0;
 }  
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <cmath>
 
+#include "profiler.h"
+
 namespace {
 // Constantes base usadas nos cálculos de atributos derivados.
 constexpr float kBaseHealth = 100.0f;
@@ -17,13 +19,66 @@ constexpr float kDefenseReductionScale = 0.6f;
 constexpr float kDefenseNormalization = 61.0f;
 constexpr float kMaxDodgeChance = 0.6f;
 constexpr float kCursePercent = 0.01f;
+
+// Última versão entregue; compartilhada por entradas de modificadores e recálculos de stats.
+std::uint32_t g_lastStatVersion = 0;
+
+// Bloco de atributos correspondente à origem do modificador.
+PlayerAttributes& ModifierBlock(PlayerCharacter& player, StatModifierSource source) {
+    switch (source) {
+        case StatModifierSource::Equipment:
+            return player.equipmentBonuses;
+        case StatModifierSource::Weapons:
+            return player.weaponBonuses;
+        case StatModifierSource::Temporary:
+        case StatModifierSource::Count:
+            break;
+    }
+    return player.temporaryBonuses;
+}
 } // namespace
 
+std::uint32_t NextStatVersion() {
+    if (++g_lastStatVersion == 0) {
+        ++g_lastStatVersion;
+    }
+    return g_lastStatVersion;
+}
+
+bool PlayerCharacter::HasModifiersFrom(StatModifierSource source, std::uint32_t inputVersion) const {
+    return modifierInputVersions[static_cast<std::size_t>(source)] == inputVersion;
+}
+
+// Grava o bloco e a versão da entrada; comparar o valor evita recálculo quando a entrada mudou sem afetar bônus.
+bool PlayerCharacter::SetModifiers(StatModifierSource source, const PlayerAttributes& value, std::uint32_t inputVersion) {
+    modifierInputVersions[static_cast<std::size_t>(source)] = inputVersion;
+    PlayerAttributes& block = ModifierBlock(*this, source);
+    if (block == value) {
+        return false;
+    }
+    block = value;
+    statsDirty = true;
+    return true;
+}
+
+bool PlayerCharacter::RefreshStats() {
+    if (!statsDirty) {
+        return false;
+    }
+    RecalculateStats();
+    return true;
+}
+
 // Recalcula atributos agregados e estatísticas derivadas considerando itens e buffs temporários.
 void PlayerCharacter::RecalculateStats() {
-    totalAttributes = AddAttributes(baseAttributes, equipmentBonuses);
-    totalAttributes = AddAttributes(totalAttributes, weaponBonuses);
-    totalAttributes = AddAttributes(totalAttributes, temporaryBonuses);
+    CountStatRecompute(StatRecomputeKind::Player);
+    statsDirty = false;
+    statsVersion = NextStatVersion();
+
+    totalAttributes = baseAttributes;
+    AddAttributesInPlace(totalAttributes, equipmentBonuses);
+    AddAttributesInPlace(totalAttributes, weaponBonuses);
+    AddAttributesInPlace(totalAttributes, temporaryBonuses);
 
     derivedStats.maxHealth = kBaseHealth + kHealthPerVigor * static_cast<float>(totalAttributes.primary.vigor);
 
@@ -1,7 +1,13 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <tuple>
+#include <type_traits>
 
 // Identifica qual atributo ofensivo influencia o cálculo de dano de uma arma.
 enum class WeaponAttributeKey {
@@ -32,14 +38,15 @@ struct AttackAttributes {
 };
 
 // Atributos auxiliares responsáveis por efeitos especiais e chances percentuais.
+// maldicao vem primeiro para que os int de PlayerAttributes fiquem contíguos, seguidos só de float (ver lanes abaixo).
 struct SecondaryAttributes {
+    int maldicao{0}; // Reduz o dano causado e aumenta o dano recebido (ainda não sei se foi implementado)
     float vampirismo{0.0f}; // % do dano causado que é convertido em vida (ainda não implementado)
     float letalidade{0.0f}; // Aumenta a chance de acerto crítico.
     float reducaoDano{0.0f}; // Reduz o dano recebido em valor flat (ainda não sei se foi implementado)
     float desvio{0.0f}; // Aumenta a chance de esquiva - esquiva: evita 100% do dano de um ataque (ainda não sei se foi implementado)
     float alcanceColeta{0.0f}; // Será removido. Não necessário.
     float sorte{0.0f}; // Aumenta a chance de encontrar itens raros (ainda não implementado)
-    int maldicao{0}; // Reduz o dano causado e aumenta o dano recebido (ainda não sei se foi implementado)
 };
 
 // Agrupa os três blocos de atributos para facilitar operações de soma/comparação.
@@ -49,20 +56,94 @@ struct PlayerAttributes {
     SecondaryAttributes secondary{};
 };
 
+// Descreve um campo de bloco de atributos: chave nos arquivos de dados, rótulo e ícone da UI e o membro.
+template <typename Block, typename T>
+struct AttributeField {
+    using ValueType = T;
+    const char* key;
+    const char* label;
+    const char* icon; // nullptr quando o atributo não tem ícone
+    T Block::*member;
+};
+
+template <typename Block, typename T>
+constexpr AttributeField<Block, T> MakeAttributeField(const char* key, const char* label, const char* icon, T Block::*member) {
+    return AttributeField<Block, T>{key, label, icon, member};
+}
+
+// Lista de campos de cada bloco, na ordem da UI e do cache de dados. Comparação, serialização (game_data.cpp) e
+// linhas de bônus da UI são geradas a partir dela; um atributo novo só precisa ser acrescentado aqui.
+template <typename Block>
+struct AttributeFieldList;
+
+template <>
+struct AttributeFieldList<PrimaryAttributes> {
+    static constexpr auto kFields = std::make_tuple(
+        MakeAttributeField("poder", "Poder", "[POD]", &PrimaryAttributes::poder),
+        MakeAttributeField("defesa", "Defesa", "[DEF]", &PrimaryAttributes::defesa),
+        MakeAttributeField("vigor", "Vigor", "[VIG]", &PrimaryAttributes::vigor),
+        MakeAttributeField("velocidade", "Velocidade", "[VEL]", &PrimaryAttributes::velocidade),
+        MakeAttributeField("destreza", "Destreza", "[DES]", &PrimaryAttributes::destreza),
+        MakeAttributeField("inteligencia", "Inteligencia", "[INT]", &PrimaryAttributes::inteligencia));
+};
+
+template <>
+struct AttributeFieldList<AttackAttributes> {
+    static constexpr auto kFields = std::make_tuple(
+        MakeAttributeField("constituicao", "Constituicao", "[CON]", &AttackAttributes::constituicao),
+        MakeAttributeField("forca", "Forca", "[FOR]", &AttackAttributes::forca),
+        MakeAttributeField("foco", "Foco", "[FOC]", &AttackAttributes::foco),
+        MakeAttributeField("misticismo", "Misticismo", "[MYS]", &AttackAttributes::misticismo),
+        MakeAttributeField("conhecimento", "Conhecimento", "[SAB]", &AttackAttributes::conhecimento));
+};
+
+template <>
+struct AttributeFieldList<SecondaryAttributes> {
+    static constexpr auto kFields = std::make_tuple(
+        MakeAttributeField("vampirismo", "Vampirismo", "[VAM]", &SecondaryAttributes::vampirismo),
+        MakeAttributeField("letalidade", "Letalidade", "[LET]", &SecondaryAttributes::letalidade),
+        MakeAttributeField("reducaoDano", "Reducao de Dano", nullptr, &SecondaryAttributes::reducaoDano),
+        MakeAttributeField("desvio", "Desvio", "[DESV]", &SecondaryAttributes::desvio),
+        MakeAttributeField("alcanceColeta", "Alcance de Coleta", "[ALC]", &SecondaryAttributes::alcanceColeta),
+        MakeAttributeField("sorte", "Sorte", "[SOR]", &SecondaryAttributes::sorte),
+        MakeAttributeField("maldicao", "Maldicao", "[MAL]", &SecondaryAttributes::maldicao));
+};
+
+// Chama fn(campo) para cada descritor do bloco, na ordem da lista.
+template <typename Block, typename Fn>
+constexpr void ForEachAttributeField(Fn&& fn) {
+    std::apply([&fn](const auto&... field) { (fn(field), ...); }, AttributeFieldList<Block>::kFields);
+}
+
+// Quantos campos do bloco têm o tipo T.
+template <typename Block, typename T>
+constexpr std::size_t CountAttributeFields() {
+    std::size_t count = 0;
+    ForEachAttributeField<Block>([&count](const auto& field) {
+        if constexpr (std::is_same_v<typename std::decay_t<decltype(field)>::ValueType, T>) {
+            ++count;
+        }
+    });
+    return count;
+}
+
+template <typename Block>
+bool AttributeBlocksEqual(const Block& lhs, const Block& rhs) {
+    bool equal = true;
+    ForEachAttributeField<Block>([&](const auto& field) { equal = equal && lhs.*(field.member) == rhs.*(field.member); });
+    return equal;
+}
+
 inline bool operator==(const PrimaryAttributes& lhs, const PrimaryAttributes& rhs) {
-    return lhs.poder == rhs.poder && lhs.defesa == rhs.defesa && lhs.vigor == rhs.vigor &&
-           lhs.velocidade == rhs.velocidade && lhs.destreza == rhs.destreza && lhs.inteligencia == rhs.inteligencia;
+    return AttributeBlocksEqual(lhs, rhs);
 }
 
 inline bool operator==(const AttackAttributes& lhs, const AttackAttributes& rhs) {
-    return lhs.constituicao == rhs.constituicao && lhs.forca == rhs.forca && lhs.foco == rhs.foco &&
-           lhs.misticismo == rhs.misticismo && lhs.conhecimento == rhs.conhecimento;
+    return AttributeBlocksEqual(lhs, rhs);
 }
 
 inline bool operator==(const SecondaryAttributes& lhs, const SecondaryAttributes& rhs) {
-    return lhs.vampirismo == rhs.vampirismo && lhs.letalidade == rhs.letalidade && lhs.reducaoDano == rhs.reducaoDano &&
-           lhs.desvio == rhs.desvio && lhs.alcanceColeta == rhs.alcanceColeta && lhs.sorte == rhs.sorte &&
-           lhs.maldicao == rhs.maldicao;
+    return AttributeBlocksEqual(lhs, rhs);
 }
 
 inline bool operator==(const PlayerAttributes& lhs, const PlayerAttributes& rhs) {
@@ -73,38 +154,52 @@ inline bool operator!=(const PlayerAttributes& lhs, const PlayerAttributes& rhs)
     return !(lhs == rhs);
 }
 
-// Retorna um novo conjunto com a soma campo a campo dos atributos fornecidos.
-inline PlayerAttributes AddAttributes(const PlayerAttributes& a, const PlayerAttributes& b) {
-    PlayerAttributes result{};
-    result.primary.poder = a.primary.poder + b.primary.poder;
-    result.primary.defesa = a.primary.defesa + b.primary.defesa;
-    result.primary.vigor = a.primary.vigor + b.primary.vigor;
-    result.primary.velocidade = a.primary.velocidade + b.primary.velocidade;
-    result.primary.destreza = a.primary.destreza + b.primary.destreza;
-    result.primary.inteligencia = a.primary.inteligencia + b.primary.inteligencia;
-
-    result.attack.constituicao = a.attack.constituicao + b.attack.constituicao;
-    result.attack.forca = a.attack.forca + b.attack.forca;
-    result.attack.foco = a.attack.foco + b.attack.foco;
-    result.attack.misticismo = a.attack.misticismo + b.attack.misticismo;
-    result.attack.conhecimento = a.attack.conhecimento + b.attack.conhecimento;
-
-    result.secondary.vampirismo = a.secondary.vampirismo + b.secondary.vampirismo;
-    result.secondary.letalidade = a.secondary.letalidade + b.secondary.letalidade;
-    result.secondary.reducaoDano = a.secondary.reducaoDano + b.secondary.reducaoDano;
-    result.secondary.desvio = a.secondary.desvio + b.secondary.desvio;
-    result.secondary.alcanceColeta = a.secondary.alcanceColeta + b.secondary.alcanceColeta;
-    result.secondary.sorte = a.secondary.sorte + b.secondary.sorte;
-    result.secondary.maldicao = a.secondary.maldicao + b.secondary.maldicao;
-    return result;
-}
+// PlayerAttributes visto como lanes: todos os int (primary, attack, secondary.maldicao) seguidos de todos os float.
+constexpr std::size_t kAttributeIntLanes = CountAttributeFields<PrimaryAttributes, int>() +
+                                           CountAttributeFields<AttackAttributes, int>() +
+                                           CountAttributeFields<SecondaryAttributes, int>();
+constexpr std::size_t kAttributeFloatLanes = CountAttributeFields<PrimaryAttributes, float>() +
+                                             CountAttributeFields<AttackAttributes, float>() +
+                                             CountAttributeFields<SecondaryAttributes, float>();
 
-// Soma atributos e escreve o resultado diretamente no destino.
+static_assert(sizeof(int) == sizeof(float), "lanes de int e float precisam ter a mesma largura");
+static_assert(sizeof(PlayerAttributes) == (kAttributeIntLanes + kAttributeFloatLanes) * sizeof(int),
+              "todo campo de atributo precisa estar na lista de campos e os blocos não podem ter padding");
+static_assert(offsetof(SecondaryAttributes, maldicao) == 0 &&
+                  offsetof(PlayerAttributes, secondary) == sizeof(PrimaryAttributes) + sizeof(AttackAttributes) &&
+                  CountAttributeFields<SecondaryAttributes, int>() == 1,
+              "os int de PlayerAttributes precisam vir antes de todos os float");
+
+// Soma atributos e escreve o resultado diretamente no destino. Cada tipo é somado num laço sobre lanes contíguas,
+// que o vetorizador do compilador transforma em somas SIMD empacotadas (int e float).
 inline PlayerAttributes& AddAttributesInPlace(PlayerAttributes& target, const PlayerAttributes& source) {
-    target = AddAttributes(target, source);
+    int targetInts[kAttributeIntLanes];
+    int sourceInts[kAttributeIntLanes];
+    float targetFloats[kAttributeFloatLanes];
+    float sourceFloats[kAttributeFloatLanes];
+    unsigned char* targetBytes = reinterpret_cast<unsigned char*>(&target);
+    const unsigned char* sourceBytes = reinterpret_cast<const unsigned char*>(&source);
+
+    std::memcpy(targetInts, targetBytes, sizeof(targetInts));
+    std::memcpy(sourceInts, sourceBytes, sizeof(sourceInts));
+    std::memcpy(targetFloats, targetBytes + sizeof(targetInts), sizeof(targetFloats));
+    std::memcpy(sourceFloats, sourceBytes + sizeof(sourceInts), sizeof(sourceFloats));
+    for (std::size_t i = 0; i < kAttributeIntLanes; ++i) {
+        targetInts[i] += sourceInts[i];
+    }
+    for (std::size_t i = 0; i < kAttributeFloatLanes; ++i) {
+        targetFloats[i] += sourceFloats[i];
+    }
+    std::memcpy(targetBytes, targetInts, sizeof(targetInts));
+    std::memcpy(targetBytes + sizeof(targetInts), targetFloats, sizeof(targetFloats));
     return target;
 }
 
+// Retorna um novo conjunto com a soma campo a campo dos atributos fornecidos.
+inline PlayerAttributes AddAttributes(PlayerAttributes a, const PlayerAttributes& b) {
+    return AddAttributesInPlace(a, b);
+}
+
 // Estatísticas derivadas usadas em tempo de jogo após aplicar todos os bônus.
 struct PlayerDerivedStats {
     float maxHealth{100.0f};
@@ -136,6 +231,19 @@ struct CharacterAppearanceBlueprint {
     CharacterAnimationClip walking{};
 };
 
+// Blocos de modificadores somados a baseAttributes; cada um guarda a versão da entrada que o montou.
+enum class StatModifierSource {
+    Equipment, // Slots de equipamento do inventário
+    Weapons,   // Bônus passivos das armas empunhadas
+    Temporary, // Buffs temporários
+    Count
+};
+
+constexpr std::size_t kStatModifierSourceCount = static_cast<std::size_t>(StatModifierSource::Count);
+
+// Gera uma versão nova para entradas de modificadores e recálculos de stats (nunca 0, única entre instâncias).
+std::uint32_t NextStatVersion();
+
 // Representa o herói jogável com atributos agregados e vida/armadura atuais.
 struct PlayerCharacter {
     std::string id{};
@@ -150,8 +258,18 @@ struct PlayerCharacter {
     PlayerDerivedStats derivedStats{};
     float currentHealth{0.0f};
     float currentArmor{0.0f};
+    std::array<std::uint32_t, kStatModifierSourceCount> modifierInputVersions{}; // Versão da entrada usada por bloco
+    std::uint32_t statsVersion{0}; // Muda a cada recálculo; WeaponState compara para refazer as stats da arma
+    bool statsDirty{true};         // Algum bloco mudou desde o último recálculo
 
-    // Atualiza totalAttributes e derivedStats com base em todos os bônus aplicáveis.
+    // Indica se o bloco já foi montado a partir da versão informada da entrada (nada a refazer).
+    bool HasModifiersFrom(StatModifierSource source, std::uint32_t inputVersion) const;
+    // Troca o bloco pelo valor montado da entrada na versão informada; só suja as stats se o valor mudou.
+    // Retorna true quando o valor do bloco mudou.
+    bool SetModifiers(StatModifierSource source, const PlayerAttributes& value, std::uint32_t inputVersion);
+    // Recalcula só se algum bloco mudou desde o último recálculo; retorna true se recalculou.
+    bool RefreshStats();
+    // Atualiza totalAttributes e derivedStats com base em todos os bônus aplicáveis (sempre recalcula).
     void RecalculateStats();
     // Retorna o valor do atributo de ataque associado à arma passada.
     int GetAttackAttributeValue(WeaponAttributeKey key) const;
@@ -0,0 +1,41 @@
+#include "process_memory.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOGDI
+#define NOUSER
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <cstdio>
+#include <unistd.h>
+#endif
+
+// Assim como asset_archive.cpp, este módulo não inclui raylib.h (windows.h conflita com nomes da Raylib).
+
+std::size_t GetResidentMemoryBytes() {
+#if defined(_WIN32)
+    // K32GetProcessMemoryInfo fica na kernel32 (Windows 7+), então não precisa linkar psapi.
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<std::size_t>(counters.WorkingSetSize);
+    }
+    return 0;
+#elif defined(__linux__)
+    // statm: tamanho total e páginas residentes, em páginas.
+    std::FILE* file = std::fopen("/proc/self/statm", "r");
+    if (file == nullptr) {
+        return 0;
+    }
+    unsigned long totalPages = 0;
+    unsigned long residentPages = 0;
+    const int read = std::fscanf(file, "%lu %lu", &totalPages, &residentPages);
+    std::fclose(file);
+    if (read != 2) {
+        return 0;
+    }
+    return static_cast<std::size_t>(residentPages) * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <cstddef>
+
+// Memória residente (working set no Windows, RSS no Linux) do processo em bytes; 0 quando a plataforma não informa.
+std::size_t GetResidentMemoryBytes();
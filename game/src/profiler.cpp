@@ -0,0 +1,158 @@
+#include "profiler.h"
+
+#if defined(GAME_PROFILER)
+
+#include "raylib.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdio>
+
+#include "alloc_stats.h"
+#include "font_manager.h"
+#include "render_stats.h"
+
+namespace {
+
+bool g_overlayVisible = false;
+
+// Recálculos de stats por tipo: contagem da janela atual e da última janela de 1 s fechada.
+std::array<int, 2> g_statRecomputesInWindow{};
+std::array<int, 2> g_statRecomputesPerSecond{};
+double g_statWindowStart = 0.0;
+
+constexpr float kOverlayFontSize = 18.0f;
+constexpr float kOverlayLineHeight = 20.0f;
+constexpr float kOverlayPadding = 10.0f;
+constexpr float kOverlayWidth = 380.0f;
+constexpr float kColumnOffsets[4] = {0.0f, 130.0f, 210.0f, 290.0f};
+#if defined(GAME_ALLOC_TRACKING)
+constexpr std::size_t kAllocOverlayLines = 2;
+constexpr std::size_t kAllocOverlayTopTags = 3;
+#else
+constexpr std::size_t kAllocOverlayLines = 0;
+#endif
+
+// Desenha uma linha da tabela (subsistema, chamadas, trocas de textura, primitivas).
+void DrawCountersRow(const Font& font, float x, float y, const char* label, const RenderSubsystemCounters& counters, Color color) {
+    char buffer[32];
+    DrawTextEx(font, label, Vector2{x + kColumnOffsets[0], y}, kOverlayFontSize, 0.0f, color);
+    std::snprintf(buffer, sizeof(buffer), "%u", counters.drawCalls);
+    DrawTextEx(font, buffer, Vector2{x + kColumnOffsets[1], y}, kOverlayFontSize, 0.0f, color);
+    std::snprintf(buffer, sizeof(buffer), "%u", counters.textureSwitches);
+    DrawTextEx(font, buffer, Vector2{x + kColumnOffsets[2], y}, kOverlayFontSize, 0.0f, color);
+    std::snprintf(buffer, sizeof(buffer), "%u", counters.primitives);
+    DrawTextEx(font, buffer, Vector2{x + kColumnOffsets[3], y}, kOverlayFontSize, 0.0f, color);
+}
+
+} // namespace
+
+void ToggleProfilerOverlay() {
+    g_overlayVisible = !g_overlayVisible;
+}
+
+bool IsProfilerOverlayVisible() {
+    return g_overlayVisible;
+}
+
+void CountStatRecompute(StatRecomputeKind kind) {
+    ++g_statRecomputesInWindow[static_cast<std::size_t>(kind)];
+}
+
+void DrawProfilerOverlay() {
+    // A janela fecha aqui (uma vez por quadro) para a contagem não depender de GetTime fora do jogo.
+    const double now = GetTime();
+    if (now - g_statWindowStart >= 1.0) {
+        g_statRecomputesPerSecond = g_statRecomputesInWindow;
+        g_statRecomputesInWindow.fill(0);
+        g_statWindowStart = now;
+    }
+
+    if (!g_overlayVisible) {
+        return;
+    }
+
+    const RenderFrameStats& frame = GetLastRenderFrameStats();
+    const Font& font = GetGameFont(kOverlayFontSize);
+    const std::size_t subsystemCount = frame.subsystems.size();
+
+    // Linha de FPS + colunas + subsistemas + total + memória do atlas de fontes + recálculos de stats (+ alocações).
+    float panelHeight =
+        kOverlayPadding * 2.0f + kOverlayLineHeight * static_cast<float>(subsystemCount + 5 + kAllocOverlayLines);
+    Rectangle panel{
+        static_cast<float>(GetScreenWidth()) - kOverlayWidth - 16.0f,
+        16.0f,
+        kOverlayWidth,
+        panelHeight
+    };
+    DrawRectangleRec(panel, Color{10, 12, 18, 210});
+    DrawRectangleLinesEx(panel, 1.0f, Color{70, 92, 126, 240});
+
+    const Color headerColor{235, 240, 252, 255};
+    const Color rowColor{190, 200, 220, 255};
+    float x = panel.x + kOverlayPadding;
+    float y = panel.y + kOverlayPadding;
+
+    char buffer[96];
+    std::snprintf(buffer, sizeof(buffer), "FPS %d | %.2f ms%s", GetFPS(), GetFrameTime() * 1000.0f,
+                  IsRenderStatsCsvActive() ? " | CSV" : "");
+    DrawTextEx(font, buffer, Vector2{x, y}, kOverlayFontSize, 0.0f, headerColor);
+    y += kOverlayLineHeight;
+
+    const char* headers[4] = {"subsistema", "draws", "tex", "prims"};
+    for (int i = 0; i < 4; ++i) {
+        DrawTextEx(font, headers[i], Vector2{x + kColumnOffsets[i], y}, kOverlayFontSize, 0.0f, headerColor);
+    }
+    y += kOverlayLineHeight;
+
+    for (std::size_t i = 0; i < subsystemCount; ++i) {
+        DrawCountersRow(font, x, y, RenderSubsystemName(static_cast<RenderSubsystem>(i)), frame.subsystems[i], rowColor);
+        y += kOverlayLineHeight;
+    }
+    DrawCountersRow(font, x, y, "total", frame.totals, headerColor);
+    y += kOverlayLineHeight;
+
+    const FontAtlasStats fontAtlas = GetFontAtlasStats();
+    std::snprintf(buffer, sizeof(buffer), "fontes %dx%d | %d tam. | %zu KB", fontAtlas.atlasWidth, fontAtlas.atlasHeight,
+                  fontAtlas.sizeCount, (fontAtlas.textureBytes + fontAtlas.glyphBytes) / 1024);
+    DrawTextEx(font, buffer, Vector2{x, y}, kOverlayFontSize, 0.0f, rowColor);
+    y += kOverlayLineHeight;
+
+    std::snprintf(buffer, sizeof(buffer), "stats/s: jogador %d | armas %d",
+                  g_statRecomputesPerSecond[static_cast<std::size_t>(StatRecomputeKind::Player)],
+                  g_statRecomputesPerSecond[static_cast<std::size_t>(StatRecomputeKind::Weapon)]);
+    DrawTextEx(font, buffer, Vector2{x, y}, kOverlayFontSize, 0.0f, rowColor);
+
+#if defined(GAME_ALLOC_TRACKING)
+    // Alocações do último quadro fechado e os subsistemas que mais alocaram nele.
+    const AllocFrameStats& allocs = GetLastAllocFrameStats();
+    y += kOverlayLineHeight;
+    std::snprintf(buffer, sizeof(buffer), "allocs/q %u | %llu KB | frees %u", allocs.totals.allocations,
+                  static_cast<unsigned long long>(allocs.totals.bytes / 1024), allocs.totals.frees);
+    DrawTextEx(font, buffer, Vector2{x, y}, kOverlayFontSize, 0.0f,
+               allocs.totals.allocations == 0 ? rowColor : Color{240, 190, 110, 255});
+    y += kOverlayLineHeight;
+
+    std::array<std::size_t, kAllocTagCount> order{};
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::partial_sort(order.begin(), order.begin() + kAllocOverlayTopTags, order.end(), [&](std::size_t a, std::size_t b) {
+        return allocs.tags[a].allocations > allocs.tags[b].allocations;
+    });
+    int written = 0;
+    buffer[0] = '\0';
+    for (std::size_t i = 0; i < kAllocOverlayTopTags; ++i) {
+        const AllocTagCounters& counters = allocs.tags[order[i]];
+        if (counters.allocations == 0 || written < 0 || static_cast<std::size_t>(written) >= sizeof(buffer)) {
+            break;
+        }
+        written += std::snprintf(buffer + written, sizeof(buffer) - static_cast<std::size_t>(written), "%s%s %u",
+                                 i == 0 ? "" : " | ", AllocTagName(static_cast<AllocTag>(order[i])), counters.allocations);
+    }
+    DrawTextEx(font, written > 0 ? buffer : "sem alocacoes no quadro", Vector2{x, y}, kOverlayFontSize, 0.0f, rowColor);
+#endif
+}
+
+#endif
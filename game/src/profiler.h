@@ -0,0 +1,31 @@
+#pragma once
+
+// Overlay de profiling em tela (somente com -DGAME_PROFILER; sem a flag as funções não fazem nada).
+// Controlado pelo console de debug: profiler.toggle, profiler.csv.start, profiler.csv.stop.
+
+// Tipos de recálculo de stats contados pelo overlay.
+enum class StatRecomputeKind {
+    Player, // PlayerCharacter::RecalculateStats
+    Weapon  // WeaponState::RecalculateDerivedStats
+};
+
+#if defined(GAME_PROFILER)
+
+// Alterna a visibilidade do overlay.
+void ToggleProfilerOverlay();
+bool IsProfilerOverlayVisible();
+
+// Desenha o overlay com o último quadro publicado; chamar depois de EndRenderStatsFrame e antes de EndDrawing.
+void DrawProfilerOverlay();
+
+// Registra um recálculo de stats; o overlay mostra quantos aconteceram no último segundo.
+void CountStatRecompute(StatRecomputeKind kind);
+
+#else
+
+inline void ToggleProfilerOverlay() {}
+inline bool IsProfilerOverlayVisible() { return false; }
+inline void DrawProfilerOverlay() {}
+inline void CountStatRecompute(StatRecomputeKind) {}
+
+#endif
@@ -1,29 +1,45 @@
 #include "projectile.h"
 
 #include "raymath.h"
+#include "alloc_stats.h"
+#include "render_stats.h"
+#include "texture_manager.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
-#include <random>
+#include <cstdlib>
+#include <type_traits>
 #include <unordered_map>
+#include <variant>
 
 namespace {
 
 // Conversão auxiliar para transformar radianos em graus.
 constexpr float kRadToDeg = 180.0f / PI;
 
-// Mantém texturas carregadas uma vez para reutilização entre projeções de armas.
-struct CachedTexture {
-    Texture2D texture{};
-    bool attemptedLoad{false};
-};
+// Seed dos sistemas de projéteis até SeedRandom (é a que os benchmarks usam).
+constexpr std::uint64_t kDefaultProjectileSeed = 0x50A0EC711E5EEDULL;
 
-// Armazena texturas carregadas por caminho para reutilização posterior.
-std::unordered_map<std::string, CachedTexture> g_spriteCache{};
+// Handles de sprites compartilhados por todos os ProjectileSystem vivos (uma referência por caminho).
+std::unordered_map<std::string, TextureHandle> g_spriteHandles{};
+int g_liveProjectileSystems = 0;
+// Época dos handles acima; muda ao devolvê-los, invalidando o cache spriteHandles dos blueprints.
+std::uint32_t g_spriteEpoch = 1;
 
 // Controla o tempo mínimo entre golpes do mesmo projétil e alvo.
+// Armazenamento inline (sem heap): um golpe raramente acerta mais que kMaxTrackedTargets alvos; além disso,
+// o registro mais antigo (o primeiro a sair do cooldown) é substituído.
 struct PerTargetHitTracker {
-    std::unordered_map<std::uintptr_t, float> lastHitSeconds{};
+    static constexpr std::size_t kMaxTrackedTargets = 16;
+
+    struct Entry {
+        std::uintptr_t targetId{0};
+        float lastHitSeconds{0.0f};
+    };
+
+    std::array<Entry, kMaxTrackedTargets> entries{};
+    std::size_t count{0};
 
     // Retorna true se já se passou tempo suficiente desde o último acerto no alvo.
     bool CanHit(std::uintptr_t targetId, float currentTimeSeconds, float cooldownSeconds) const {
@@ -31,64 +47,108 @@ struct PerTargetHitTracker {
             return true;
         }
 
-        auto it = lastHitSeconds.find(targetId);
-        if (it == lastHitSeconds.end()) {
-            return true;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (entries[i].targetId == targetId) {
+                return (currentTimeSeconds - entries[i].lastHitSeconds) >= cooldownSeconds;
+            }
         }
-
-        return (currentTimeSeconds - it->second) >= cooldownSeconds;
+        return true;
     }
 
     // Registra o instante em que o alvo foi atingido.
     void RecordHit(std::uintptr_t targetId, float currentTimeSeconds) {
-        lastHitSeconds[targetId] = currentTimeSeconds;
+        Entry* slot = nullptr;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (entries[i].targetId == targetId) {
+                slot = &entries[i];
+                break;
+            }
+        }
+        if (slot == nullptr && count < kMaxTrackedTargets) {
+            slot = &entries[count++];
+        }
+        if (slot == nullptr) {
+            slot = &*std::min_element(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+                return a.lastHitSeconds < b.lastHitSeconds;
+            });
+        }
+        slot->targetId = targetId;
+        slot->lastHitSeconds = currentTimeSeconds;
     }
 };
 
-// Carrega textura apenas se existir fisicamente no disco.
-Texture2D LoadTextureIfAvailable(const std::string& path) {
-    if (path.empty()) {
-        return Texture2D{};
-    }
+// Dano/crítico efetivos de uma instância: blueprint compartilhado combinado aos overrides do disparo.
+struct ProjectileHitStats {
+    float damage{0.0f};
+    float criticalChance{0.0f};
+    float criticalMultiplier{1.0f};
+};
+
+// Resolve as stats de acerto uma única vez no spawn, sem duplicar o restante dos parâmetros.
+ProjectileHitStats ResolveHitStats(const ProjectileCommonParams& common, const ProjectileShotOverrides& overrides) {
+    ProjectileHitStats stats{};
+    stats.damage = overrides.overrideDamage ? overrides.damage : common.damage;
+    stats.criticalChance = overrides.overrideCritical ? overrides.criticalChance : common.criticalChance;
+    stats.criticalMultiplier = overrides.overrideCritical ? overrides.criticalMultiplier : common.criticalMultiplier;
+    return stats;
+}
 
-    if (FileExists(path.c_str())) {
-        Texture2D texture = LoadTexture(path.c_str());
-        if (texture.id != 0) {
-            SetTextureFilter(texture, TEXTURE_FILTER_POINT);
-            return texture;
+// Monta o evento de dano e sorteia crítico conforme as stats resolvidas.
+ProjectileSystem::DamageEvent RollDamageEvent(const ProjectileHitStats& stats,
+                                              float suggestedImmunitySeconds,
+                                              RandomStream& rng) {
+    ProjectileSystem::DamageEvent event{};
+    event.amount = stats.damage;
+    event.suggestedImmunitySeconds = suggestedImmunitySeconds;
+
+    if (stats.criticalChance > 0.0f) {
+        if (rng.Chance(stats.criticalChance)) {
+            event.isCritical = true;
+            float multiplier = (stats.criticalMultiplier > 0.0f) ? stats.criticalMultiplier : 1.0f;
+            event.amount *= multiplier;
         }
     }
 
-    return Texture2D{};
+    return event;
 }
 
-// Retorna textura de sprite usando cache global para evitar carregamentos repetidos.
-Texture2D AcquireSpriteTexture(const std::string& path) {
+// Resolve handle do sprite no gerenciador, adquirindo a referência apenas na primeira vez.
+TextureHandle ResolveSpriteHandle(const std::string& path) {
     if (path.empty()) {
-        return Texture2D{};
+        return kInvalidTextureHandle;
     }
 
-    auto& entry = g_spriteCache[path];
-    if (!entry.attemptedLoad) {
-        entry.attemptedLoad = true;
-        entry.texture = LoadTextureIfAvailable(path);
+    auto it = g_spriteHandles.find(path);
+    if (it != g_spriteHandles.end()) {
+        return it->second;
     }
 
-    return entry.texture;
+    TextureHandle handle = AcquireTexture(path, TEXTURE_FILTER_POINT);
+    g_spriteHandles.emplace(path, handle);
+    return handle;
 }
 
-// Limpa todas as texturas armazenadas quando o sistema é destruído.
-void ReleaseSpriteCache() {
-    for (auto& pair : g_spriteCache) {
-        CachedTexture& entry = pair.second;
-        if (entry.texture.id != 0) {
-            UnloadTexture(entry.texture);
-            entry.texture = Texture2D{};
-        }
-        entry.attemptedLoad = false;
+// Devolve as referências quando o último sistema de projéteis é destruído.
+void ReleaseSpriteHandles() {
+    for (const auto& pair : g_spriteHandles) {
+        ReleaseTexture(pair.second);
     }
+    g_spriteHandles.clear();
+    ++g_spriteEpoch;
+}
+
+// Sprites de arma/projétil para que o Draw só indexe o gerenciador. A busca por caminho acontece uma vez por
+// blueprint (cache em common.spriteHandles); os disparos seguintes só copiam os handles.
+using ProjectileSprites = ProjectileSpriteHandles;
 
-    g_spriteCache.clear();
+ProjectileSprites ResolveProjectileSprites(const ProjectileCommonParams& common) {
+    ProjectileSpriteHandles& cached = common.spriteHandles;
+    if (cached.epoch != g_spriteEpoch) {
+        cached.weapon = ResolveSpriteHandle(common.weaponSpritePath);
+        cached.projectile = ResolveSpriteHandle(common.projectileSpritePath);
+        cached.epoch = g_spriteEpoch;
+    }
+    return cached;
 }
 
 // Clamps auxiliar limitado a [0,1] sem depender de std::clamp (evita incluir <algorithm> extra).
@@ -171,61 +231,61 @@ void DrawWeaponDisplay(const ProjectileCommonParams& common, const Vector2& base
         drawAngle = angleDegrees;
     }
 
-    DrawRectanglePro(rect, pivot, drawAngle, common.displayColor);
+    Counted::DrawRectanglePro(rect, pivot, drawAngle, common.displayColor);
 }
 
 // Tenta desenhar sprite de arma; retorna false se não houver textura carregada.
-bool DrawWeaponSpriteFromPath(const std::string& spritePath,
-                              const Vector2& basePosition,
-                              float angleDegrees,
-                              float desiredLength,
-                              float desiredThickness,
-                              Color tint) {
-    Texture2D texture = AcquireSpriteTexture(spritePath);
-    if (texture.id == 0) {
+bool DrawWeaponSprite(TextureHandle sprite,
+                      const Vector2& basePosition,
+                      float angleDegrees,
+                      float desiredLength,
+                      float desiredThickness,
+                      Color tint) {
+    const TextureRegion& region = GetTextureRegion(sprite);
+    if (region.texture.id == 0) {
         return false;
     }
 
-    float length = (desiredLength > 0.0f) ? desiredLength : static_cast<float>(texture.height);
-    float thickness = (desiredThickness > 0.0f) ? desiredThickness : static_cast<float>(texture.width);
-    Rectangle src{0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+    float length = (desiredLength > 0.0f) ? desiredLength : region.bounds.height;
+    float thickness = (desiredThickness > 0.0f) ? desiredThickness : region.bounds.width;
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     Rectangle dest{basePosition.x, basePosition.y, thickness, length};
     Vector2 origin{thickness * 0.5f, 0.0f};
     float rotation = angleDegrees - 90.0f;
-    DrawTexturePro(texture, src, dest, origin, rotation, tint);
+    DrawTextureRegion(region, src, dest, origin, rotation, tint);
     return true;
 }
 
 // Desenha sprite de projétil posicionado no centro indicado.
-bool DrawProjectileSpriteFromPath(const std::string& spritePath,
-                                  const Vector2& center,
-                                  float angleDegrees,
-                                  float desiredLength,
-                                  float desiredThickness,
-                                  Color tint) {
-    Texture2D texture = AcquireSpriteTexture(spritePath);
-    if (texture.id == 0) {
+bool DrawProjectileSprite(TextureHandle sprite,
+                          const Vector2& center,
+                          float angleDegrees,
+                          float desiredLength,
+                          float desiredThickness,
+                          Color tint) {
+    const TextureRegion& region = GetTextureRegion(sprite);
+    if (region.texture.id == 0) {
         return false;
     }
 
-    float length = (desiredLength > 0.0f) ? desiredLength : static_cast<float>(texture.height);
-    float thickness = (desiredThickness > 0.0f) ? desiredThickness : static_cast<float>(texture.width);
-    Rectangle src{0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+    float length = (desiredLength > 0.0f) ? desiredLength : region.bounds.height;
+    float thickness = (desiredThickness > 0.0f) ? desiredThickness : region.bounds.width;
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     Rectangle dest{center.x, center.y, thickness, length};
     Vector2 origin{thickness * 0.5f, length * 0.5f};
     float rotation = angleDegrees - 90.0f;
-    DrawTexturePro(texture, src, dest, origin, rotation, tint);
+    DrawTextureRegion(region, src, dest, origin, rotation, tint);
     return true;
 }
 
 // Versão especializada para raios/lasers que ocupam um segmento de reta.
-bool DrawBeamSpriteFromPath(const std::string& spritePath,
-                            const Vector2& start,
-                            const Vector2& end,
-                            float desiredThickness,
-                            Color tint) {
-    Texture2D texture = AcquireSpriteTexture(spritePath);
-    if (texture.id == 0) {
+bool DrawBeamSprite(TextureHandle sprite,
+                    const Vector2& start,
+                    const Vector2& end,
+                    float desiredThickness,
+                    Color tint) {
+    const TextureRegion& region = GetTextureRegion(sprite);
+    if (region.texture.id == 0) {
         return false;
     }
 
@@ -234,13 +294,13 @@ bool DrawBeamSpriteFromPath(const std::string& spritePath,
         return false;
     }
 
-    float thickness = (desiredThickness > 0.0f) ? desiredThickness : static_cast<float>(texture.width);
-    Rectangle src{0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+    float thickness = (desiredThickness > 0.0f) ? desiredThickness : region.bounds.width;
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     Rectangle dest{start.x, start.y, thickness, length};
     Vector2 origin{thickness * 0.5f, 0.0f};
     Vector2 direction = Vector2Normalize(Vector2Subtract(end, start));
     float rotation = DirectionToDegrees(direction) - 90.0f;
-    DrawTexturePro(texture, src, dest, origin, rotation, tint);
+    DrawTextureRegion(region, src, dest, origin, rotation, tint);
     return true;
 }
 
@@ -260,7 +320,7 @@ struct ProjectileSystem::ProjectileInstance {
                                   float,
                                   std::uintptr_t,
                                   float,
-                                  std::mt19937&,
+                                  RandomStream&,
                                   std::vector<ProjectileSystem::DamageEvent>&) {}
 };
 
@@ -270,12 +330,15 @@ namespace {
 class BluntProjectile final : public ProjectileSystem::ProjectileInstance {
 public:
     BluntProjectile(const ProjectileCommonParams& common,
+                    const ProjectileHitStats& hitStats,
                     const BluntProjectileParams& params,
                     Vector2 origin,
                     const Vector2* followTarget,
                     float startCenterDegrees,
                     float endCenterDegrees)
         : common_(common),
+          sprites_(ResolveProjectileSprites(common)),
+          hitStats_(hitStats),
           params_(params),
           origin_(origin),
           followTarget_(followTarget),
@@ -333,12 +396,12 @@ public:
                                      ? common_.projectileForwardOffset
                                      : hitboxOffset;
             Vector2 spriteCenter = Vector2Add(origin_, Vector2Scale(aimDir, spriteOffset));
-            drewProjectileSprite = DrawProjectileSpriteFromPath(common_.projectileSpritePath,
-                                                               spriteCenter,
-                                                               centerAngle + common_.projectileRotationOffsetDegrees,
-                                                               spriteLength,
-                                                               spriteThickness,
-                                                               WHITE);
+            drewProjectileSprite = DrawProjectileSprite(sprites_.projectile,
+                                                        spriteCenter,
+                                                        centerAngle + common_.projectileRotationOffsetDegrees,
+                                                        spriteLength,
+                                                        spriteThickness,
+                                                        WHITE);
         }
 
         bool drewWeaponSprite = false;
@@ -346,12 +409,12 @@ public:
             WeaponDisplayState displayState = ComputeWeaponDisplayState(common_, aimDir, centerAngle);
             displayState.angleDeg += common_.projectileRotationOffsetDegrees;
             Vector2 displayBase = Vector2Add(origin_, displayState.offset);
-            drewWeaponSprite = DrawWeaponSpriteFromPath(common_.weaponSpritePath,
-                                                       displayBase,
-                                                       displayState.angleDeg,
-                                                       common_.displayLength,
-                                                       common_.displayThickness,
-                                                       WHITE);
+            drewWeaponSprite = DrawWeaponSprite(sprites_.weapon,
+                                                displayBase,
+                                                displayState.angleDeg,
+                                                common_.displayLength,
+                                                common_.displayThickness,
+                                                WHITE);
         }
 
         if (!drewProjectileSprite && !drewWeaponSprite) {
@@ -361,8 +424,8 @@ public:
             Vector2 v1 = Vector2Add(Vector2Subtract(rectCenter, forward), right);
             Vector2 v2 = Vector2Add(Vector2Add(rectCenter, forward), right);
             Vector2 v3 = Vector2Subtract(Vector2Add(rectCenter, forward), right);
-            DrawTriangle(v0, v1, v2, common_.debugColor);
-            DrawTriangle(v0, v2, v3, common_.debugColor);
+            Counted::DrawTriangle(v0, v1, v2, common_.debugColor);
+            Counted::DrawTriangle(v0, v2, v3, common_.debugColor);
         }
     }
 
@@ -376,9 +439,9 @@ public:
                           float targetRadius,
                           std::uintptr_t targetId,
                           float targetImmunitySeconds,
-                          std::mt19937& rng,
+                          RandomStream& rng,
                           std::vector<ProjectileSystem::DamageEvent>& outEvents) override {
-        if (expired_ || common_.damage <= 0.0f) {
+        if (expired_ || hitStats_.damage <= 0.0f) {
             return;
         }
 
@@ -415,18 +478,7 @@ public:
             return;
         }
 
-        ProjectileSystem::DamageEvent event{};
-        event.amount = common_.damage;
-        event.suggestedImmunitySeconds = hitCooldown;
-
-        if (common_.criticalChance > 0.0f) {
-            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-            if (dist(rng) < common_.criticalChance) {
-                event.isCritical = true;
-                float multiplier = (common_.criticalMultiplier > 0.0f) ? common_.criticalMultiplier : 1.0f;
-                event.amount *= multiplier;
-            }
-        }
+        ProjectileSystem::DamageEvent event = RollDamageEvent(hitStats_, hitCooldown, rng);
 
         perTargetHits_.RecordHit(targetId, elapsed_);
         outEvents.push_back(event);
@@ -437,8 +489,10 @@ public:
     }
 
 private:
-    ProjectileCommonParams common_{};
-    BluntProjectileParams params_{};
+    const ProjectileCommonParams& common_;
+    ProjectileSprites sprites_{};
+    ProjectileHitStats hitStats_{};
+    const BluntProjectileParams& params_;
     Vector2 origin_{};
     const Vector2* followTarget_{nullptr};
     float startCenterDegrees_{0.0f};
@@ -452,12 +506,15 @@ private:
 class SwingProjectile final : public ProjectileSystem::ProjectileInstance {
 public:
     SwingProjectile(const ProjectileCommonParams& common,
+                    const ProjectileHitStats& hitStats,
                     const SwingProjectileParams& params,
                     Vector2 origin,
                     const Vector2* followTarget,
                     float startCenterDegrees,
                     float endCenterDegrees)
         : common_(common),
+          sprites_(ResolveProjectileSprites(common)),
+          hitStats_(hitStats),
           params_(params),
           origin_(origin),
           followTarget_(followTarget),
@@ -494,12 +551,12 @@ public:
             Vector2 spriteBase = origin_;
             float forwardOffset = (spriteLength * 0.5f) + common_.projectileForwardOffset;
             Vector2 spriteCenter = Vector2Add(spriteBase, Vector2Scale(aimDir, forwardOffset));
-            drewSprite = DrawProjectileSpriteFromPath(common_.projectileSpritePath,
-                                                     spriteCenter,
-                                                     adjustedAngle,
-                                                     spriteLength,
-                                                     spriteThickness,
-                                                     WHITE);
+            drewSprite = DrawProjectileSprite(sprites_.projectile,
+                                              spriteCenter,
+                                              adjustedAngle,
+                                              spriteLength,
+                                              spriteThickness,
+                                              WHITE);
         }
 
         if (!drewSprite && !common_.weaponSpritePath.empty()) {
@@ -515,12 +572,12 @@ public:
             Vector2 displayBase = Vector2Add(origin_, displayState.offset);
             float desiredLength = (common_.displayLength > 0.0f) ? common_.displayLength : params_.length;
             float desiredThickness = (common_.displayThickness > 0.0f) ? common_.displayThickness : params_.thickness;
-            drewSprite = DrawWeaponSpriteFromPath(common_.weaponSpritePath,
-                                                  displayBase,
-                                                  displayState.angleDeg,
-                                                  desiredLength,
-                                                  desiredThickness,
-                                                  WHITE);
+            drewSprite = DrawWeaponSprite(sprites_.weapon,
+                                          displayBase,
+                                          displayState.angleDeg,
+                                          desiredLength,
+                                          desiredThickness,
+                                          WHITE);
         }
 
         if (!drewSprite) {
@@ -531,7 +588,7 @@ public:
             rect.height = params_.thickness;
 
             Vector2 pivot{0.0f, params_.thickness * 0.5f};
-            DrawRectanglePro(rect, pivot, centerAngle, common_.debugColor);
+            Counted::DrawRectanglePro(rect, pivot, centerAngle, common_.debugColor);
         }
     }
 
@@ -539,9 +596,9 @@ public:
                           float targetRadius,
                           std::uintptr_t targetId,
                           float targetImmunitySeconds,
-                          std::mt19937& rng,
+                          RandomStream& rng,
                           std::vector<ProjectileSystem::DamageEvent>& outEvents) override {
-        if (expired_ || common_.damage <= 0.0f || params_.length <= 0.0f) {
+        if (expired_ || hitStats_.damage <= 0.0f || params_.length <= 0.0f) {
             return;
         }
 
@@ -568,18 +625,7 @@ public:
             return;
         }
 
-        ProjectileSystem::DamageEvent event{};
-        event.amount = common_.damage;
-        event.suggestedImmunitySeconds = hitCooldown;
-
-        if (common_.criticalChance > 0.0f) {
-            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-            if (dist(rng) < common_.criticalChance) {
-                event.isCritical = true;
-                float multiplier = (common_.criticalMultiplier > 0.0f) ? common_.criticalMultiplier : 1.0f;
-                event.amount *= multiplier;
-            }
-        }
+        ProjectileSystem::DamageEvent event = RollDamageEvent(hitStats_, hitCooldown, rng);
 
         perTargetHits_.RecordHit(targetId, elapsed_);
         outEvents.push_back(event);
@@ -590,8 +636,10 @@ public:
     }
 
 private:
-    ProjectileCommonParams common_{};
-    SwingProjectileParams params_{};
+    const ProjectileCommonParams& common_;
+    ProjectileSprites sprites_{};
+    ProjectileHitStats hitStats_{};
+    const SwingProjectileParams& params_;
     Vector2 origin_{};
     const Vector2* followTarget_{nullptr};
     float startCenterDegrees_{0.0f};
@@ -605,12 +653,15 @@ private:
 class SpearProjectile final : public ProjectileSystem::ProjectileInstance {
 public:
     SpearProjectile(const ProjectileCommonParams& common,
+                    const ProjectileHitStats& hitStats,
                     const SpearProjectileParams& params,
                     Vector2 origin,
                     const Vector2* followTarget,
                     Vector2 followOffset,
                     Vector2 direction)
         : common_(common),
+          sprites_(ResolveProjectileSprites(common)),
+          hitStats_(hitStats),
           params_(params),
           origin_(origin),
           followTarget_(followTarget),
@@ -694,24 +745,24 @@ public:
         bool drewSprite = false;
 
         if (!common_.projectileSpritePath.empty()) {
-            drewSprite = DrawProjectileSpriteFromPath(common_.projectileSpritePath,
-                                                     center,
-                                                     drawAngle,
-                                                     spriteLength,
-                                                     spriteThickness,
-                                                     WHITE);
+            drewSprite = DrawProjectileSprite(sprites_.projectile,
+                                              center,
+                                              drawAngle,
+                                              spriteLength,
+                                              spriteThickness,
+                                              WHITE);
         }
 
         if (!drewSprite && !common_.weaponSpritePath.empty()) {
             Vector2 spriteBase = start;
             float desiredLength = (common_.displayLength > 0.0f) ? common_.displayLength : spriteLength;
             float desiredThickness = (common_.displayThickness > 0.0f) ? common_.displayThickness : spriteThickness;
-            drewSprite = DrawWeaponSpriteFromPath(common_.weaponSpritePath,
-                                                 spriteBase,
-                                                 drawAngle,
-                                                 desiredLength,
-                                                 desiredThickness,
-                                                 WHITE);
+            drewSprite = DrawWeaponSprite(sprites_.weapon,
+                                          spriteBase,
+                                          drawAngle,
+                                          desiredLength,
+                                          desiredThickness,
+                                          WHITE);
         }
 
         if (!drewSprite) {
@@ -721,8 +772,8 @@ public:
             Vector2 nearRight = Vector2Add(start, offset);
             Vector2 farRight = Vector2Add(end, offset);
             Vector2 farLeft = Vector2Subtract(end, offset);
-            DrawTriangle(nearLeft, nearRight, farRight, common_.debugColor);
-            DrawTriangle(nearLeft, farRight, farLeft, common_.debugColor);
+            Counted::DrawTriangle(nearLeft, nearRight, farRight, common_.debugColor);
+            Counted::DrawTriangle(nearLeft, farRight, farLeft, common_.debugColor);
         }
     }
 
@@ -730,9 +781,9 @@ public:
                           float targetRadius,
                           std::uintptr_t targetId,
                           float targetImmunitySeconds,
-                          std::mt19937& rng,
+                          RandomStream& rng,
                           std::vector<ProjectileSystem::DamageEvent>& outEvents) override {
-        if (common_.damage <= 0.0f || (expired_ && currentReach_ <= 1e-4f) || params_.length <= 1e-4f) {
+        if (hitStats_.damage <= 0.0f || (expired_ && currentReach_ <= 1e-4f) || params_.length <= 1e-4f) {
             return;
         }
 
@@ -757,18 +808,7 @@ public:
             return;
         }
 
-        ProjectileSystem::DamageEvent event{};
-        event.amount = common_.damage;
-        event.suggestedImmunitySeconds = hitCooldown;
-
-        if (common_.criticalChance > 0.0f) {
-            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-            if (dist(rng) < common_.criticalChance) {
-                event.isCritical = true;
-                float multiplier = (common_.criticalMultiplier > 0.0f) ? common_.criticalMultiplier : 1.0f;
-                event.amount *= multiplier;
-            }
-        }
+        ProjectileSystem::DamageEvent event = RollDamageEvent(hitStats_, hitCooldown, rng);
 
         perTargetHits_.RecordHit(targetId, elapsed_);
         outEvents.push_back(event);
@@ -779,8 +819,10 @@ public:
     }
 
 private:
-    ProjectileCommonParams common_{};
-    SpearProjectileParams params_{};
+    const ProjectileCommonParams& common_;
+    ProjectileSprites sprites_{};
+    ProjectileHitStats hitStats_{};
+    const SpearProjectileParams& params_;
     Vector2 origin_{};
     const Vector2* followTarget_{nullptr};
     Vector2 followOffset_{};
@@ -795,11 +837,14 @@ private:
 class FullCircleSwingProjectile final : public ProjectileSystem::ProjectileInstance {
 public:
     FullCircleSwingProjectile(const ProjectileCommonParams& common,
+                              const ProjectileHitStats& hitStats,
                               const FullCircleSwingParams& params,
                               Vector2 origin,
                               const Vector2* followTarget,
                               float initialAngleDegrees)
         : common_(common),
+          sprites_(ResolveProjectileSprites(common)),
+          hitStats_(hitStats),
           params_(params),
           origin_(origin),
           followTarget_(followTarget),
@@ -843,12 +888,12 @@ public:
             WeaponDisplayState displayState = ComputeWeaponDisplayState(common_, aimDir, currentAngleDeg_);
             displayState.angleDeg += common_.projectileRotationOffsetDegrees;
             Vector2 displayBase = Vector2Add(origin_, displayState.offset);
-            drewSprite = DrawWeaponSpriteFromPath(common_.weaponSpritePath,
-                                                 displayBase,
-                                                 displayState.angleDeg,
-                                                 common_.displayLength,
-                                                 common_.displayThickness,
-                                                 WHITE);
+            drewSprite = DrawWeaponSprite(sprites_.weapon,
+                                          displayBase,
+                                          displayState.angleDeg,
+                                          common_.displayLength,
+                                          common_.displayThickness,
+                                          WHITE);
         }
 
         if (!drewSprite) {
@@ -859,7 +904,7 @@ public:
             rect.height = params_.thickness;
 
             Vector2 pivot{0.0f, params_.thickness * 0.5f};
-            DrawRectanglePro(rect, pivot, currentAngleDeg_, common_.debugColor);
+            Counted::DrawRectanglePro(rect, pivot, currentAngleDeg_, common_.debugColor);
         }
     }
 
@@ -867,9 +912,9 @@ public:
                           float targetRadius,
                           std::uintptr_t targetId,
                           float targetImmunitySeconds,
-                          std::mt19937& rng,
+                          RandomStream& rng,
                           std::vector<ProjectileSystem::DamageEvent>& outEvents) override {
-        if (expired_ || common_.damage <= 0.0f || params_.length <= 1e-3f) {
+        if (expired_ || hitStats_.damage <= 0.0f || params_.length <= 1e-3f) {
             return;
         }
 
@@ -894,18 +939,7 @@ public:
             return;
         }
 
-        ProjectileSystem::DamageEvent event{};
-        event.amount = common_.damage;
-        event.suggestedImmunitySeconds = hitCooldown;
-
-        if (common_.criticalChance > 0.0f) {
-            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-            if (dist(rng) < common_.criticalChance) {
-                event.isCritical = true;
-                float multiplier = (common_.criticalMultiplier > 0.0f) ? common_.criticalMultiplier : 1.0f;
-                event.amount *= multiplier;
-            }
-        }
+        ProjectileSystem::DamageEvent event = RollDamageEvent(hitStats_, hitCooldown, rng);
 
         perTargetHits_.RecordHit(targetId, elapsed_);
         outEvents.push_back(event);
@@ -916,8 +950,10 @@ public:
     }
 
 private:
-    ProjectileCommonParams common_{};
-    FullCircleSwingParams params_{};
+    const ProjectileCommonParams& common_;
+    ProjectileSprites sprites_{};
+    ProjectileHitStats hitStats_{};
+    const FullCircleSwingParams& params_;
     Vector2 origin_{};
     const Vector2* followTarget_{nullptr};
     float currentAngleDeg_{0.0f};
@@ -936,6 +972,7 @@ public:
                                   Vector2 weaponOffset,
                                   Vector2 direction)
         : common_(common),
+          sprites_(ResolveProjectileSprites(common)),
           weaponOrigin_(weaponOrigin),
           followTarget_(followTarget),
           weaponOffset_(weaponOffset),
@@ -971,12 +1008,12 @@ public:
 
         Vector2 displayBase = Vector2Add(weaponOrigin_, displayState_.offset);
         if (!common_.weaponSpritePath.empty()) {
-            bool drewSprite = DrawWeaponSpriteFromPath(common_.weaponSpritePath,
-                                                       displayBase,
-                                                       displayState_.angleDeg,
-                                                       common_.displayLength,
-                                                       common_.displayThickness,
-                                                       WHITE);
+            bool drewSprite = DrawWeaponSprite(sprites_.weapon,
+                                               displayBase,
+                                               displayState_.angleDeg,
+                                               common_.displayLength,
+                                               common_.displayThickness,
+                                               WHITE);
             if (drewSprite) {
                 return;
             }
@@ -991,7 +1028,7 @@ public:
                           float,
                           std::uintptr_t,
                           float,
-                          std::mt19937&,
+                          RandomStream&,
                           std::vector<ProjectileSystem::DamageEvent>&) override {
         // Display-only projectiles do not generate damage events.
     }
@@ -1001,7 +1038,8 @@ public:
     }
 
 private:
-    ProjectileCommonParams common_{};
+    const ProjectileCommonParams& common_;
+    ProjectileSprites sprites_{};
     Vector2 weaponOrigin_{};
     const Vector2* followTarget_{nullptr};
     Vector2 weaponOffset_{};
@@ -1017,10 +1055,13 @@ private:
 class ThrownAmmunitionProjectile final : public ProjectileSystem::ProjectileInstance {
 public:
     ThrownAmmunitionProjectile(const ProjectileCommonParams& common,
+                               const ProjectileHitStats& hitStats,
                                const AmmunitionProjectileParams& params,
                                Vector2 position,
                                Vector2 direction)
         : common_(common),
+          sprites_(ResolveProjectileSprites(common)),
+          hitStats_(hitStats),
           params_(params),
           position_(position),
           direction_(Vector2Normalize(direction)) {
@@ -1049,14 +1090,14 @@ public:
 
         float projectileLength = (common_.projectileSize > 0.0f) ? common_.projectileSize : params_.radius * 2.0f;
         float projectileThickness = params_.radius * 2.0f;
-        bool drewProjectileSprite = DrawProjectileSpriteFromPath(common_.projectileSpritePath,
-                                                                 position_,
-                                                                 aimAngleDeg_ + common_.projectileRotationOffsetDegrees,
-                                                                 projectileLength,
-                                                                 projectileThickness,
-                                                                 WHITE);
+        bool drewProjectileSprite = DrawProjectileSprite(sprites_.projectile,
+                                                         position_,
+                                                         aimAngleDeg_ + common_.projectileRotationOffsetDegrees,
+                                                         projectileLength,
+                                                         projectileThickness,
+                                                         WHITE);
         if (!drewProjectileSprite) {
-            DrawCircleV(position_, params_.radius, common_.debugColor);
+            Counted::DrawCircleV(position_, params_.radius, common_.debugColor);
         }
     }
 
@@ -1064,10 +1105,10 @@ public:
                           float targetRadius,
                           std::uintptr_t targetId,
                           float targetImmunitySeconds,
-                          std::mt19937& rng,
+                          RandomStream& rng,
                           std::vector<ProjectileSystem::DamageEvent>& outEvents) override {
         (void)targetId;
-        if (damageApplied_ || expired_ || common_.damage <= 0.0f) {
+        if (damageApplied_ || expired_ || hitStats_.damage <= 0.0f) {
             return;
         }
 
@@ -1082,18 +1123,7 @@ public:
             return;
         }
 
-        ProjectileSystem::DamageEvent event{};
-        event.amount = common_.damage;
-        event.suggestedImmunitySeconds = std::max(common_.perTargetHitCooldownSeconds, 0.0f);
-
-        if (common_.criticalChance > 0.0f) {
-            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-            if (dist(rng) < common_.criticalChance) {
-                event.isCritical = true;
-                float multiplier = (common_.criticalMultiplier > 0.0f) ? common_.criticalMultiplier : 1.0f;
-                event.amount *= multiplier;
-            }
-        }
+        ProjectileSystem::DamageEvent event = RollDamageEvent(hitStats_, std::max(common_.perTargetHitCooldownSeconds, 0.0f), rng);
 
         damageApplied_ = true;
         expired_ = true;
@@ -1105,8 +1135,10 @@ public:
     }
 
 private:
-    ProjectileCommonParams common_{};
-    AmmunitionProjectileParams params_{};
+    const ProjectileCommonParams& common_;
+    ProjectileSprites sprites_{};
+    ProjectileHitStats hitStats_{};
+    const AmmunitionProjectileParams& params_;
     Vector2 position_{};
     Vector2 direction_{1.0f, 0.0f};
     float aimAngleDeg_{0.0f};
@@ -1120,6 +1152,7 @@ private:
 class ThrownLaserProjectile final : public ProjectileSystem::ProjectileInstance {
 public:
     ThrownLaserProjectile(const ProjectileCommonParams& common,
+                          const ProjectileHitStats& hitStats,
                           const LaserProjectileParams& params,
                           Vector2 origin,
                           const Vector2* followTarget,
@@ -1127,6 +1160,8 @@ public:
                           Vector2 direction,
                           Vector2 startOffset)
         : common_(common),
+          sprites_(ResolveProjectileSprites(common)),
+          hitStats_(hitStats),
           params_(params),
           origin_(origin),
           followTarget_(followTarget),
@@ -1185,14 +1220,14 @@ public:
         }
 
         Color beamTint = ColorAlpha(WHITE, beamAlpha);
-        bool drewBeamSprite = DrawBeamSpriteFromPath(common_.projectileSpritePath,
-                                                     beamStart,
-                                                     beamEnd,
-                                                     params_.thickness,
-                                                     beamTint);
+        bool drewBeamSprite = DrawBeamSprite(sprites_.projectile,
+                                             beamStart,
+                                             beamEnd,
+                                             params_.thickness,
+                                             beamTint);
         if (!drewBeamSprite) {
             Color lineColor = ColorAlpha(common_.debugColor, beamAlpha);
-            DrawLineEx(beamStart, beamEnd, params_.thickness, lineColor);
+            Counted::DrawLineEx(beamStart, beamEnd, params_.thickness, lineColor);
         }
     }
 
@@ -1200,9 +1235,9 @@ public:
                           float targetRadius,
                           std::uintptr_t targetId,
                           float targetImmunitySeconds,
-                          std::mt19937& rng,
+                          RandomStream& rng,
                           std::vector<ProjectileSystem::DamageEvent>& outEvents) override {
-        if (expired_ || common_.damage <= 0.0f || !IsBeamVisible()) {
+        if (expired_ || hitStats_.damage <= 0.0f || !IsBeamVisible()) {
             return;
         }
 
@@ -1226,18 +1261,7 @@ public:
             return;
         }
 
-        ProjectileSystem::DamageEvent event{};
-        event.amount = common_.damage;
-        event.suggestedImmunitySeconds = hitCooldown;
-
-        if (common_.criticalChance > 0.0f) {
-            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-            if (dist(rng) < common_.criticalChance) {
-                event.isCritical = true;
-                float multiplier = (common_.criticalMultiplier > 0.0f) ? common_.criticalMultiplier : 1.0f;
-                event.amount *= multiplier;
-            }
-        }
+        ProjectileSystem::DamageEvent event = RollDamageEvent(hitStats_, hitCooldown, rng);
 
         perTargetHits_.RecordHit(targetId, elapsed_);
         outEvents.push_back(event);
@@ -1259,8 +1283,10 @@ private:
         outEnd = Vector2Add(outStart, Vector2Scale(direction_, params_.length));
     }
 
-    ProjectileCommonParams common_{};
-    LaserProjectileParams params_{};
+    const ProjectileCommonParams& common_;
+    ProjectileSprites sprites_{};
+    ProjectileHitStats hitStats_{};
+    const LaserProjectileParams& params_;
     Vector2 origin_{};
     const Vector2* followTarget_{nullptr};
     Vector2 followOffset_{};
@@ -1276,48 +1302,131 @@ private:
 
 } // namespace
 
-// Inicializa RNG usado para spreads/críticos.
-ProjectileSystem::ProjectileSystem() : rng_(std::random_device{}()) {}
+// Cada slot guarda a instância por valor; monostate marca slot livre. Trocar o tipo com emplace reaproveita
+// a memória do slot, então um disparo não passa pelo heap.
+struct ProjectileSystem::ProjectileSlot {
+    std::variant<std::monostate,
+                 BluntProjectile,
+                 SwingProjectile,
+                 SpearProjectile,
+                 FullCircleSwingProjectile,
+                 RangedWeaponDisplayProjectile,
+                 ThrownAmmunitionProjectile,
+                 ThrownLaserProjectile>
+        instance;
+
+    ProjectileInstance& Get() {
+        return std::visit(
+            [](auto& projectile) -> ProjectileInstance& {
+                if constexpr (std::is_same_v<std::decay_t<decltype(projectile)>, std::monostate>) {
+                    std::abort(); // Slots ativos nunca ficam vazios
+                } else {
+                    return projectile;
+                }
+            },
+            instance);
+    }
+
+    const ProjectileInstance& Get() const {
+        return const_cast<ProjectileSlot&>(*this).Get();
+    }
+};
+
+// Começa com seed fixa (benchmarks reproduzíveis); o jogo chama SeedRandom a cada run.
+ProjectileSystem::ProjectileSystem() : rng_(kDefaultProjectileSeed) {
+    ++g_liveProjectileSystems;
+    slots_.reserve(kReservedProjectiles);
+    active_.reserve(kReservedProjectiles);
+    freeSlots_.reserve(kReservedProjectiles);
+    damageEvents_.reserve(kReservedProjectiles);
+}
 
-// Libera sprites carregados quando o sistema é destruído.
+// Devolve os sprites ao gerenciador apenas quando nenhum outro sistema ainda os usa.
 ProjectileSystem::~ProjectileSystem() {
-    ReleaseSpriteCache();
+    --g_liveProjectileSystems;
+    if (g_liveProjectileSystems <= 0) {
+        g_liveProjectileSystems = 0;
+        ReleaseSpriteHandles();
+    }
+}
+
+// Pega um slot livre (ou cresce o pool, se a reserva acabou) e o marca como ativo no fim da ordem de spawn.
+ProjectileSystem::ProjectileSlot& ProjectileSystem::AcquireSlot() {
+    std::uint32_t index = 0;
+    if (!freeSlots_.empty()) {
+        index = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(slots_.size());
+        slots_.emplace_back();
+    }
+    active_.push_back(index);
+    return slots_[index];
+}
+
+// Destrói a instância do slot e o devolve à lista livre (não mexe em active_).
+void ProjectileSystem::ReleaseSlot(std::uint32_t index) {
+    slots_[index].instance.emplace<std::monostate>();
+    freeSlots_.push_back(index);
 }
 
 // Atualiza todos os projéteis ativos e limpa os que expiraram.
 void ProjectileSystem::Update(float deltaSeconds) {
-    for (auto& projectile : projectiles_) {
-        projectile->Update(deltaSeconds);
+    AllocScope allocScope(AllocTag::Projectiles);
+    for (std::uint32_t index : active_) {
+        slots_[index].Get().Update(deltaSeconds);
     }
 
-    projectiles_.erase(
-        std::remove_if(projectiles_.begin(), projectiles_.end(), [](const std::unique_ptr<ProjectileInstance>& projectile) {
-            return projectile->IsExpired();
-        }),
-        projectiles_.end());
+    // Compacta active_ mantendo a ordem; slots expirados voltam ao pool.
+    std::size_t kept = 0;
+    for (std::uint32_t index : active_) {
+        if (slots_[index].Get().IsExpired()) {
+            ReleaseSlot(index);
+        } else {
+            active_[kept++] = index;
+        }
+    }
+    active_.resize(kept);
 }
 
 // Desenha cada projétil ativo (debug ou sprites customizados).
 void ProjectileSystem::Draw() const {
-    for (const auto& projectile : projectiles_) {
-        projectile->Draw();
+    RenderStatsScope statsScope(RenderSubsystem::Projectiles);
+    AllocScope allocScope(AllocTag::Projectiles);
+    for (std::uint32_t index : active_) {
+        slots_[index].Get().Draw();
     }
 }
 
-// Remove instantaneamente todos os projéteis, usado ao reiniciar a run.
+// Remove instantaneamente todos os projéteis, usado ao reiniciar a run. O pool continua reservado.
 void ProjectileSystem::Clear() {
-    projectiles_.clear();
+    for (std::uint32_t index : active_) {
+        ReleaseSlot(index);
+    }
+    active_.clear();
+}
+
+void ProjectileSystem::SeedRandom(std::uint64_t seed) {
+    rng_.Seed(seed);
+}
+
+// Retorna quantos projéteis seguem ativos no sistema.
+std::size_t ProjectileSystem::ActiveCount() const {
+    return active_.size();
 }
 
 // Instancia projéteis conforme blueprint e contexto atual do disparo.
-void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, const ProjectileSpawnContext& context) {
+void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint,
+                                       const ProjectileSpawnContext& context,
+                                       const ProjectileShotOverrides& overrides) {
+    AllocScope allocScope(AllocTag::Projectiles);
     if (blueprint.common.projectilesPerShot <= 0) {
         return;
     }
 
-    std::uniform_real_distribution<float> spreadDist(
-        -blueprint.common.randomSpreadDegrees * 0.5f,
-         blueprint.common.randomSpreadDegrees * 0.5f);
+    const ProjectileHitStats hitStats = ResolveHitStats(blueprint.common, overrides);
+
+    const float halfSpread = blueprint.common.randomSpreadDegrees * 0.5f;
 
     Vector2 baseAim = context.aimDirection;
     if (Vector2LengthSqr(baseAim) <= 1e-6f) {
@@ -1330,7 +1439,7 @@ void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, con
     float accumulatedDelay = 0.0f;
 
     for (int i = 0; i < projectileCount; ++i) {
-        float spreadOffset = (blueprint.common.randomSpreadDegrees > 0.0f) ? spreadDist(rng_) : 0.0f;
+        float spreadOffset = (blueprint.common.randomSpreadDegrees > 0.0f) ? rng_.RangeFloat(-halfSpread, halfSpread) : 0.0f;
         float staticAngleOffset = (i < static_cast<int>(blueprint.common.angleOffsetsDegrees.size()))
             ? blueprint.common.angleOffsetsDegrees[i]
             : 0.0f;
@@ -1363,13 +1472,14 @@ void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, con
                     ? context.followTarget
                     : nullptr;
 
-                projectiles_.push_back(std::make_unique<BluntProjectile>(
+                AcquireSlot().instance.emplace<BluntProjectile>(
                     blueprint.common,
+                    hitStats,
                     blueprint.blunt,
                     spawnOrigin,
                     followPtr,
                     startCenter,
-                    endCenter));
+                    endCenter);
                 break;
             }
             case ProjectileKind::Swing: {
@@ -1381,13 +1491,14 @@ void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, con
                     ? context.followTarget
                     : nullptr;
 
-                projectiles_.push_back(std::make_unique<SwingProjectile>(
+                AcquireSlot().instance.emplace<SwingProjectile>(
                     blueprint.common,
+                    hitStats,
                     blueprint.swing,
                     spawnOrigin,
                     followPtr,
                     startCenter,
-                    endCenter));
+                    endCenter);
                 break;
             }
             case ProjectileKind::Spear: {
@@ -1407,13 +1518,14 @@ void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, con
                     followOffset = Vector2Subtract(anchor, *followPtr);
                 }
 
-                projectiles_.push_back(std::make_unique<SpearProjectile>(
+                AcquireSlot().instance.emplace<SpearProjectile>(
                     blueprint.common,
+                    hitStats,
                     blueprint.spear,
                     anchor,
                     followPtr,
                     followOffset,
-                    aimDir));
+                    aimDir);
                 break;
             }
             case ProjectileKind::FullCircleSwing: {
@@ -1421,12 +1533,13 @@ void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, con
                     ? context.followTarget
                     : nullptr;
 
-                projectiles_.push_back(std::make_unique<FullCircleSwingProjectile>(
+                AcquireSlot().instance.emplace<FullCircleSwingProjectile>(
                     blueprint.common,
+                    hitStats,
                     blueprint.fullCircle,
                     spawnOrigin,
                     followPtr,
-                    finalAngle));
+                    finalAngle);
                 break;
             }
             case ProjectileKind::Ranged: {
@@ -1441,12 +1554,12 @@ void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, con
                 rangedDisplayBase = Vector2Add(spawnOrigin, rangedDisplayState.offset);
                 hasRangedDisplayState = true;
 
-                projectiles_.push_back(std::make_unique<RangedWeaponDisplayProjectile>(
+                AcquireSlot().instance.emplace<RangedWeaponDisplayProjectile>(
                     blueprint.common,
                     spawnOrigin,
                     followPtr,
                     weaponOffset,
-                    aimDir));
+                    aimDir);
                 break;
             }
         }
@@ -1465,11 +1578,12 @@ void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, con
                             origin = Vector2Add(origin, Vector2Scale(aimDir, forward));
                         }
 
-                        projectiles_.push_back(std::make_unique<ThrownAmmunitionProjectile>(
+                        AcquireSlot().instance.emplace<ThrownAmmunitionProjectile>(
                             thrown.common,
+                            ResolveHitStats(thrown.common, overrides),
                             thrown.ammunition,
                             origin,
-                            aimDir));
+                            aimDir);
                         break;
                     }
                     case ThrownProjectileKind::Laser: {
@@ -1503,14 +1617,15 @@ void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, con
                             followOffset = Vector2Subtract(origin, *followPtr);
                         }
 
-                        projectiles_.push_back(std::make_unique<ThrownLaserProjectile>(
+                        AcquireSlot().instance.emplace<ThrownLaserProjectile>(
                             thrown.common,
+                            ResolveHitStats(thrown.common, overrides),
                             thrown.laser,
                             origin,
                             followPtr,
                             followOffset,
                             aimDir,
-                            startOffset));
+                            startOffset);
                         break;
                     }
                 }
@@ -1526,17 +1641,16 @@ void ProjectileSystem::SpawnProjectile(const ProjectileBlueprint& blueprint, con
     (void)accumulatedDelay;
 }
 
-std::vector<ProjectileSystem::DamageEvent> ProjectileSystem::CollectDamageEvents(const Vector2& targetCenter,
-                                                                                float targetRadius,
-                                                                                std::uintptr_t targetId,
-                                                                                float targetImmunitySeconds) {
-    // Percorre lista de projéteis acumulando todos os impactos contra o alvo especificado.
-    std::vector<DamageEvent> events;
-    events.reserve(projectiles_.size());
-
-    for (auto& projectile : projectiles_) {
-        projectile->CollectHitEvents(targetCenter, targetRadius, targetId, targetImmunitySeconds, rng_, events);
+const std::vector<ProjectileSystem::DamageEvent>& ProjectileSystem::CollectDamageEvents(const Vector2& targetCenter,
+                                                                                       float targetRadius,
+                                                                                       std::uintptr_t targetId,
+                                                                                       float targetImmunitySeconds) {
+    AllocScope allocScope(AllocTag::Projectiles);
+    // Percorre lista de projéteis acumulando todos os impactos contra o alvo especificado no buffer reaproveitado.
+    damageEvents_.clear();
+    for (std::uint32_t index : active_) {
+        slots_[index].Get().CollectHitEvents(targetCenter, targetRadius, targetId, targetImmunitySeconds, rng_, damageEvents_);
     }
 
-    return events;
+    return damageEvents_;
 }
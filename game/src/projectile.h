@@ -2,9 +2,11 @@
 
 #include "raylib.h"
 
+#include "game_random.h"
+#include "texture_manager.h"
+
+#include <cstddef>
 #include <cstdint>
-#include <memory>
-#include <random>
 #include <string>
 #include <vector>
 
@@ -27,6 +29,14 @@ enum class WeaponDisplayMode {
     AimAligned
 };
 
+// Handles das texturas de arma/projétil de um blueprint, resolvidos pelo ProjectileSystem no primeiro disparo.
+// epoch diferente do atual (0 = nunca resolvido, ou handles já devolvidos) força nova resolução pelo caminho.
+struct ProjectileSpriteHandles {
+    std::uint32_t epoch{0};
+    TextureHandle weapon{kInvalidTextureHandle};
+    TextureHandle projectile{kInvalidTextureHandle};
+};
+
 // Conjunto de parâmetros compartilhados entre todos os tipos de projéteis.
 struct ProjectileCommonParams {
     float damage{0.0f};
@@ -53,6 +63,8 @@ struct ProjectileCommonParams {
     float criticalChance{0.0f};
     float criticalMultiplier{1.0f};
     float perTargetHitCooldownSeconds{0.0f};
+    // Cache preenchido no spawn (não vem dos arquivos de dados); mutable porque os blueprints circulam como const.
+    mutable ProjectileSpriteHandles spriteHandles{};
 };
 
 // Configuração específica para ataques circulares de curto alcance (martelos etc.).
@@ -137,6 +149,16 @@ struct ProjectileBlueprint {
     std::vector<ThrownProjectileBlueprint> thrownProjectiles{};
 };
 
+// Valores calculados por disparo (dano/crítico) aplicados sobre o blueprint compartilhado.
+// Evita copiar o ProjectileBlueprint inteiro a cada tiro apenas para trocar esses campos.
+struct ProjectileShotOverrides {
+    bool overrideDamage{false};
+    float damage{0.0f};
+    bool overrideCritical{false};
+    float criticalChance{0.0f};
+    float criticalMultiplier{1.0f};
+};
+
 // Informações de contexto usadas no momento do disparo (origem, alvo, direção).
 struct ProjectileSpawnContext {
     Vector2 origin{};
@@ -155,8 +177,17 @@ public:
     void Update(float deltaSeconds);
     void Draw() const;
     void Clear();
-
-    void SpawnProjectile(const ProjectileBlueprint& blueprint, const ProjectileSpawnContext& context);
+    // Reinicia o RNG de spreads/críticos; o jogo passa um filho do stream Combat para a run ser reproduzível.
+    void SeedRandom(std::uint64_t seed);
+    // Quantidade de instâncias ativas (usado por benchmarks e métricas de debug).
+    std::size_t ActiveCount() const;
+
+    // O blueprint é referenciado (não copiado) pelas instâncias e precisa sobreviver a elas. Os blueprints de armas
+    // vivem em GameData e o hot reload os sobrescreve no lugar; por isso projéteis vivos são descartados (Clear)
+    // antes de PublishGameData reescrever as armas (beforePublish de PollGameDataHotReload).
+    void SpawnProjectile(const ProjectileBlueprint& blueprint,
+                         const ProjectileSpawnContext& context,
+                         const ProjectileShotOverrides& overrides = ProjectileShotOverrides{});
 
     // Evento de dano retornado ao detectar colisão entre projétil e alvo.
     struct DamageEvent {
@@ -165,17 +196,30 @@ public:
         float suggestedImmunitySeconds{0.0f};
     };
 
-    // Coleta impactos que ocorreram contra determinado alvo circular.
-    std::vector<DamageEvent> CollectDamageEvents(const Vector2& targetCenter,
-                                                float targetRadius,
-                                                std::uintptr_t targetId = 0,
-                                                float targetImmunitySeconds = 0.0f);
+    // Coleta impactos que ocorreram contra determinado alvo circular. Devolve um buffer interno reaproveitado
+    // entre chamadas: a referência vale até a próxima chamada de CollectDamageEvents neste sistema.
+    const std::vector<DamageEvent>& CollectDamageEvents(const Vector2& targetCenter,
+                                                        float targetRadius,
+                                                        std::uintptr_t targetId = 0,
+                                                        float targetImmunitySeconds = 0.0f);
 
     struct ProjectileInstance;
+    // Slot do pool: guarda qualquer tipo de projétil por valor (definido em projectile.cpp).
+    struct ProjectileSlot;
 
 private:
-    // Lista ativa de projéteis em voo.
-    std::vector<std::unique_ptr<ProjectileInstance>> projectiles_;
+    // Capacidade reservada na construção; disparos só alocam se a população passar disso.
+    static constexpr std::size_t kReservedProjectiles = 256;
+
+    ProjectileSlot& AcquireSlot();
+    void ReleaseSlot(std::uint32_t index);
+
+    // Pool de instâncias: slots livres são reaproveitados, então disparar não aloca no heap.
+    std::vector<ProjectileSlot> slots_;
+    // Índices dos slots ativos na ordem de spawn (mesma ordem de atualização e desenho).
+    std::vector<std::uint32_t> active_;
+    std::vector<std::uint32_t> freeSlots_;
+    std::vector<DamageEvent> damageEvents_; // Buffer devolvido por CollectDamageEvents
     // RNG usado para spreads, críticos etc.
-    std::mt19937 rng_;
+    RandomStream rng_;
 };
@@ -0,0 +1,102 @@
+#include "render_queue.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Layout da chave (64 bits): camada [63..56] | profundidade [55..24] | prioridade [23..20] | textura [19..0].
+constexpr int kLayerShift = 56;
+constexpr int kDepthShift = 24;
+constexpr int kPriorityShift = 20;
+constexpr std::uint64_t kPriorityMask = 0xFull;
+constexpr std::uint64_t kTextureMask = (1ull << kPriorityShift) - 1ull;
+
+// Converte Y em inteiro sem sinal que preserva a ordem (pixels; negativos antes dos positivos).
+std::uint32_t QuantizeDepth(float sortY) {
+    float clamped = std::clamp(std::floor(sortY),
+                               static_cast<float>(std::numeric_limits<std::int32_t>::min() / 2),
+                               static_cast<float>(std::numeric_limits<std::int32_t>::max() / 2));
+    return static_cast<std::uint32_t>(static_cast<std::int32_t>(clamped)) ^ 0x80000000u;
+}
+
+std::uint64_t MakeSortKey(RenderLayer layer, float sortY, RenderPriority priority, unsigned int textureId) {
+    return (static_cast<std::uint64_t>(layer) << kLayerShift) |
+           (static_cast<std::uint64_t>(QuantizeDepth(sortY)) << kDepthShift) |
+           ((static_cast<std::uint64_t>(priority) & kPriorityMask) << kPriorityShift) |
+           (static_cast<std::uint64_t>(textureId) & kTextureMask);
+}
+
+} // namespace
+
+void RenderQueue::Clear() {
+    commands_.clear();
+    entries_.clear();
+}
+
+void RenderQueue::Submit(RenderLayer layer, float sortY, RenderPriority priority, unsigned int textureId, const RenderCommand& command) {
+    if (command.draw == nullptr && command.drawBatch == nullptr) {
+        return;
+    }
+    entries_.push_back(SortEntry{MakeSortKey(layer, sortY, priority, textureId), static_cast<std::uint32_t>(commands_.size())});
+    commands_.push_back(command);
+}
+
+void RenderQueue::Sort() {
+    const std::size_t count = entries_.size();
+    if (count < 2) {
+        return;
+    }
+
+    // Radix LSD de 8 bits por passada; passadas em que todas as chaves caem no mesmo balde
+    // (camada única, faixa de Y estreita) são puladas. Estável: empates mantêm a ordem de submissão.
+    scratch_.resize(count);
+    for (int shift = 0; shift < 64; shift += 8) {
+        std::array<std::size_t, 256> offsets{};
+        for (const SortEntry& entry : entries_) {
+            ++offsets[(entry.key >> shift) & 0xFFu];
+        }
+        if (offsets[(entries_.front().key >> shift) & 0xFFu] == count) {
+            continue;
+        }
+
+        std::size_t running = 0;
+        for (std::size_t& bucket : offsets) {
+            std::size_t bucketCount = bucket;
+            bucket = running;
+            running += bucketCount;
+        }
+        for (const SortEntry& entry : entries_) {
+            scratch_[offsets[(entry.key >> shift) & 0xFFu]++] = entry;
+        }
+        entries_.swap(scratch_);
+    }
+}
+
+void RenderQueue::Flush(RenderLayer layer) {
+    const std::uint64_t layerBits = static_cast<std::uint64_t>(layer);
+    auto first = std::lower_bound(entries_.begin(), entries_.end(), layerBits, [](const SortEntry& entry, std::uint64_t value) {
+        return (entry.key >> kLayerShift) < value;
+    });
+    auto inLayer = [&](std::vector<SortEntry>::const_iterator it) {
+        return it != entries_.end() && (it->key >> kLayerShift) == layerBits;
+    };
+
+    for (auto it = first; inLayer(it);) {
+        const RenderCommand& command = commands_[it->index];
+        if (command.drawBatch == nullptr) {
+            command.draw(command);
+            ++it;
+            continue;
+        }
+
+        batchScratch_.clear();
+        while (inLayer(it) && commands_[it->index].drawBatch == command.drawBatch) {
+            batchScratch_.push_back(&commands_[it->index]);
+            ++it;
+        }
+        command.drawBatch(batchScratch_.data(), batchScratch_.size());
+    }
+}
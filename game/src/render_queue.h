@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Camadas da cena na ordem em que são descarregadas (valores menores desenham primeiro).
+enum class RenderLayer : std::uint8_t {
+    World = 0,     // Props, portas laterais, inimigos e jogador ordenados por Y
+    AboveMask = 1, // Portas frontais desenhadas depois das máscaras de corredor
+};
+
+// Desempate entre registros na mesma profundidade quantizada (valores maiores desenham na frente).
+// Fica acima da textura na chave, então o id da textura GPU nunca decide quem aparece na frente.
+enum class RenderPriority : std::uint8_t {
+    Prop = 0,   // Forja, loja, baú e portas
+    Enemy = 1,
+    Player = 2, // Pés no mesmo Y da âncora de um prop: jogador na frente
+};
+
+struct RenderCommand;
+
+// Função que desenha um registro; recebe o próprio comando para ler object/context/params.
+using RenderCommandFn = void (*)(const RenderCommand& command);
+
+// Função que desenha uma sequência de registros adjacentes na ordem final (ex.: lote de inimigos).
+using RenderBatchFn = void (*)(const RenderCommand* const* commands, std::size_t count);
+
+// Registro de desenho submetido por quadro. Os ponteiros devem continuar válidos até o Flush.
+struct RenderCommand {
+    RenderCommandFn draw{nullptr};
+    const void* object{nullptr};  // Entidade desenhada (porta, inimigo, prop...)
+    const void* context{nullptr}; // Dono dos recursos de desenho (ex.: RoomRenderer)
+    float params[4]{};            // Valores específicos do callback (visibilidade, posição...)
+    RenderBatchFn drawBatch{nullptr}; // Quando definido substitui draw: vizinhos com o mesmo drawBatch são desenhados juntos
+};
+
+// Fila de desenho ordenada por camada, profundidade (Y do chão), prioridade e textura.
+// Todos os drawables submetem uma vez por quadro; Sort ordena com radix sort estável e
+// Flush desenha cada camada em sequência, agrupando sprites da mesma página na mesma linha de Y.
+class RenderQueue {
+public:
+    // Descarta registros do quadro anterior mantendo a capacidade alocada.
+    void Clear();
+
+    // Recebe camada, Y de ordenação (quantizado para pixels), prioridade de desempate, id da textura GPU
+    // (0 = primitivas) e comando.
+    void Submit(RenderLayer layer, float sortY, RenderPriority priority, unsigned int textureId, const RenderCommand& command);
+
+    // Ordena todos os registros uma única vez; chamado após a última submissão do quadro.
+    void Sort();
+
+    // Desenha, em ordem, os registros da camada informada. Requer Sort() no quadro atual.
+    // Registros consecutivos com o mesmo drawBatch são entregues em uma única chamada.
+    void Flush(RenderLayer layer);
+
+    std::size_t Size() const { return commands_.size(); }
+
+private:
+    struct SortEntry {
+        std::uint64_t key{0};
+        std::uint32_t index{0};
+    };
+
+    std::vector<RenderCommand> commands_;
+    std::vector<SortEntry> entries_;
+    std::vector<SortEntry> scratch_;
+    std::vector<const RenderCommand*> batchScratch_;
+};
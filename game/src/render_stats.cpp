@@ -0,0 +1,145 @@
+#include "render_stats.h"
+
+#include <fstream>
+#include <iostream>
+
+const char* RenderSubsystemName(RenderSubsystem subsystem) {
+    switch (subsystem) {
+        case RenderSubsystem::Room:
+            return "room";
+        case RenderSubsystem::Enemies:
+            return "enemies";
+        case RenderSubsystem::Projectiles:
+            return "projectiles";
+        case RenderSubsystem::Hud:
+            return "hud";
+        case RenderSubsystem::Inventory:
+            return "inventory";
+        case RenderSubsystem::Other:
+        case RenderSubsystem::Count:
+            break;
+    }
+    return "other";
+}
+
+#if defined(GAME_PROFILER)
+
+namespace {
+
+// Estado do quadro atual; desenhos só acontecem na thread principal.
+RenderFrameStats g_currentFrame{};
+RenderFrameStats g_lastFrame{};
+RenderSubsystem g_currentSubsystem = RenderSubsystem::Other;
+unsigned int g_lastTextureId = 0;
+bool g_hasLastTexture = false;
+bool g_frameActive = false;
+std::uint64_t g_frameCounter = 0;
+
+std::ofstream g_csv;
+
+void WriteCsvFrame(const RenderFrameStats& frame) {
+    for (std::size_t i = 0; i < frame.subsystems.size(); ++i) {
+        const RenderSubsystemCounters& counters = frame.subsystems[i];
+        g_csv << frame.frameIndex << ',' << RenderSubsystemName(static_cast<RenderSubsystem>(i)) << ','
+              << counters.drawCalls << ',' << counters.textureSwitches << ',' << counters.primitives << '\n';
+    }
+}
+
+} // namespace
+
+RenderStatsScope::RenderStatsScope(RenderSubsystem subsystem)
+    : previous_(g_currentSubsystem) {
+    g_currentSubsystem = subsystem;
+}
+
+RenderStatsScope::~RenderStatsScope() {
+    g_currentSubsystem = previous_;
+}
+
+void BeginRenderStatsFrame() {
+    g_currentFrame = RenderFrameStats{};
+    g_currentFrame.frameIndex = g_frameCounter++;
+    g_currentSubsystem = RenderSubsystem::Other;
+    g_hasLastTexture = false;
+    g_frameActive = true;
+}
+
+void EndRenderStatsFrame() {
+    if (!g_frameActive) {
+        return;
+    }
+    g_frameActive = false;
+
+    RenderSubsystemCounters totals{};
+    for (const RenderSubsystemCounters& counters : g_currentFrame.subsystems) {
+        totals.drawCalls += counters.drawCalls;
+        totals.textureSwitches += counters.textureSwitches;
+        totals.primitives += counters.primitives;
+    }
+    g_currentFrame.totals = totals;
+    g_lastFrame = g_currentFrame;
+
+    if (g_csv.is_open()) {
+        WriteCsvFrame(g_lastFrame);
+    }
+}
+
+void RecordRenderCall(unsigned int textureId, std::uint32_t primitives) {
+    if (!g_frameActive) {
+        return;
+    }
+    RenderSubsystemCounters& counters = g_currentFrame.subsystems[static_cast<std::size_t>(g_currentSubsystem)];
+    ++counters.drawCalls;
+    counters.primitives += primitives;
+    if (!g_hasLastTexture || g_lastTextureId != textureId) {
+        ++counters.textureSwitches;
+        g_lastTextureId = textureId;
+        g_hasLastTexture = true;
+    }
+}
+
+const RenderFrameStats& GetLastRenderFrameStats() {
+    return g_lastFrame;
+}
+
+bool StartRenderStatsCsv(const std::string& path) {
+    StopRenderStatsCsv();
+    g_csv.open(path, std::ios::out | std::ios::trunc);
+    if (!g_csv) {
+        std::cerr << "[RenderStats] Nao foi possivel criar " << path << std::endl;
+        return false;
+    }
+    g_csv << "frame,subsystem,draw_calls,texture_switches,primitives\n";
+    return true;
+}
+
+void StopRenderStatsCsv() {
+    if (g_csv.is_open()) {
+        g_csv.close();
+    }
+}
+
+bool IsRenderStatsCsvActive() {
+    return g_csv.is_open();
+}
+
+namespace Counted {
+
+std::uint32_t CountVisibleGlyphs(const char* text) {
+    if (text == nullptr) {
+        return 0;
+    }
+    std::uint32_t glyphs = 0;
+    for (const unsigned char* cursor = reinterpret_cast<const unsigned char*>(text); *cursor != 0; ++cursor) {
+        unsigned char byte = *cursor;
+        if ((byte & 0xC0u) == 0x80u || byte == ' ' || byte == '\n' || byte == '\t') {
+            continue;
+        }
+        ++glyphs;
+    }
+    return glyphs;
+}
+
+} // namespace Counted
+
+#endif
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "raylib.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Contadores de desenho por subsistema, compilados apenas com -DGAME_PROFILER (make PROFILER=TRUE).
+// Sem a flag os wrappers de Counted:: viram chamadas diretas à Raylib e os escopos não fazem nada.
+
+// Subsistemas medidos; desenhos fora de um RenderStatsScope contam como Other.
+enum class RenderSubsystem : std::uint8_t {
+    Other = 0,
+    Room,
+    Enemies,
+    Projectiles,
+    Hud,
+    Inventory,
+    Count
+};
+
+// Totais de um subsistema em um quadro.
+struct RenderSubsystemCounters {
+    std::uint32_t drawCalls{0};
+    std::uint32_t textureSwitches{0}; // Desenhos cuja textura difere da anterior (quebra de lote do rlgl)
+    std::uint32_t primitives{0};      // Triângulos/segmentos estimados a partir da forma desenhada
+};
+
+// Retrato de um quadro completo (entre BeginRenderStatsFrame e EndRenderStatsFrame).
+struct RenderFrameStats {
+    std::uint64_t frameIndex{0};
+    std::array<RenderSubsystemCounters, static_cast<std::size_t>(RenderSubsystem::Count)> subsystems{};
+    RenderSubsystemCounters totals{};
+};
+
+// Id usado para desenhos de formas (a Raylib usa a textura branca padrão, que também quebra lotes).
+constexpr unsigned int kShapesTextureId = 0;
+
+// Nome curto exibido no overlay/CSV.
+const char* RenderSubsystemName(RenderSubsystem subsystem);
+
+#if defined(GAME_PROFILER)
+
+// Marca o subsistema atual enquanto viva; escopos aninhados restauram o anterior ao sair.
+class RenderStatsScope {
+public:
+    explicit RenderStatsScope(RenderSubsystem subsystem);
+    ~RenderStatsScope();
+
+    RenderStatsScope(const RenderStatsScope&) = delete;
+    RenderStatsScope& operator=(const RenderStatsScope&) = delete;
+
+private:
+    RenderSubsystem previous_;
+};
+
+// Chamado logo após BeginDrawing; zera os contadores do quadro.
+void BeginRenderStatsFrame();
+
+// Chamado antes de EndDrawing; publica o quadro e grava uma linha por subsistema no CSV ativo.
+void EndRenderStatsFrame();
+
+// Registra um desenho no subsistema atual (ignorado fora de um quadro).
+void RecordRenderCall(unsigned int textureId, std::uint32_t primitives);
+
+// Último quadro publicado por EndRenderStatsFrame.
+const RenderFrameStats& GetLastRenderFrameStats();
+
+// Abre (truncando) o CSV e passa a gravar todos os quadros; false se o arquivo não puder ser criado.
+bool StartRenderStatsCsv(const std::string& path);
+void StopRenderStatsCsv();
+bool IsRenderStatsCsvActive();
+
+#else
+
+class RenderStatsScope {
+public:
+    explicit RenderStatsScope(RenderSubsystem) {}
+};
+
+inline void BeginRenderStatsFrame() {}
+inline void EndRenderStatsFrame() {}
+inline void RecordRenderCall(unsigned int, std::uint32_t) {}
+inline bool StartRenderStatsCsv(const std::string&) { return false; }
+inline void StopRenderStatsCsv() {}
+inline bool IsRenderStatsCsvActive() { return false; }
+
+#endif
+
+// Wrappers finos sobre os pontos de entrada de desenho da Raylib usados pelos subsistemas medidos.
+// Estimativas de primitivas seguem a implementação da Raylib (retângulo = 2 triângulos, círculo = 36 segmentos).
+namespace Counted {
+
+#if defined(GAME_PROFILER)
+// Glifos visíveis (codepoints UTF-8 exceto espaços/quebras), cada um vira um quad.
+std::uint32_t CountVisibleGlyphs(const char* text);
+#endif
+
+inline void DrawTexturePro(Texture2D texture, Rectangle source, Rectangle dest, Vector2 origin, float rotation, Color tint) {
+    RecordRenderCall(texture.id, 2);
+    ::DrawTexturePro(texture, source, dest, origin, rotation, tint);
+}
+
+inline void DrawRectangle(int posX, int posY, int width, int height, Color color) {
+    RecordRenderCall(kShapesTextureId, 2);
+    ::DrawRectangle(posX, posY, width, height, color);
+}
+
+inline void DrawRectangleRec(Rectangle rec, Color color) {
+    RecordRenderCall(kShapesTextureId, 2);
+    ::DrawRectangleRec(rec, color);
+}
+
+inline void DrawRectanglePro(Rectangle rec, Vector2 origin, float rotation, Color color) {
+    RecordRenderCall(kShapesTextureId, 2);
+    ::DrawRectanglePro(rec, origin, rotation, color);
+}
+
+inline void DrawRectangleLinesEx(Rectangle rec, float lineThick, Color color) {
+    RecordRenderCall(kShapesTextureId, 8);
+    ::DrawRectangleLinesEx(rec, lineThick, color);
+}
+
+inline void DrawCircleV(Vector2 center, float radius, Color color) {
+    RecordRenderCall(kShapesTextureId, 36);
+    ::DrawCircleV(center, radius, color);
+}
+
+inline void DrawLineEx(Vector2 startPos, Vector2 endPos, float thick, Color color) {
+    RecordRenderCall(kShapesTextureId, 2);
+    ::DrawLineEx(startPos, endPos, thick, color);
+}
+
+inline void DrawTriangle(Vector2 v1, Vector2 v2, Vector2 v3, Color color) {
+    RecordRenderCall(kShapesTextureId, 1);
+    ::DrawTriangle(v1, v2, v3, color);
+}
+
+inline void DrawTextEx(Font font, const char* text, Vector2 position, float fontSize, float spacing, Color tint) {
+#if defined(GAME_PROFILER)
+    RecordRenderCall(font.texture.id, CountVisibleGlyphs(text) * 2u);
+#endif
+    ::DrawTextEx(font, text, position, fontSize, spacing, tint);
+}
+
+} // namespace Counted
@@ -3,12 +3,13 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
-#include <random>
 #include <unordered_set>
 #include <utility>
 
 #include "room_types.h"
+#include "alloc_stats.h"
 #include "chest.h"
+#include "game_random.h"
 
 // Responsável por gerar salas vizinhas, configurar portas e recursos especiais.
 namespace {
@@ -19,18 +20,6 @@ constexpr int MIN_ROOM_SPACING_TILES = 2;
 constexpr int MIN_CORRIDOR_LENGTH_TILES = MIN_ROOM_SPACING_TILES * 2;
 constexpr int MAX_CORRIDOR_LENGTH_TILES = MIN_CORRIDOR_LENGTH_TILES * 3;
 
-// Sorteia inteiro inclusivo no intervalo dado para layouts e portas.
-int RandomInt(std::mt19937_64& rng, int minInclusive, int maxInclusive) {
-    std::uniform_int_distribution<int> dist(minInclusive, maxInclusive);
-    return dist(rng);
-}
-
-// Sorteia double inclusivo, usado para pesos/probabilidades.
-double RandomDouble(std::mt19937_64& rng, double minInclusive, double maxInclusive) {
-    std::uniform_real_distribution<double> dist(minInclusive, maxInclusive);
-    return dist(rng);
-}
-
 // Guarda retângulos propostos para sala/corredor durante tentativa de posicionamento.
 struct RoomPlacement {
     TileRect roomBounds{};
@@ -320,6 +309,7 @@ bool RoomManager::MoveToNeighbor(Direction direction) {
 
 // Assegura geração de salas adjacentes dentro de um raio BFS simples.
 void RoomManager::EnsureNeighborsGenerated(const RoomCoords& coords, int radius) {
+    AllocScope allocScope(AllocTag::Rooms);
     if (radius < 0) {
         radius = 0;
     }
@@ -437,7 +427,7 @@ bool RoomManager::TryGenerateDoorTarget(Room& room, Doorway& door) {
 // Tenta instanciar nova sala respeitando espaçamento e tipo aleatório.
 Room& RoomManager::CreateRoomFromDoor(Room& originRoom, Doorway& originDoor) {
     const RoomCoords targetCoords = originRoom.GetCoords() + ToDirectionOffset(originDoor.direction);
-    std::mt19937_64 rng(MakeRoomSeed(worldSeed_, targetCoords));
+    RandomStream rng(MakeRoomSeed(worldSeed_, targetCoords));
 
     const int maxAttempts = 12;
 
@@ -466,17 +456,17 @@ Room& RoomManager::CreateRoomFromDoor(Room& originRoom, Doorway& originDoor) {
                 heightTiles = 12;
                 break;
             default:
-                widthTiles = RandomInt(rng, 10, 20);
-                heightTiles = RandomInt(rng, 10, 20);
+                widthTiles = rng.RangeInt(10, 20);
+                heightTiles = rng.RangeInt(10, 20);
                 break;
         }
 
         const int wallLength = WallLengthForDirection(widthTiles, heightTiles, Opposite(originDoor.direction));
         const int maxOffset = std::max(1, wallLength - originDoor.width - 1);
-        entranceOffset = RandomInt(rng, 1, maxOffset);
+        entranceOffset = rng.RangeInt(1, maxOffset);
 
         if (originDoor.corridorLength < MIN_CORRIDOR_LENGTH_TILES || originDoor.corridorLength > MAX_CORRIDOR_LENGTH_TILES) {
-            originDoor.corridorLength = RandomInt(rng, MIN_CORRIDOR_LENGTH_TILES, MAX_CORRIDOR_LENGTH_TILES);
+            originDoor.corridorLength = rng.RangeInt(MIN_CORRIDOR_LENGTH_TILES, MAX_CORRIDOR_LENGTH_TILES);
         }
 
         RoomPlacement placement = ComputePlacement(originRoom, originDoor, widthTiles, heightTiles, entranceOffset);
@@ -672,7 +662,7 @@ void RoomManager::ConfigureDoors(Room& room, std::optional<Direction> entranceDi
     RoomLayout& layout = room.Layout();
     RoomCoords coords = room.GetCoords();
 
-    std::mt19937_64 rng(MakeRoomSeed(worldSeed_, coords, 0xABCD));
+    RandomStream rng(MakeRoomSeed(worldSeed_, coords, 0xABCD));
 
     for (Direction direction : {Direction::North, Direction::South, Direction::East, Direction::West}) {
         if (entranceDirection && direction == *entranceDirection) {
@@ -774,10 +764,10 @@ void RoomManager::ConfigureDoors(Room& room, std::optional<Direction> entranceDi
 
         std::vector<OffsetCandidate> orderedOffsets;
         orderedOffsets.reserve(offsets.size());
-        double proximityWeight = RandomDouble(rng, 0.0, 1.0);
+        double proximityWeight = rng.RangeDouble(0.0, 1.0);
         for (int offset : offsets) {
             double distance = std::abs(offset - anchorOffset);
-            double jitter = RandomDouble(rng, 0.0, 1.0);
+            double jitter = rng.RangeDouble(0.0, 1.0);
             double score = proximityWeight * distance + (1.0 - proximityWeight) * jitter;
             orderedOffsets.push_back({offset, score});
         }
@@ -795,7 +785,7 @@ void RoomManager::ConfigureDoors(Room& room, std::optional<Direction> entranceDi
             for (int len = MAX_CORRIDOR_LENGTH_TILES; len >= MIN_CORRIDOR_LENGTH_TILES; --len) {
                 corridorOptions.push_back(len);
             }
-            std::shuffle(corridorOptions.begin(), corridorOptions.end(), rng);
+            rng.Shuffle(corridorOptions.begin(), corridorOptions.end());
 
             for (int corridorLength : corridorOptions) {
                 Doorway stub{};
@@ -821,7 +811,7 @@ void RoomManager::ConfigureDoors(Room& room, std::optional<Direction> entranceDi
         return false;
     };
 
-    std::shuffle(candidates.begin(), candidates.end(), rng);
+    rng.Shuffle(candidates.begin(), candidates.end());
 
     for (Direction direction : candidates) {
         if (openDoors >= targetDoorGoal) {
@@ -867,7 +857,7 @@ void RoomManager::AlignWithNeighbor(Room& room, Direction direction, Room& neigh
 
 // Define qual tipo de sala será criada em determinadas coordenadas.
 RoomType RoomManager::PickRoomType(const RoomCoords& coords) {
-    std::mt19937_64 rng(MakeRoomSeed(worldSeed_, coords, static_cast<std::uint64_t>(roomsDiscovered_)));
+    RandomStream rng(MakeRoomSeed(worldSeed_, coords, static_cast<std::uint64_t>(roomsDiscovered_)));
 
     double bossChance = 0.0;
     double normalChance = 80.0;
@@ -882,7 +872,7 @@ RoomType RoomManager::PickRoomType(const RoomCoords& coords) {
     const double chestChance = 10.0;
 
     double total = normalChance + forgeChance + shopChance + chestChance + bossChance;
-    double pick = RandomDouble(rng, 0.0, total);
+    double pick = rng.RangeDouble(0.0, total);
 
     if (pick < normalChance) {
         return RoomType::Normal;
@@ -941,9 +931,8 @@ BiomeType RoomManager::PickInitialBiome() {
         BiomeType::Dungeon
     };
 
-    std::mt19937_64 rng(MakeRoomSeed(worldSeed_, RoomCoords{0, 0}, 0xB10B1EULL));
-    std::uniform_int_distribution<std::size_t> dist(0, kAvailableBiomes.size() - 1);
-    return kAvailableBiomes[dist(rng)];
+    RandomStream rng(MakeRoomSeed(worldSeed_, RoomCoords{0, 0}, 0xB10B1EULL));
+    return kAvailableBiomes[static_cast<std::size_t>(rng.RangeInt(0, static_cast<int>(kAvailableBiomes.size()) - 1))];
 }
 
 // Verifica se o retângulo proposto para nova sala colide com salas existentes.
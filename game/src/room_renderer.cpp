@@ -3,11 +3,12 @@
 #include <algorithm>
 #include <cstdint>
 #include <functional>
-#include <iostream>
-#include <random>
 #include <unordered_set>
 #include <vector>
 
+#include "alloc_stats.h"
+#include "game_random.h"
+#include "render_stats.h"
 #include "room_types.h"
 
 namespace {
@@ -28,29 +29,12 @@ Rectangle TileRectToPixels(const TileRect& rect) {
     return Rectangle{TileToPixel(rect.x), TileToPixel(rect.y), static_cast<float>(rect.width * TILE_SIZE), static_cast<float>(rect.height * TILE_SIZE)};
 }
 
-// Tenta carregar textura de mobiliário aplicando filtro adequado, logando falhas.
-Texture2D LoadFurnitureTexture(const char* path) {
-    Texture2D texture{};
+// Registra textura de mobiliário no gerenciador com filtro bilinear (carregada no primeiro desenho).
+TextureHandle AcquireFurnitureTexture(const char* path) {
     if (path == nullptr) {
-        return texture;
-    }
-    if (!FileExists(path)) {
-        std::cerr << "[RoomRenderer] Texture not found: " << path << std::endl;
-        return texture;
-    }
-    texture = LoadTexture(path);
-    if (texture.id != 0) {
-        SetTextureFilter(texture, TEXTURE_FILTER_BILINEAR);
-    }
-    return texture;
-}
-
-// Descarrega textura caso seja válida para evitar vazamentos.
-void UnloadTextureIfValid(Texture2D& texture) {
-    if (texture.id != 0) {
-        UnloadTexture(texture);
-        texture = Texture2D{};
+        return kInvalidTextureHandle;
     }
+    return AcquireTexture(path, TEXTURE_FILTER_BILINEAR);
 }
 
 // Coordenada discreta de tile que pode ser armazenada em hash set.
@@ -108,11 +92,10 @@ Color RandomWallColorForTile(int tileX, int tileY, Color baseColor) {
     std::uint64_t seedY = static_cast<std::uint64_t>(static_cast<std::int64_t>(tileY));
     std::uint64_t seed = seedX * 0x9e3779b97f4a7c15ULL ^ seedY;
     seed ^= (seed >> 23);
-    std::mt19937_64 rng(seed);
-    std::uniform_int_distribution<int> delta(-12, 12);
-    baseColor.r = ClampToByte(static_cast<int>(baseColor.r) + delta(rng));
-    baseColor.g = ClampToByte(static_cast<int>(baseColor.g) + delta(rng));
-    baseColor.b = ClampToByte(static_cast<int>(baseColor.b) + delta(rng));
+    RandomStream rng(seed);
+    baseColor.r = ClampToByte(static_cast<int>(baseColor.r) + rng.RangeInt(-12, 12));
+    baseColor.g = ClampToByte(static_cast<int>(baseColor.g) + rng.RangeInt(-12, 12));
+    baseColor.b = ClampToByte(static_cast<int>(baseColor.b) + rng.RangeInt(-12, 12));
     return baseColor;
 }
 
@@ -167,12 +150,12 @@ void DrawNorthWallColumn(int tileX, int topTileY, const Color& baseColor) {
     float height = static_cast<float>(TILE_SIZE) * kWallHeightTiles;
 
     Rectangle wallRect{x, bottom - height, static_cast<float>(TILE_SIZE), height};
-    DrawRectangleRec(wallRect, baseColor);
+    Counted::DrawRectangleRec(wallRect, baseColor);
 
     const float trimHeight = height * 0.2f;
     if (trimHeight > 0.0f) {
         Rectangle trimRect{x, bottom - height, static_cast<float>(TILE_SIZE), trimHeight};
-        DrawRectangleRec(trimRect, OffsetRgb(baseColor, 25));
+        Counted::DrawRectangleRec(trimRect, OffsetRgb(baseColor, 25));
     }
 }
 
@@ -183,24 +166,24 @@ void DrawSouthWallColumn(int tileX, int floorTileY, const Color& baseColor) {
     float tileTop = TileToPixel(floorTileY);
 
     Rectangle baseRect{x, tileTop, tileSize, tileSize};
-    DrawRectangleRec(baseRect, baseColor);
+    Counted::DrawRectangleRec(baseRect, baseColor);
 
     const float highlightHeight = tileSize * 0.18f;
     if (highlightHeight > 0.0f) {
         Rectangle highlightRect{x, tileTop, tileSize, highlightHeight};
-        DrawRectangleRec(highlightRect, OffsetRgb(baseColor, 24));
+        Counted::DrawRectangleRec(highlightRect, OffsetRgb(baseColor, 24));
     }
 
     const float midShadeHeight = tileSize * 0.32f;
     if (midShadeHeight > 0.0f) {
         Rectangle midShadeRect{x, tileTop + highlightHeight, tileSize, midShadeHeight};
-        DrawRectangleRec(midShadeRect, OffsetRgb(baseColor, 8));
+        Counted::DrawRectangleRec(midShadeRect, OffsetRgb(baseColor, 8));
     }
 
     const float shadowHeight = tileSize * 0.24f;
     if (shadowHeight > 0.0f) {
         Rectangle shadowRect{x, tileTop + tileSize - shadowHeight, tileSize, shadowHeight};
-        DrawRectangleRec(shadowRect, OffsetRgb(baseColor, -34));
+        Counted::DrawRectangleRec(shadowRect, OffsetRgb(baseColor, -34));
     }
 }
 
@@ -289,42 +272,44 @@ RoomGeometry BuildRoomGeometry(const RoomLayout& layout) {
 
 // Carrega texturas necessárias para renderizar props e portas.
 RoomRenderer::RoomRenderer() {
-    forgeTexture_ = LoadFurnitureTexture("assets/img/furniture/forja/Forja.png");
-    forgeBrokenTexture_ = LoadFurnitureTexture("assets/img/furniture/forja/Forja_broken.png");
-    shopTextures_[0] = LoadFurnitureTexture("assets/img/furniture/loja/Loja1.png");
-    shopTextures_[1] = LoadFurnitureTexture("assets/img/furniture/loja/Loja2.png");
-    shopTextures_[2] = LoadFurnitureTexture("assets/img/furniture/loja/Loja3.png");
-    chestTexture_ = LoadFurnitureTexture("assets/img/furniture/bau/Bau.png");
-    biomeDoorTextures_[0].front = LoadFurnitureTexture("assets/img/furniture/door/Caverna_door_front.png");
-    biomeDoorTextures_[0].side = LoadFurnitureTexture("assets/img/furniture/door/Caverna_door_side.png");
-    biomeDoorTextures_[1].front = LoadFurnitureTexture("assets/img/furniture/door/Dungeon_door_front.png");
-    biomeDoorTextures_[1].side = LoadFurnitureTexture("assets/img/furniture/door/Dungeon_door_side.png");
-    biomeDoorTextures_[2].front = LoadFurnitureTexture("assets/img/furniture/door/Mansao_door_front.png");
-    biomeDoorTextures_[2].side = LoadFurnitureTexture("assets/img/furniture/door/Mansao_door_side.png");
-}
-
-// Libera texturas carregadas na destruição do renderer.
+    forgeTexture_ = AcquireFurnitureTexture("assets/img/furniture/forja/Forja.png");
+    forgeBrokenTexture_ = AcquireFurnitureTexture("assets/img/furniture/forja/Forja_broken.png");
+    shopTextures_[0] = AcquireFurnitureTexture("assets/img/furniture/loja/Loja1.png");
+    shopTextures_[1] = AcquireFurnitureTexture("assets/img/furniture/loja/Loja2.png");
+    shopTextures_[2] = AcquireFurnitureTexture("assets/img/furniture/loja/Loja3.png");
+    chestTexture_ = AcquireFurnitureTexture("assets/img/furniture/bau/Bau.png");
+    biomeDoorTextures_[0].front = AcquireFurnitureTexture("assets/img/furniture/door/Caverna_door_front.png");
+    biomeDoorTextures_[0].side = AcquireFurnitureTexture("assets/img/furniture/door/Caverna_door_side.png");
+    biomeDoorTextures_[1].front = AcquireFurnitureTexture("assets/img/furniture/door/Dungeon_door_front.png");
+    biomeDoorTextures_[1].side = AcquireFurnitureTexture("assets/img/furniture/door/Dungeon_door_side.png");
+    biomeDoorTextures_[2].front = AcquireFurnitureTexture("assets/img/furniture/door/Mansao_door_front.png");
+    biomeDoorTextures_[2].side = AcquireFurnitureTexture("assets/img/furniture/door/Mansao_door_side.png");
+}
+
+// Devolve as referências de textura na destruição do renderer.
 RoomRenderer::~RoomRenderer() {
-    UnloadTextureIfValid(forgeTexture_);
-    UnloadTextureIfValid(forgeBrokenTexture_);
-    for (Texture2D& texture : shopTextures_) {
-        UnloadTextureIfValid(texture);
+    ReleaseTexture(forgeTexture_);
+    ReleaseTexture(forgeBrokenTexture_);
+    for (TextureHandle texture : shopTextures_) {
+        ReleaseTexture(texture);
     }
-    UnloadTextureIfValid(chestTexture_);
+    ReleaseTexture(chestTexture_);
     UnloadDoorTextures();
 }
 
 // Desenha piso, corredores e paredes de fundo da sala.
 void RoomRenderer::DrawRoomBackground(const Room& room, bool isActive, float visibility) const {
+    RenderStatsScope statsScope(RenderSubsystem::Room);
+    AllocScope allocScope(AllocTag::Rooms);
     const RoomLayout& layout = room.Layout();
     RoomGeometry geometry = BuildRoomGeometry(layout);
 
     Color floorColor = ColorAlpha(FloorColorForBiome(room.GetBiome()), visibility);
-    DrawRectangleRec(geometry.floorRect, floorColor);
+    Counted::DrawRectangleRec(geometry.floorRect, floorColor);
 
     Color corridorColor = ColorAlpha(OffsetRgb(FloorColorForBiome(room.GetBiome()), 14), visibility);
     for (const TileRect& corridor : geometry.corridorRects) {
-        DrawRectangleRec(TileRectToPixels(corridor), corridorColor);
+        Counted::DrawRectangleRec(TileRectToPixels(corridor), corridorColor);
     }
 
     Color wallBase = ColorAlpha(WallBaseColorForBiome(room.GetBiome()), visibility);
@@ -339,6 +324,8 @@ void RoomRenderer::DrawRoomBackground(const Room& room, bool isActive, float vis
 
 // Desenha paredes frontais e elementos principais (forja, loja, baú) conforme visibilidade.
 void RoomRenderer::DrawRoomForeground(const Room& room, bool isActive, float visibility) const {
+    RenderStatsScope statsScope(RenderSubsystem::Room);
+    AllocScope allocScope(AllocTag::Rooms);
     const RoomLayout& layout = room.Layout();
     RoomGeometry geometry = BuildRoomGeometry(layout);
 
@@ -369,12 +356,12 @@ void RoomRenderer::DrawForgeForRoom(const Room& room, bool isActive, float visib
 
 // Renderiza sprite específico da forja (inteira ou quebrada).
 void RoomRenderer::DrawForgeSprite(const ForgeInstance& forge, bool isActive, float visibility) const {
-    const Texture2D* texture = (forge.state == ForgeState::Broken) ? &forgeBrokenTexture_ : &forgeTexture_;
-    if (texture->id == 0) {
+    const TextureRegion& region = GetTextureRegion((forge.state == ForgeState::Broken) ? forgeBrokenTexture_ : forgeTexture_);
+    if (region.texture.id == 0) {
         return;
     }
 
-    Rectangle src{0.0f, 0.0f, static_cast<float>(texture->width), static_cast<float>(texture->height)};
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     const float tileSize = static_cast<float>(TILE_SIZE);
     const float desiredWidth = tileSize * 2.6f;
     float scale = (src.width > 0.0f) ? (desiredWidth / src.width) : 1.0f;
@@ -394,11 +381,12 @@ void RoomRenderer::DrawForgeSprite(const ForgeInstance& forge, bool isActive, fl
     }
     tint = ColorAlpha(tint, visibility);
 
-    DrawTexturePro(*texture, src, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
+    DrawTextureRegion(region, src, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
 }
 
 // Versão utilitária para desenhar forja com visibilidade total.
 void RoomRenderer::DrawForgeInstance(const ForgeInstance& forge, bool isActive) const {
+    RenderStatsScope statsScope(RenderSubsystem::Room);
     DrawForgeSprite(forge, isActive, 1.0f);
 }
 
@@ -414,12 +402,12 @@ void RoomRenderer::DrawShopForRoom(const Room& room, bool isActive, float visibi
 // Renderiza sprite da loja aplicando variante configurada.
 void RoomRenderer::DrawShopSprite(const ShopInstance& shop, bool isActive, float visibility) const {
     int variant = std::clamp(shop.textureVariant, 0, static_cast<int>(shopTextures_.size()) - 1);
-    const Texture2D& texture = shopTextures_[variant];
-    if (texture.id == 0) {
+    const TextureRegion& region = GetTextureRegion(shopTextures_[variant]);
+    if (region.texture.id == 0) {
         return;
     }
 
-    Rectangle src{0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     const float tileSize = static_cast<float>(TILE_SIZE);
     const float desiredWidth = tileSize * 3.2f;
     float scale = (src.width > 0.0f) ? (desiredWidth / src.width) : 1.0f;
@@ -435,11 +423,12 @@ void RoomRenderer::DrawShopSprite(const ShopInstance& shop, bool isActive, float
 
     Color tint = isActive ? WHITE : Color{255, 255, 255, 180};
     tint = ColorAlpha(tint, visibility);
-    DrawTexturePro(texture, src, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
+    DrawTextureRegion(region, src, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
 }
 
 // Helper para desenhar loja em contexto externo (HUD/debug).
 void RoomRenderer::DrawShopInstance(const ShopInstance& shop, bool isActive) const {
+    RenderStatsScope statsScope(RenderSubsystem::Room);
     DrawShopSprite(shop, isActive, 1.0f);
 }
 
@@ -454,11 +443,12 @@ void RoomRenderer::DrawChestForRoom(const Room& room, bool isActive, float visib
 
 // Renderiza sprite do baú compartilhado entre cofres comuns/player.
 void RoomRenderer::DrawChestSprite(const Chest& chest, bool isActive, float visibility) const {
-    if (chestTexture_.id == 0) {
+    const TextureRegion& region = GetTextureRegion(chestTexture_);
+    if (region.texture.id == 0) {
         return;
     }
 
-    Rectangle src{0.0f, 0.0f, static_cast<float>(chestTexture_.width), static_cast<float>(chestTexture_.height)};
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     const float tileSize = static_cast<float>(TILE_SIZE);
     const float desiredWidth = tileSize * 1.6f;
     float scale = (src.width > 0.0f) ? (desiredWidth / src.width) : 1.0f;
@@ -474,11 +464,12 @@ void RoomRenderer::DrawChestSprite(const Chest& chest, bool isActive, float visi
 
     Color tint = isActive ? WHITE : Color{255, 255, 255, 190};
     tint = ColorAlpha(tint, visibility);
-    DrawTexturePro(chestTexture_, src, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
+    DrawTextureRegion(region, src, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
 }
 
 // Versão direta para desenhar baú sem fade de visibilidade.
 void RoomRenderer::DrawChestInstance(const Chest& chest, bool isActive) const {
+    RenderStatsScope statsScope(RenderSubsystem::Room);
     DrawChestSprite(chest, isActive, 1.0f);
 }
 
@@ -500,34 +491,49 @@ const RoomRenderer::DoorTextureSet& RoomRenderer::DoorTexturesForBiome(BiomeType
 // Libera texturas específicas das portas de cada bioma.
 void RoomRenderer::UnloadDoorTextures() {
     for (DoorTextureSet& set : biomeDoorTextures_) {
-        UnloadTextureIfValid(set.front);
-        UnloadTextureIfValid(set.side);
+        ReleaseTexture(set.front);
+        ReleaseTexture(set.side);
+        set = DoorTextureSet{};
     }
 }
 
+unsigned int RoomRenderer::ForgeTextureId(const ForgeInstance& forge) const {
+    return GetTextureRegion((forge.state == ForgeState::Broken) ? forgeBrokenTexture_ : forgeTexture_).texture.id;
+}
+
+unsigned int RoomRenderer::ShopTextureId(const ShopInstance& shop) const {
+    int variant = std::clamp(shop.textureVariant, 0, static_cast<int>(shopTextures_.size()) - 1);
+    return GetTextureRegion(shopTextures_[variant]).texture.id;
+}
+
+unsigned int RoomRenderer::ChestTextureId() const {
+    return GetTextureRegion(chestTexture_).texture.id;
+}
+
+unsigned int RoomRenderer::DoorTextureId(Direction direction, BiomeType biome) const {
+    const DoorTextureSet& textures = DoorTexturesForBiome(biome);
+    bool frontView = (direction == Direction::North || direction == Direction::South);
+    return GetTextureRegion(frontView ? textures.front : textures.side).texture.id;
+}
+
 // Desenha sprite de porta orientado conforme direção e com alpha customizado.
 void RoomRenderer::DrawDoorSprite(const Rectangle& hitbox,
                                   Direction direction,
                                   BiomeType biome,
                                   float alpha) const {
+    RenderStatsScope statsScope(RenderSubsystem::Room);
     if (alpha <= 0.0f) {
         return;
     }
 
     const DoorTextureSet& textures = DoorTexturesForBiome(biome);
-    const Texture2D* texture = nullptr;
     bool frontView = (direction == Direction::North || direction == Direction::South);
-    if (frontView) {
-        texture = &textures.front;
-    } else {
-        texture = &textures.side;
-    }
-
-    if (texture == nullptr || texture->id == 0) {
+    const TextureRegion& region = GetTextureRegion(frontView ? textures.front : textures.side);
+    if (region.texture.id == 0) {
         return;
     }
 
-    Rectangle src{0.0f, 0.0f, static_cast<float>(texture->width), static_cast<float>(texture->height)};
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     Rectangle dest{};
 
     if (frontView) {
@@ -561,5 +567,5 @@ void RoomRenderer::DrawDoorSprite(const Rectangle& hitbox,
     }
 
     Color tint{255, 255, 255, static_cast<unsigned char>(std::clamp(alpha, 0.0f, 1.0f) * 255.0f)};
-    DrawTexturePro(*texture, src, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
+    DrawTextureRegion(region, src, dest, Vector2{0.0f, 0.0f}, 0.0f, tint);
 }
@@ -2,6 +2,7 @@
 
 #include "raylib.h"
 #include "room.h"
+#include "texture_manager.h"
 
 #include <array>
 
@@ -25,6 +26,12 @@ public:
                         BiomeType biome,
                         float alpha) const;
 
+    // Ids das texturas GPU (página do atlas) de cada prop/porta; usados como chave de lote na fila de renderização.
+    unsigned int ForgeTextureId(const ForgeInstance& forge) const;
+    unsigned int ShopTextureId(const ShopInstance& shop) const;
+    unsigned int ChestTextureId() const;
+    unsigned int DoorTextureId(Direction direction, BiomeType biome) const;
+
 private:
     // Helpers que carregam/desenham props individuais dentro da sala.
     void DrawForgeForRoom(const Room& room, bool isActive, float visibility) const;
@@ -36,17 +43,18 @@ private:
 
     // Texturas frontais/laterais das portas por bioma.
     struct DoorTextureSet {
-        Texture2D front{};
-        Texture2D side{};
+        TextureHandle front{kInvalidTextureHandle};
+        TextureHandle side{kInvalidTextureHandle};
     };
 
-    // Seleciona e descarrega texturas conforme o bioma atual.
+    // Seleciona e devolve ao gerenciador as texturas conforme o bioma atual.
     const DoorTextureSet& DoorTexturesForBiome(BiomeType biome) const;
     void UnloadDoorTextures();
 
-    Texture2D forgeTexture_{};
-    Texture2D forgeBrokenTexture_{};
-    std::array<Texture2D, 3> shopTextures_{};
-    Texture2D chestTexture_{};
+    // Handles no gerenciador de texturas compartilhado.
+    TextureHandle forgeTexture_{kInvalidTextureHandle};
+    TextureHandle forgeBrokenTexture_{kInvalidTextureHandle};
+    std::array<TextureHandle, 3> shopTextures_{};
+    TextureHandle chestTexture_{kInvalidTextureHandle};
     std::array<DoorTextureSet, 3> biomeDoorTextures_{};
 };
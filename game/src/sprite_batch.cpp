@@ -0,0 +1,149 @@
+#include "sprite_batch.h"
+
+#include "render_stats.h"
+#include "rlgl.h"
+
+#include <cstdint>
+#include <utility>
+
+namespace {
+
+// Cada quad consome 4 vértices no buffer do rlgl.
+constexpr int kVerticesPerQuad = 4;
+
+// Emite um quad alinhado aos eixos; UVs normalizados já resolvidos pelo chamador.
+void EmitQuad(const Rectangle& dest, float u0, float v0, float u1, float v1) {
+    float x0 = dest.x;
+    float y0 = dest.y;
+    float x1 = dest.x + dest.width;
+    float y1 = dest.y + dest.height;
+
+    // Mesma ordem de vértices usada por DrawTexturePro (anti-horária a partir do canto superior esquerdo).
+    rlTexCoord2f(u0, v0);
+    rlVertex2f(x0, y0);
+    rlTexCoord2f(u0, v1);
+    rlVertex2f(x0, y1);
+    rlTexCoord2f(u1, v1);
+    rlVertex2f(x1, y1);
+    rlTexCoord2f(u1, v0);
+    rlVertex2f(x1, y0);
+}
+
+} // namespace
+
+void SpriteBatch::Clear() {
+    sprites_.clear();
+    circles_.clear();
+    bars_.clear();
+}
+
+void SpriteBatch::AddSprite(const TextureRegion& region, Rectangle source, Rectangle dest, Vector2 origin, Color tint) {
+    if (region.texture.id == 0 || region.texture.width <= 0 || region.texture.height <= 0) {
+        return;
+    }
+
+    SpriteInstance instance{};
+    instance.textureId = region.texture.id;
+    instance.textureWidth = static_cast<float>(region.texture.width);
+    instance.textureHeight = static_cast<float>(region.texture.height);
+    if (source.width < 0.0f) {
+        instance.flipX = true;
+        source.width = -source.width;
+    }
+    if (source.height < 0.0f) {
+        instance.flipY = true;
+        source.height = -source.height;
+    }
+    source.x += region.bounds.x;
+    source.y += region.bounds.y;
+    instance.source = source;
+    instance.dest = Rectangle{dest.x - origin.x, dest.y - origin.y, dest.width, dest.height};
+    instance.tint = tint;
+    sprites_.push_back(instance);
+}
+
+void SpriteBatch::AddFallbackCircle(Vector2 center, float radius, Color color) {
+    circles_.push_back(CircleInstance{center, radius, color});
+}
+
+void SpriteBatch::AddHealthBar(Rectangle background, Color backgroundColor, Rectangle fill, Color fillColor) {
+    bars_.push_back(BarQuad{background, backgroundColor});
+    if (fill.width > 0.0f && fill.height > 0.0f) {
+        bars_.push_back(BarQuad{fill, fillColor});
+    }
+}
+
+void SpriteBatch::Flush() {
+    FlushSprites();
+    for (const CircleInstance& circle : circles_) {
+        Counted::DrawCircleV(circle.center, circle.radius, circle.color);
+    }
+    FlushBars();
+    Clear();
+}
+
+void SpriteBatch::FlushSprites() {
+    std::size_t runStart = 0;
+    while (runStart < sprites_.size()) {
+        // Sequência de instâncias da mesma textura vira um único rlBegin/rlEnd.
+        const unsigned int textureId = sprites_[runStart].textureId;
+        std::size_t runEnd = runStart;
+        while (runEnd < sprites_.size() && sprites_[runEnd].textureId == textureId) {
+            ++runEnd;
+        }
+        RecordRenderCall(textureId, static_cast<std::uint32_t>((runEnd - runStart) * 2));
+
+        rlSetTexture(textureId);
+        rlBegin(RL_QUADS);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        for (std::size_t i = runStart; i < runEnd; ++i) {
+            const SpriteInstance& instance = sprites_[i];
+            // Buffer cheio: o rlgl desenha o lote atual e reinicia mantendo textura/modo.
+            rlCheckRenderBatchLimit(kVerticesPerQuad);
+            float u0 = instance.source.x / instance.textureWidth;
+            float v0 = instance.source.y / instance.textureHeight;
+            float u1 = (instance.source.x + instance.source.width) / instance.textureWidth;
+            float v1 = (instance.source.y + instance.source.height) / instance.textureHeight;
+            if (instance.flipX) {
+                std::swap(u0, u1);
+            }
+            if (instance.flipY) {
+                std::swap(v0, v1);
+            }
+            rlColor4ub(instance.tint.r, instance.tint.g, instance.tint.b, instance.tint.a);
+            EmitQuad(instance.dest, u0, v0, u1, v1);
+        }
+        rlEnd();
+        rlSetTexture(0);
+
+        runStart = runEnd;
+    }
+}
+
+void SpriteBatch::FlushBars() {
+    if (bars_.empty()) {
+        return;
+    }
+
+    // Usa o retângulo branco da textura de formas, como DrawRectangleRec, para continuar no mesmo lote do texto/formas.
+    Texture2D shapes = GetShapesTexture();
+    Rectangle shapesRect = GetShapesTextureRectangle();
+    float u = 0.5f;
+    float v = 0.5f;
+    if (shapes.id != 0 && shapes.width > 0 && shapes.height > 0) {
+        u = (shapesRect.x + shapesRect.width * 0.5f) / static_cast<float>(shapes.width);
+        v = (shapesRect.y + shapesRect.height * 0.5f) / static_cast<float>(shapes.height);
+    }
+    RecordRenderCall(kShapesTextureId, static_cast<std::uint32_t>(bars_.size() * 2));
+
+    rlSetTexture(shapes.id);
+    rlBegin(RL_QUADS);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    for (const BarQuad& bar : bars_) {
+        rlCheckRenderBatchLimit(kVerticesPerQuad);
+        rlColor4ub(bar.color.r, bar.color.g, bar.color.b, bar.color.a);
+        EmitQuad(bar.rect, u, v, u, v);
+    }
+    rlEnd();
+    rlSetTexture(0);
+}
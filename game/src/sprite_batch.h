@@ -0,0 +1,61 @@
+#pragma once
+
+#include "raylib.h"
+
+#include <vector>
+
+#include "texture_manager.h"
+
+// Acumula quads texturizados (sprites de inimigos, glifos de números de dano) e os envia ao rlgl em poucos lotes:
+// quads consecutivos da mesma textura (página do atlas/fonte) viram um único rlBegin/rlEnd e todas as
+// barras de vida saem juntas no fim, com a textura de formas, sem alternar textura por instância.
+class SpriteBatch {
+public:
+    // Descarta instâncias acumuladas mantendo a capacidade.
+    void Clear();
+
+    // Mesmo contrato de DrawTextureRegion (source relativo ao sprite, largura negativa espelha), sem rotação.
+    void AddSprite(const TextureRegion& region, Rectangle source, Rectangle dest, Vector2 origin, Color tint);
+
+    // Fallback geométrico para inimigos cujo sprite ainda não está na GPU.
+    void AddFallbackCircle(Vector2 center, float radius, Color color);
+
+    // Barra de vida: fundo e preenchimento (fill com largura 0 é ignorado).
+    void AddHealthBar(Rectangle background, Color backgroundColor, Rectangle fill, Color fillColor);
+
+    // Emite sprites, depois fallbacks, depois barras, e limpa o lote.
+    void Flush();
+
+    bool Empty() const { return sprites_.empty() && circles_.empty() && bars_.empty(); }
+
+private:
+    // Quad já resolvido para coordenadas da textura (UV em pixels da página) e da tela.
+    struct SpriteInstance {
+        unsigned int textureId{0};
+        float textureWidth{0.0f};
+        float textureHeight{0.0f};
+        Rectangle source{};
+        Rectangle dest{};
+        bool flipX{false};
+        bool flipY{false};
+        Color tint{};
+    };
+
+    struct CircleInstance {
+        Vector2 center{};
+        float radius{0.0f};
+        Color color{};
+    };
+
+    struct BarQuad {
+        Rectangle rect{};
+        Color color{};
+    };
+
+    void FlushSprites();
+    void FlushBars();
+
+    std::vector<SpriteInstance> sprites_;
+    std::vector<CircleInstance> circles_;
+    std::vector<BarQuad> bars_;
+};
@@ -0,0 +1,467 @@
+#include "texture_manager.h"
+
+#include "asset_archive.h"
+#include "render_stats.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Estado de carregamento de cada entrada (Pending = decodificando em worker ou aguardando upload).
+enum class TextureLoadState {
+    Unloaded,
+    Pending,
+    Ready,
+    Failed
+};
+
+// Entrada única por caminho; o slot nunca é reaproveitado para outro arquivo, então handles não ficam obsoletos.
+struct TextureEntry {
+    std::string path;
+    TextureRegion region{};  // O que os chamadores desenham (página do atlas ou textura própria)
+    Texture2D ownTexture{};  // Só para sprites grandes demais para o atlas
+    int atlasPage{-1};       // Retângulo reservado no atlas é mantido para recarregamentos
+    Rectangle atlasBounds{};
+    int filter{TEXTURE_FILTER_POINT};
+    int refCount{0};
+    TextureLoadState state{TextureLoadState::Unloaded};
+    std::uint32_t loadSerial{0}; // Descarta resultados de pedidos anteriores a um Release/reaquisição
+};
+
+// Página de atlas com alocação por prateleiras (shelf packing); uma página por filtro de textura.
+struct AtlasPage {
+    Texture2D texture{};
+    int filter{TEXTURE_FILTER_POINT};
+    int cursorX{0};
+    int cursorY{0};
+    int shelfHeight{0};
+};
+
+constexpr int kAtlasPageSize = 2048;
+constexpr int kAtlasMaxSpriteSize = 1024; // Sprites maiores ficam em textura própria
+constexpr int kAtlasPadding = 2;          // Borda transparente evita sangramento entre sprites vizinhos
+
+// Pedido de decodificação enviado aos workers (só carrega cópia do caminho, nunca toca g_entries).
+struct DecodeJob {
+    TextureHandle handle{kInvalidTextureHandle};
+    std::uint32_t serial{0};
+    std::string path;
+};
+
+// Imagem decodificada em CPU aguardando upload na thread principal.
+struct DecodeResult {
+    TextureHandle handle{kInvalidTextureHandle};
+    std::uint32_t serial{0};
+    Image image{};
+};
+
+std::vector<TextureEntry> g_entries{};
+std::unordered_map<std::string, TextureHandle> g_handleByPath{};
+std::vector<AtlasPage> g_atlasPages{};
+TextureManagerStats g_stats{};
+
+// Pool de decodificação.
+std::vector<std::thread> g_workers{};
+std::mutex g_jobMutex;
+std::condition_variable g_jobSignal;
+std::deque<DecodeJob> g_jobs{};
+bool g_stopWorkers = false;
+
+std::mutex g_resultMutex;
+std::vector<DecodeResult> g_results{};
+std::deque<DecodeResult> g_uploadQueue{}; // Só acessada pela thread principal
+
+// Decodifica um único caminho: primeiro no .pak mapeado (sem syscalls), depois no disco.
+Image DecodeImageCandidate(const std::string& path) {
+    AssetBlob blob{};
+    if (FindPackedAsset(path, blob)) {
+        return LoadImageFromMemory(GetFileExtension(path.c_str()), blob.data, static_cast<int>(blob.size));
+    }
+    if (FileExists(path.c_str())) {
+        return LoadImage(path.c_str());
+    }
+    return Image{};
+}
+
+// Decodifica o arquivo em memória de CPU; o caminho precisa trazer a extensão (uma busca no .pak e, se faltar,
+// uma no disco). Não usa nenhum recurso de GPU, então pode rodar em qualquer thread.
+Image DecodeImageFile(const std::string& path) {
+    if (path.empty()) {
+        return Image{};
+    }
+    Image image = DecodeImageCandidate(path);
+    // Converte já no worker para o formato das páginas do atlas (UpdateTextureRec exige o mesmo formato).
+    if (image.data != nullptr && image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+    return image;
+}
+
+// Reserva retângulo na página; retorna false se a prateleira atual e as próximas não couberem.
+bool TryAllocateInPage(AtlasPage& page, int width, int height, Rectangle& outBounds) {
+    int paddedWidth = width + kAtlasPadding * 2;
+    int paddedHeight = height + kAtlasPadding * 2;
+    if (page.cursorX + paddedWidth > kAtlasPageSize) {
+        page.cursorX = 0;
+        page.cursorY += page.shelfHeight;
+        page.shelfHeight = 0;
+    }
+    if (page.cursorY + paddedHeight > kAtlasPageSize) {
+        return false;
+    }
+
+    outBounds = Rectangle{static_cast<float>(page.cursorX + kAtlasPadding),
+                          static_cast<float>(page.cursorY + kAtlasPadding),
+                          static_cast<float>(width),
+                          static_cast<float>(height)};
+    page.cursorX += paddedWidth;
+    page.shelfHeight = std::max(page.shelfHeight, paddedHeight);
+    return true;
+}
+
+// Cria página vazia (transparente) com o filtro pedido.
+int CreateAtlasPage(int filter) {
+    Image blank = GenImageColor(kAtlasPageSize, kAtlasPageSize, BLANK);
+    AtlasPage page{};
+    page.texture = LoadTextureFromImage(blank);
+    page.filter = filter;
+    UnloadImage(blank);
+    if (page.texture.id == 0) {
+        return -1;
+    }
+    SetTextureFilter(page.texture, filter);
+    g_atlasPages.push_back(page);
+    return static_cast<int>(g_atlasPages.size()) - 1;
+}
+
+// Copia a imagem para o atlas, reaproveitando o retângulo já reservado em recarregamentos.
+bool PlaceInAtlas(TextureEntry& entry, const Image& image) {
+    if (image.width > kAtlasMaxSpriteSize || image.height > kAtlasMaxSpriteSize) {
+        return false;
+    }
+
+    bool reuseBounds = entry.atlasPage >= 0 &&
+                       static_cast<int>(entry.atlasBounds.width) == image.width &&
+                       static_cast<int>(entry.atlasBounds.height) == image.height;
+    if (!reuseBounds) {
+        entry.atlasPage = -1;
+        for (std::size_t i = 0; i < g_atlasPages.size() && entry.atlasPage < 0; ++i) {
+            if (g_atlasPages[i].filter == entry.filter &&
+                TryAllocateInPage(g_atlasPages[i], image.width, image.height, entry.atlasBounds)) {
+                entry.atlasPage = static_cast<int>(i);
+            }
+        }
+        if (entry.atlasPage < 0) {
+            int pageIndex = CreateAtlasPage(entry.filter);
+            if (pageIndex < 0 || !TryAllocateInPage(g_atlasPages[pageIndex], image.width, image.height, entry.atlasBounds)) {
+                return false;
+            }
+            entry.atlasPage = pageIndex;
+        }
+    }
+
+    const AtlasPage& page = g_atlasPages[entry.atlasPage];
+    UpdateTextureRec(page.texture, entry.atlasBounds, image.data);
+    entry.region.texture = page.texture;
+    entry.region.bounds = entry.atlasBounds;
+    return true;
+}
+
+// Sobe imagem decodificada para a GPU (thread principal) e libera a cópia de CPU.
+void UploadEntry(TextureEntry& entry, Image& image) {
+    if (image.data != nullptr) {
+        if (!PlaceInAtlas(entry, image)) {
+            entry.ownTexture = LoadTextureFromImage(image);
+            if (entry.ownTexture.id != 0) {
+                SetTextureFilter(entry.ownTexture, entry.filter);
+                entry.region.texture = entry.ownTexture;
+                entry.region.bounds = Rectangle{0.0f, 0.0f, static_cast<float>(image.width), static_cast<float>(image.height)};
+            }
+        }
+        UnloadImage(image);
+        image = Image{};
+    }
+
+    if (entry.region.texture.id != 0) {
+        entry.state = TextureLoadState::Ready;
+        ++g_stats.loads;
+    } else {
+        entry.state = TextureLoadState::Failed;
+        ++g_stats.failedLoads;
+        std::cerr << "[TextureManager] Texture not found: " << entry.path << std::endl;
+    }
+}
+
+// Caminho síncrono usado quando o pool não foi iniciado (ex.: ferramentas headless).
+void LoadEntrySync(TextureEntry& entry) {
+    Image image = DecodeImageFile(entry.path);
+    UploadEntry(entry, image);
+}
+
+// Laço de cada worker: consome pedidos e publica imagens decodificadas.
+void DecodeWorkerLoop() {
+    for (;;) {
+        DecodeJob job;
+        {
+            std::unique_lock<std::mutex> lock(g_jobMutex);
+            g_jobSignal.wait(lock, [] { return g_stopWorkers || !g_jobs.empty(); });
+            if (g_stopWorkers) {
+                return;
+            }
+            job = std::move(g_jobs.front());
+            g_jobs.pop_front();
+        }
+
+        DecodeResult result{};
+        result.handle = job.handle;
+        result.serial = job.serial;
+        result.image = DecodeImageFile(job.path);
+
+        std::lock_guard<std::mutex> lock(g_resultMutex);
+        g_results.push_back(result);
+    }
+}
+
+// Enfileira decodificação assíncrona para a entrada; a textura fica vazia (placeholder) até o upload.
+void RequestDecode(TextureHandle handle, TextureEntry& entry) {
+    entry.state = TextureLoadState::Pending;
+    ++entry.loadSerial;
+    {
+        std::lock_guard<std::mutex> lock(g_jobMutex);
+        g_jobs.push_back(DecodeJob{handle, entry.loadSerial, entry.path});
+    }
+    g_jobSignal.notify_one();
+}
+
+// Garante que a entrada tenha sido pedida (assíncrona se houver workers, síncrona caso contrário).
+void EnsureEntryRequested(TextureHandle handle, TextureEntry& entry) {
+    if (entry.state != TextureLoadState::Unloaded) {
+        return;
+    }
+    if (!g_workers.empty()) {
+        RequestDecode(handle, entry);
+    } else {
+        LoadEntrySync(entry);
+    }
+}
+
+// Descarrega a textura da entrada mantendo o registro do caminho; pedidos pendentes viram obsoletos.
+// Sprites no atlas apenas soltam a região (o retângulo segue reservado para a próxima carga).
+void UnloadEntry(TextureEntry& entry) {
+    if (entry.ownTexture.id != 0) {
+        UnloadTexture(entry.ownTexture);
+    }
+    if (entry.region.texture.id != 0) {
+        ++g_stats.unloads;
+    }
+    entry.ownTexture = Texture2D{};
+    entry.region = TextureRegion{};
+    entry.state = TextureLoadState::Unloaded;
+}
+
+// Converte handle em ponteiro para a entrada, ou nullptr se inválido.
+TextureEntry* EntryForHandle(TextureHandle handle) {
+    if (handle == kInvalidTextureHandle || handle > g_entries.size()) {
+        return nullptr;
+    }
+    return &g_entries[handle - 1];
+}
+
+// Verifica se o resultado ainda corresponde a um pedido vivo da entrada.
+bool IsResultCurrent(const DecodeResult& result) {
+    TextureEntry* entry = EntryForHandle(result.handle);
+    return entry != nullptr &&
+           entry->state == TextureLoadState::Pending &&
+           entry->loadSerial == result.serial;
+}
+
+} // namespace
+
+TextureHandle AcquireTexture(const std::string& path, int filter) {
+    if (path.empty()) {
+        return kInvalidTextureHandle;
+    }
+
+    auto it = g_handleByPath.find(path);
+    if (it != g_handleByPath.end()) {
+        TextureEntry& entry = g_entries[it->second - 1];
+        if (entry.refCount == 0) {
+            entry.filter = filter;
+        }
+        ++entry.refCount;
+        ++g_stats.dedupedAcquires;
+        if (!g_workers.empty()) {
+            EnsureEntryRequested(it->second, entry);
+        }
+        return it->second;
+    }
+
+    TextureEntry entry{};
+    entry.path = path;
+    entry.filter = filter;
+    entry.refCount = 1;
+    g_entries.push_back(std::move(entry));
+
+    TextureHandle handle = static_cast<TextureHandle>(g_entries.size());
+    g_handleByPath.emplace(path, handle);
+    if (!g_workers.empty()) {
+        // Com o pool ativo a decodificação começa já na aquisição, antes do primeiro desenho.
+        EnsureEntryRequested(handle, g_entries.back());
+    }
+    return handle;
+}
+
+void ReleaseTexture(TextureHandle handle) {
+    TextureEntry* entry = EntryForHandle(handle);
+    if (entry == nullptr || entry->refCount <= 0) {
+        return;
+    }
+
+    --entry->refCount;
+    if (entry->refCount == 0) {
+        UnloadEntry(*entry);
+    }
+}
+
+const TextureRegion& GetTextureRegion(TextureHandle handle) {
+    static const TextureRegion kEmptyRegion{};
+    TextureEntry* entry = EntryForHandle(handle);
+    if (entry == nullptr || entry->refCount <= 0) {
+        return kEmptyRegion;
+    }
+    EnsureEntryRequested(handle, *entry);
+    return entry->region;
+}
+
+void DrawTextureRegion(const TextureRegion& region,
+                       Rectangle source,
+                       Rectangle dest,
+                       Vector2 origin,
+                       float rotation,
+                       Color tint) {
+    if (region.texture.id == 0) {
+        return;
+    }
+    // Largura/altura negativas (espelhamento) continuam funcionando: a Raylib só inverte o sinal.
+    source.x += region.bounds.x;
+    source.y += region.bounds.y;
+    Counted::DrawTexturePro(region.texture, source, dest, origin, rotation, tint);
+}
+
+std::uint64_t GetTextureResidencyGeneration() {
+    return g_stats.loads + g_stats.unloads;
+}
+
+TextureManagerStats GetTextureManagerStats() {
+    TextureManagerStats stats = g_stats;
+    stats.registeredPaths = g_entries.size();
+    for (const TextureEntry& entry : g_entries) {
+        if (entry.refCount > 0) {
+            ++stats.referencedTextures;
+        }
+        if (entry.state == TextureLoadState::Pending) {
+            ++stats.pendingTextures;
+        }
+        if (entry.region.texture.id != 0) {
+            ++stats.residentTextures;
+        }
+        if (entry.ownTexture.id != 0) {
+            stats.residentBytes += static_cast<std::size_t>(entry.ownTexture.width) *
+                                   static_cast<std::size_t>(entry.ownTexture.height) * 4u;
+        }
+    }
+    stats.atlasPages = g_atlasPages.size();
+    stats.residentBytes += g_atlasPages.size() * static_cast<std::size_t>(kAtlasPageSize) *
+                           static_cast<std::size_t>(kAtlasPageSize) * 4u;
+    return stats;
+}
+
+void InitTextureManager(unsigned int workerCount) {
+    if (!g_workers.empty()) {
+        return;
+    }
+    if (workerCount == 0) {
+        unsigned int hardware = std::thread::hardware_concurrency();
+        workerCount = std::clamp(hardware > 1 ? hardware - 1 : 1u, 1u, 4u);
+    }
+
+    g_stopWorkers = false;
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        g_workers.emplace_back(DecodeWorkerLoop);
+    }
+}
+
+void UpdateTextureManager(std::size_t uploadByteBudget) {
+    {
+        std::lock_guard<std::mutex> lock(g_resultMutex);
+        for (DecodeResult& result : g_results) {
+            g_uploadQueue.push_back(result);
+        }
+        g_results.clear();
+    }
+
+    // Sempre sobe ao menos uma textura por quadro para não travar a fila com imagens grandes.
+    std::size_t uploadedBytes = 0;
+    bool uploadedAny = false;
+    while (!g_uploadQueue.empty()) {
+        DecodeResult& result = g_uploadQueue.front();
+        if (!IsResultCurrent(result)) {
+            if (result.image.data != nullptr) {
+                UnloadImage(result.image);
+            }
+            g_uploadQueue.pop_front();
+            continue;
+        }
+
+        std::size_t imageBytes = static_cast<std::size_t>(result.image.width) *
+                                 static_cast<std::size_t>(result.image.height) * 4u;
+        if (uploadedAny && uploadedBytes + imageBytes > uploadByteBudget) {
+            break;
+        }
+
+        UploadEntry(g_entries[result.handle - 1], result.image);
+        ++g_stats.asyncUploads;
+        uploadedBytes += imageBytes;
+        uploadedAny = true;
+        g_uploadQueue.pop_front();
+    }
+}
+
+void ShutdownTextureManager() {
+    {
+        std::lock_guard<std::mutex> lock(g_jobMutex);
+        g_stopWorkers = true;
+        g_jobs.clear();
+    }
+    g_jobSignal.notify_all();
+    for (std::thread& worker : g_workers) {
+        worker.join();
+    }
+    g_workers.clear();
+
+    for (DecodeResult& result : g_results) {
+        UnloadImage(result.image);
+    }
+    g_results.clear();
+    for (DecodeResult& result : g_uploadQueue) {
+        UnloadImage(result.image);
+    }
+    g_uploadQueue.clear();
+
+    for (TextureEntry& entry : g_entries) {
+        UnloadEntry(entry);
+        entry.refCount = 0;
+        entry.atlasPage = -1;
+    }
+    for (AtlasPage& page : g_atlasPages) {
+        UnloadTexture(page.texture);
+    }
+    g_atlasPages.clear();
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "raylib.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Handle leve para texturas gerenciadas (índice + 1); 0 indica textura inválida.
+using TextureHandle = std::uint32_t;
+constexpr TextureHandle kInvalidTextureHandle = 0;
+
+// Sprite gerenciado: página do atlas (ou textura própria, para imagens grandes) e retângulo dentro dela.
+// texture.id == 0 enquanto o sprite não foi carregado; bounds.width/height são as dimensões do sprite.
+struct TextureRegion {
+    Texture2D texture{};
+    Rectangle bounds{};
+};
+
+// Orçamento padrão de upload para GPU por quadro (bytes RGBA8 estimados).
+constexpr std::size_t kDefaultTextureUploadBudgetBytes = 4u * 1024u * 1024u;
+
+// Estatísticas agregadas do gerenciador de texturas (debug/profiling).
+struct TextureManagerStats {
+    std::size_t registeredPaths{0};   // Caminhos distintos já registrados
+    std::size_t residentTextures{0};  // Texturas atualmente carregadas na GPU
+    std::size_t referencedTextures{0}; // Entradas com pelo menos uma referência viva
+    std::size_t pendingTextures{0};   // Entradas decodificando em worker ou aguardando upload
+    std::size_t atlasPages{0};        // Páginas de atlas alocadas
+    std::size_t residentBytes{0};     // Estimativa de memória de GPU (RGBA8, sem mipmaps, páginas inteiras)
+    std::uint64_t loads{0};           // Carregamentos bem-sucedidos
+    std::uint64_t failedLoads{0};     // Tentativas que não encontraram/decodificaram o arquivo
+    std::uint64_t dedupedAcquires{0}; // Acquires atendidos por entrada já existente
+    std::uint64_t unloads{0};         // Texturas descarregadas ao zerar referências
+    std::uint64_t asyncUploads{0};    // Texturas que vieram do pool de decodificação
+};
+
+// Inicia o pool que decodifica imagens (LoadImage) fora da thread principal; 0 = escolhe pelo hardware.
+// Sem chamar esta função o gerenciador carrega de forma síncrona no primeiro GetTexture.
+void InitTextureManager(unsigned int workerCount = 0);
+
+// Chamado uma vez por quadro na thread principal: sobe para a GPU as imagens prontas respeitando o orçamento.
+void UpdateTextureManager(std::size_t uploadByteBudget = kDefaultTextureUploadBudgetBytes);
+
+// Registra o caminho (deduplicado entre subsistemas) e incrementa a contagem de referências.
+// Com o pool ativo a decodificação começa aqui; o filtro da primeira aquisição prevalece.
+TextureHandle AcquireTexture(const std::string& path, int filter = TEXTURE_FILTER_POINT);
+
+// Decrementa referências; ao chegar em zero a textura é descarregada (o handle continua válido para reaquisição).
+void ReleaseTexture(TextureHandle handle);
+
+// Acesso por indexação direta. Enquanto a imagem não foi enviada à GPU devolve região vazia (texture.id 0),
+// que os chamadores tratam como placeholder desenhando o fallback geométrico.
+// Sprites pequenos compartilham páginas de atlas, permitindo que a Raylib agrupe os desenhos em lote.
+const TextureRegion& GetTextureRegion(TextureHandle handle);
+
+// Equivalente a DrawTexturePro com source relativo ao sprite (e não à página do atlas).
+void DrawTextureRegion(const TextureRegion& region,
+                       Rectangle source,
+                       Rectangle dest,
+                       Vector2 origin,
+                       float rotation,
+                       Color tint);
+
+// Nao recebe parametros; devolve contadores de carregamento/uso atuais.
+TextureManagerStats GetTextureManagerStats();
+
+// Nao recebe parametros; muda sempre que uma textura entra ou sai da GPU (para invalidar desenhos em cache).
+std::uint64_t GetTextureResidencyGeneration();
+
+// Encerra o pool e descarrega todas as texturas restantes; deve ser chamado antes de CloseWindow.
+void ShutdownTextureManager();
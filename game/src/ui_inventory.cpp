@@ -1,20 +1,30 @@
 #include "ui_inventory.h"
 
 #include "raygui.h"
+#include "alloc_stats.h"
 #include "player.h"
 #include "weapon.h"
-#include "weapon_blueprints.h"
+#include "game_data.h"
 #include "font_manager.h"
 #include "chest.h"
+#include "render_stats.h"
+#include "texture_manager.h"
+#include "loot_tables.h"
+#include "game_random.h"
+#include "rlgl.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <functional>
-#include <random>
 #include <iomanip>
+#include <iostream>
+#include <limits>
 #include <numeric>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 
 namespace {
@@ -44,45 +54,28 @@ constexpr int kConsumableShopMinStock = 2;
 constexpr int kConsumableShopMaxStock = 7;
 constexpr int kConsumableMaxStack = 10;
 constexpr int kMaterialMaxStack = 99;
-constexpr int kShopSlotCount = 4;
+constexpr int kShopRollAttemptsPerSlot = 8; // Limite de sorteios repetidos por slot da vitrine
+constexpr int kStarterLeftWeaponId = 1;      // Espada Curta (ids de assets/data/items.txt)
+constexpr int kStarterRightWeaponId = 3;     // Arco Simples
+constexpr int kStarterEquipmentId = 159;     // Kit do Testador
 constexpr float kInventorySpritePadding = 0.0f;
 
-struct InventorySpriteCacheEntry {
-    Texture2D texture{};
-    bool attemptedLoad{false};
-};
-
-std::unordered_map<std::string, InventorySpriteCacheEntry> g_inventorySpriteCache{};
+// Rótulos dos slots vazios da bigorna (entradas A/B e resultado); strings fixas para DrawSlot receber por referência.
+const std::string kForgeSlotLabels[] = {"Slot 1", "Slot 2", "Resultado"};
 
-// Carrega sprite da arma/item caso o arquivo exista.
-Texture2D LoadInventorySpriteIfAvailable(const std::string& path) {
-    if (path.empty()) {
-        return Texture2D{};
-    }
+// Handles de sprites do inventário; a textura em si é compartilhada com HUD/projéteis pelo gerenciador.
+std::unordered_map<std::string, TextureHandle> g_inventorySpriteHandles{};
 
-    if (!FileExists(path.c_str())) {
-        return Texture2D{};
-    }
+// Tabelas de loot (alias) compiladas a partir do registro de itens; refeitas quando o registro muda.
+LootTableSet g_lootTables;
 
-    Texture2D texture = LoadTexture(path.c_str());
-    if (texture.id != 0) {
-        SetTextureFilter(texture, TEXTURE_FILTER_POINT);
+// Resolve handle do sprite uma única vez e devolve a textura carregada pelo gerenciador.
+const TextureRegion& AcquireInventorySpriteTexture(const std::string& path) {
+    auto it = g_inventorySpriteHandles.find(path);
+    if (it == g_inventorySpriteHandles.end()) {
+        it = g_inventorySpriteHandles.emplace(path, AcquireTexture(path, TEXTURE_FILTER_POINT)).first;
     }
-    return texture;
-}
-
-// Usa cache global para evitar recarregar sprites de inventário a cada quadro.
-Texture2D AcquireInventorySpriteTexture(const std::string& path) {
-    if (path.empty()) {
-        return Texture2D{};
-    }
-
-    auto& entry = g_inventorySpriteCache[path];
-    if (!entry.attemptedLoad) {
-        entry.attemptedLoad = true;
-        entry.texture = LoadInventorySpriteIfAvailable(path);
-    }
-    return entry.texture;
+    return GetTextureRegion(it->second);
 }
 
 // Desenha sprite customizado de arma na grade do inventário.
@@ -92,27 +85,27 @@ bool DrawWeaponInventorySprite(const WeaponBlueprint& blueprint, const Rectangle
         return false;
     }
 
-    Texture2D texture = AcquireInventorySpriteTexture(sprite.spritePath);
-    if (texture.id == 0) {
+    const TextureRegion& region = AcquireInventorySpriteTexture(sprite.spritePath);
+    if (region.texture.id == 0) {
         return false;
     }
 
     Vector2 size = sprite.drawSize;
     if (size.x <= 0.0f) {
-        size.x = static_cast<float>(texture.width);
+        size.x = region.bounds.width;
     }
     if (size.y <= 0.0f) {
-        size.y = static_cast<float>(texture.height);
+        size.y = region.bounds.height;
     }
 
-    Rectangle src{0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
     Vector2 center{
         rect.x + rect.width * 0.5f + sprite.drawOffset.x,
         rect.y + rect.height * 0.5f + sprite.drawOffset.y
     };
     Rectangle dest{center.x, center.y, size.x, size.y};
     Vector2 origin{size.x * 0.5f, size.y * 0.5f};
-    DrawTexturePro(texture, src, dest, origin, sprite.rotationDegrees, WHITE);
+    DrawTextureRegion(region, src, dest, origin, sprite.rotationDegrees, WHITE);
     return true;
 }
 
@@ -143,17 +136,9 @@ ItemActiveAbility MakeHealingPotionAbility() {
     return ability;
 }
 
-// Varre vetor de definições procurando o id solicitado.
+// Consulta a tabela densa do registro de itens pelo id solicitado.
 const ItemDefinition* FindItemDefinition(const InventoryUIState& state, int id) {
-    if (id <= 0) {
-        return nullptr;
-    }
-    for (const ItemDefinition& def : state.items) {
-        if (def.id == id) {
-            return &def;
-        }
-    }
-    return nullptr;
+    return state.items.Find(id);
 }
 
 // Converte float formatando casas decimais fixas para tooltips.
@@ -173,15 +158,6 @@ constexpr const char* kIconConstitution = "[CON]";
 constexpr const char* kIconFocus = "[FOC]";
 constexpr const char* kIconMysticism = "[MYS]";
 constexpr const char* kIconKnowledge = "[SAB]";
-constexpr const char* kIconDefense = "[DEF]";
-constexpr const char* kIconVigor = "[VIG]";
-constexpr const char* kIconSpeed = "[VEL]";
-constexpr const char* kIconIntelligence = "[INT]";
-constexpr const char* kIconVampirism = "[VAM]";
-constexpr const char* kIconDodge = "[DESV]";
-constexpr const char* kIconRange = "[ALC]";
-constexpr const char* kIconLuck = "[SOR]";
-constexpr const char* kIconCurse = "[MAL]";
 
 // Retorna etiqueta curta associada ao atributo da arma.
 std::string WeaponAttributeIcon(WeaponAttributeKey key) {
@@ -372,76 +348,243 @@ int AddItemToChest(Chest& chest,
     return (remaining == 0) ? firstSlotUsed : -1;
 }
 
-// Quebra texto longo em múltiplas linhas baseando-se na largura disponível.
-std::vector<std::string> WrapTextLines(const std::string& text,
-                                       float maxWidth,
-                                       float fontSize) {
+// Layout de texto quebrado em cache: linhas e largura medida de cada uma.
+struct WrappedTextLayout {
+    std::string text; // Texto de origem, conferido para descartar colisões de hash
     std::vector<std::string> lines;
-    if (maxWidth <= 0.0f) {
-        lines.push_back(text);
-        return lines;
+    std::vector<float> widths;
+};
+
+// Chave do cache: hash do texto + largura máxima + tamanho da fonte.
+struct TextLayoutKey {
+    std::size_t textHash{0};
+    float maxWidth{0.0f};
+    float fontSize{0.0f};
+
+    bool operator==(const TextLayoutKey& other) const {
+        return textHash == other.textHash && maxWidth == other.maxWidth && fontSize == other.fontSize;
     }
+};
 
-    const Font& font = GetGameFont();
-    size_t start = 0;
-    while (start <= text.size()) {
-        size_t end = text.find('\n', start);
-        std::string paragraph = (end == std::string::npos)
-            ? text.substr(start)
-            : text.substr(start, end - start);
+struct TextLayoutKeyHash {
+    std::size_t operator()(const TextLayoutKey& key) const {
+        std::size_t seed = key.textHash;
+        seed ^= std::hash<float>{}(key.maxWidth) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        seed ^= std::hash<float>{}(key.fontSize) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+};
 
-        if (paragraph.empty()) {
-            lines.push_back("");
-        } else {
-            std::istringstream words(paragraph);
-            std::string word;
-            std::string currentLine;
-            while (words >> word) {
-                std::string candidate = currentLine.empty() ? word : currentLine + " " + word;
-                if (MeasureTextEx(font, candidate.c_str(), fontSize, kBodyTextSpacing).x <= maxWidth) {
-                    currentLine = std::move(candidate);
-                } else {
-                    if (!currentLine.empty()) {
-                        lines.push_back(currentLine);
-                        currentLine.clear();
-                    }
+// Limite de entradas; o cache só é esvaziado no início de RenderInventoryUI, quando nenhuma referência está viva.
+constexpr std::size_t kTextLayoutCacheLimit = 1024;
 
-                    std::string chunk;
-                    for (char ch : word) {
-                        chunk.push_back(ch);
-                        if (MeasureTextEx(font, chunk.c_str(), fontSize, kBodyTextSpacing).x > maxWidth && chunk.size() > 1) {
-                            lines.push_back(chunk.substr(0, chunk.size() - 1));
-                            chunk.erase(0, chunk.size() - 1);
-                        }
-                    }
-                    currentLine = chunk;
-                }
+// Avanços (escala base) dos codepoints < 256 de uma variante da fonte; negativo = ainda não consultado.
+struct GlyphAdvanceTable {
+    int baseSize{0};
+    std::array<float, 256> advances{};
+};
+
+// Cache de layouts e tabelas de avanços por variante (tamanho) da fonte usada para montá-los.
+struct TextLayoutCache {
+    unsigned int fontGeneration{0};
+    bool synced{false};
+    std::vector<GlyphAdvanceTable> advanceTables; // Poucas entradas: uma por tamanho do atlas já usado
+    std::unordered_map<TextLayoutKey, WrappedTextLayout, TextLayoutKeyHash> layouts;
+};
+
+TextLayoutCache g_textLayoutCache{};
+
+// Invalida tudo se a fonte do jogo foi recarregada.
+void SyncTextLayoutFont() {
+    const unsigned int generation = GetGameFontGeneration();
+    if (g_textLayoutCache.synced && g_textLayoutCache.fontGeneration == generation) {
+        return;
+    }
+    g_textLayoutCache.fontGeneration = generation;
+    g_textLayoutCache.synced = true;
+    g_textLayoutCache.advanceTables.clear();
+    g_textLayoutCache.layouts.clear();
+}
+
+// Chamado no início de cada quadro do inventário para limitar a memória do cache.
+void TrimTextLayoutCache() {
+    if (g_textLayoutCache.layouts.size() > kTextLayoutCacheLimit) {
+        g_textLayoutCache.layouts.clear();
+    }
+}
+
+// Tabela de avanços da variante informada, criada na primeira consulta.
+GlyphAdvanceTable& AdvanceTableFor(const Font& font) {
+    for (GlyphAdvanceTable& table : g_textLayoutCache.advanceTables) {
+        if (table.baseSize == font.baseSize) {
+            return table;
+        }
+    }
+    GlyphAdvanceTable& table = g_textLayoutCache.advanceTables.emplace_back();
+    table.baseSize = font.baseSize;
+    table.advances.fill(-1.0f);
+    return table;
+}
+
+// Avanço de um codepoint na escala base, com a mesma regra de MeasureTextEx.
+float GlyphAdvance(const Font& font, GlyphAdvanceTable& table, int codepoint) {
+    bool cacheable = codepoint >= 0 && codepoint < static_cast<int>(table.advances.size());
+    if (cacheable && table.advances[codepoint] >= 0.0f) {
+        return table.advances[codepoint];
+    }
+    float advance = 0.0f;
+    if (font.glyphs != nullptr && font.recs != nullptr) {
+        int index = GetGlyphIndex(font, codepoint);
+        advance = (font.glyphs[index].advanceX != 0)
+            ? static_cast<float>(font.glyphs[index].advanceX)
+            : font.recs[index].width + static_cast<float>(font.glyphs[index].offsetX);
+    }
+    if (cacheable) {
+        table.advances[codepoint] = advance;
+    }
+    return advance;
+}
+
+// Trecho em construção: soma dos avanços (escala base) e número de codepoints, para medir sem MeasureTextEx.
+struct MeasuredRun {
+    std::string text;
+    float advance{0.0f};
+    int glyphs{0};
+};
+
+// Quebra o texto em uma passada, somando avanços glifo a glifo (mesmo resultado de MeasureTextEx + spacing).
+void BuildWrappedLayout(const Font& font,
+                        const std::string& text,
+                        float maxWidth,
+                        float fontSize,
+                        WrappedTextLayout& layout) {
+    const float scale = (font.baseSize > 0) ? fontSize / static_cast<float>(font.baseSize) : 1.0f;
+    GlyphAdvanceTable& advanceTable = AdvanceTableFor(font);
+    auto widthOf = [&](float advance, int glyphs) {
+        return (glyphs <= 0) ? 0.0f : advance * scale + static_cast<float>(glyphs - 1) * kBodyTextSpacing;
+    };
+    auto pushLine = [&](const MeasuredRun& run) {
+        layout.lines.push_back(run.text);
+        layout.widths.push_back(widthOf(run.advance, run.glyphs));
+    };
+    const float spaceAdvance = GlyphAdvance(font, advanceTable, ' ');
+
+    MeasuredRun line;
+    MeasuredRun word;
+    bool paragraphEmpty = true; // Parágrafo sem nenhum caractere vira linha vazia; só espaços não gera linha
+
+    // Fecha a palavra atual: cabe na linha com um espaço, senão quebra (e fatia palavras maiores que a largura).
+    auto commitWord = [&]() {
+        if (word.glyphs == 0) {
+            return;
+        }
+        float joinedAdvance = line.advance + (line.glyphs > 0 ? spaceAdvance : 0.0f) + word.advance;
+        int joinedGlyphs = line.glyphs + (line.glyphs > 0 ? 1 : 0) + word.glyphs;
+        if (widthOf(joinedAdvance, joinedGlyphs) <= maxWidth) {
+            if (line.glyphs > 0) {
+                line.text.push_back(' ');
             }
-            if (!currentLine.empty()) {
-                lines.push_back(currentLine);
+            line.text += word.text;
+            line.advance = joinedAdvance;
+            line.glyphs = joinedGlyphs;
+        } else {
+            if (line.glyphs > 0) {
+                pushLine(line);
+            }
+            line = MeasuredRun{};
+            std::size_t offset = 0;
+            while (offset < word.text.size()) {
+                int size = 0;
+                int codepoint = GetCodepointNext(word.text.c_str() + offset, &size);
+                size = std::max(size, 1);
+                float advance = GlyphAdvance(font, advanceTable, codepoint);
+                if (line.glyphs > 0 && widthOf(line.advance + advance, line.glyphs + 1) > maxWidth) {
+                    pushLine(line);
+                    line = MeasuredRun{};
+                }
+                line.text.append(word.text, offset, static_cast<std::size_t>(size));
+                line.advance += advance;
+                line.glyphs += 1;
+                offset += static_cast<std::size_t>(size);
             }
         }
+        word = MeasuredRun{};
+    };
 
-        if (end == std::string::npos) {
-            break;
+    auto commitParagraph = [&]() {
+        commitWord();
+        if (line.glyphs > 0) {
+            pushLine(line);
+        } else if (paragraphEmpty) {
+            layout.lines.emplace_back();
+            layout.widths.push_back(0.0f);
         }
-        start = end + 1;
+        line = MeasuredRun{};
+        paragraphEmpty = true;
+    };
+
+    std::size_t offset = 0;
+    while (offset < text.size()) {
+        int size = 0;
+        int codepoint = GetCodepointNext(text.c_str() + offset, &size);
+        size = std::max(size, 1);
+        if (codepoint == '\n') {
+            commitParagraph();
+            offset += static_cast<std::size_t>(size);
+            continue;
+        }
+        paragraphEmpty = false;
+        if (codepoint == ' ' || codepoint == '\t' || codepoint == '\r' || codepoint == '\v' || codepoint == '\f') {
+            commitWord();
+        } else {
+            word.text.append(text, offset, static_cast<std::size_t>(size));
+            word.advance += GlyphAdvance(font, advanceTable, codepoint);
+            word.glyphs += 1;
+        }
+        offset += static_cast<std::size_t>(size);
     }
+    commitParagraph();
 
-    if (lines.empty()) {
-        lines.push_back("");
+    if (layout.lines.empty()) {
+        layout.lines.emplace_back();
+        layout.widths.push_back(0.0f);
     }
-    return lines;
+}
+
+// Quebra texto longo em múltiplas linhas baseando-se na largura disponível.
+// O resultado fica em cache até a fonte mudar; a referência vale até o próximo quadro do inventário.
+const std::vector<std::string>& WrapTextLines(const std::string& text,
+                                              float maxWidth,
+                                              float fontSize) {
+    const Font& font = GetGameFont(fontSize);
+    SyncTextLayoutFont();
+
+    TextLayoutKey key{std::hash<std::string>{}(text), std::max(0.0f, maxWidth), fontSize};
+    auto it = g_textLayoutCache.layouts.find(key);
+    if (it != g_textLayoutCache.layouts.end() && it->second.text == text) {
+        return it->second.lines;
+    }
+
+    WrappedTextLayout& layout = g_textLayoutCache.layouts[key];
+    layout = WrappedTextLayout{};
+    layout.text = text;
+    if (maxWidth <= 0.0f) {
+        layout.lines.push_back(text);
+        layout.widths.push_back(MeasureTextEx(font, text.c_str(), fontSize, kBodyTextSpacing).x);
+    } else {
+        BuildWrappedLayout(font, text, maxWidth, fontSize, layout);
+    }
+    return layout.lines;
 }
 
 float DrawLineList(const std::vector<std::string>& lines,
                    Vector2 position,
                    float fontSize,
                    Color color) {
-    const Font& font = GetGameFont();
+    const Font& font = GetGameFont(fontSize);
     float y = position.y;
     for (size_t i = 0; i < lines.size(); ++i) {
-        DrawTextEx(font, lines[i].c_str(), Vector2{position.x, y}, fontSize, kBodyTextSpacing, color);
+        Counted::DrawTextEx(font, lines[i].c_str(), Vector2{position.x, y}, fontSize, kBodyTextSpacing, color);
         y += fontSize;
         if (i + 1 < lines.size()) {
             y += kParagraphSpacing;
@@ -455,7 +598,7 @@ float DrawWrappedText(Vector2 position,
                       const std::string& text,
                       float fontSize,
                       Color color) {
-    std::vector<std::string> lines = WrapTextLines(text, maxWidth, fontSize);
+    const std::vector<std::string>& lines = WrapTextLines(text, maxWidth, fontSize);
     return DrawLineList(lines, position, fontSize, color);
 }
 
@@ -498,28 +641,24 @@ void AppendFloatBonusLine(std::vector<std::string>& lines,
     lines.push_back(line);
 }
 
+// Gera uma linha por atributo não nulo do bloco, com rótulo e ícone da lista de campos refletida.
+template <typename Block>
+void AppendAttributeBonusLines(std::vector<std::string>& lines, const Block& block) {
+    ForEachAttributeField<Block>([&](const auto& field) {
+        const auto value = block.*(field.member);
+        if constexpr (std::is_same_v<std::decay_t<decltype(value)>, int>) {
+            AppendIntBonusLine(lines, value, field.label, field.icon);
+        } else {
+            AppendFloatBonusLine(lines, value, field.label, 1, field.icon);
+        }
+    });
+}
+
 std::vector<std::string> CollectPassiveBonusLines(const PlayerAttributes& bonuses) {
     std::vector<std::string> lines;
-    AppendIntBonusLine(lines, bonuses.primary.poder, "Poder", kIconPower);
-    AppendIntBonusLine(lines, bonuses.primary.defesa, "Defesa", kIconDefense);
-    AppendIntBonusLine(lines, bonuses.primary.vigor, "Vigor", kIconVigor);
-    AppendIntBonusLine(lines, bonuses.primary.velocidade, "Velocidade", kIconSpeed);
-    AppendIntBonusLine(lines, bonuses.primary.destreza, "Destreza", kIconDexterity);
-    AppendIntBonusLine(lines, bonuses.primary.inteligencia, "Inteligencia", kIconIntelligence);
-
-    AppendIntBonusLine(lines, bonuses.attack.constituicao, "Constituicao", kIconConstitution);
-    AppendIntBonusLine(lines, bonuses.attack.forca, "Forca", kIconStrength);
-    AppendIntBonusLine(lines, bonuses.attack.foco, "Foco", kIconFocus);
-    AppendIntBonusLine(lines, bonuses.attack.misticismo, "Misticismo", kIconMysticism);
-    AppendIntBonusLine(lines, bonuses.attack.conhecimento, "Conhecimento", kIconKnowledge);
-
-    AppendFloatBonusLine(lines, bonuses.secondary.vampirismo, "Vampirismo", 1, kIconVampirism);
-    AppendFloatBonusLine(lines, bonuses.secondary.letalidade, "Letalidade", 1, kIconLethality);
-    AppendFloatBonusLine(lines, bonuses.secondary.reducaoDano, "Reducao de Dano", 1);
-    AppendFloatBonusLine(lines, bonuses.secondary.desvio, "Desvio", 1, kIconDodge);
-    AppendFloatBonusLine(lines, bonuses.secondary.alcanceColeta, "Alcance de Coleta", 1, kIconRange);
-    AppendFloatBonusLine(lines, bonuses.secondary.sorte, "Sorte", 1, kIconLuck);
-    AppendIntBonusLine(lines, bonuses.secondary.maldicao, "Maldicao", kIconCurse);
+    AppendAttributeBonusLines(lines, bonuses.primary);
+    AppendAttributeBonusLines(lines, bonuses.attack);
+    AppendAttributeBonusLines(lines, bonuses.secondary);
     return lines;
 }
 
@@ -571,10 +710,11 @@ void DrawItemDetailPanel(InventoryUIState& state,
     const float headingFont = 24.0f;
     const float bodyFont = 18.0f;
     const float padding = 12.0f;
-    const Font& font = GetGameFont();
+    const Font& headingFace = GetGameFont(headingFont);
+    const Font& bodyFace = GetGameFont(bodyFont);
 
     if (itemDef == nullptr && weaponBlueprint == nullptr) {
-        DrawTextEx(font,
+        Counted::DrawTextEx(bodyFace,
                    "Dados indisponiveis para este item.",
                    Vector2{area.x + padding, area.y + padding},
                    bodyFont,
@@ -589,31 +729,31 @@ void DrawItemDetailPanel(InventoryUIState& state,
     }
 
     Rectangle iconRect{area.x + padding, area.y + padding, 64.0f, 64.0f};
-    DrawRectangleLinesEx(iconRect, 2.0f, Color{120, 132, 160, 255});
+    Counted::DrawRectangleLinesEx(iconRect, 2.0f, Color{120, 132, 160, 255});
     bool drewIcon = false;
     if (iconBlueprint != nullptr) {
         drewIcon = DrawWeaponInventorySprite(*iconBlueprint, iconRect);
     }
     if (!drewIcon && itemDef != nullptr && !itemDef->inventorySpritePath.empty()) {
-        Texture2D texture = AcquireInventorySpriteTexture(itemDef->inventorySpritePath);
-        if (texture.id != 0) {
-            Rectangle src{0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+        const TextureRegion& region = AcquireInventorySpriteTexture(itemDef->inventorySpritePath);
+        if (region.texture.id != 0) {
+            Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
             Vector2 center{iconRect.x + iconRect.width * 0.5f, iconRect.y + iconRect.height * 0.5f};
             Vector2 drawSize = itemDef->inventorySpriteDrawSize;
             if (drawSize.x <= 0.0f || drawSize.y <= 0.0f) {
-                float maxDim = std::max(1.0f, static_cast<float>(std::max(texture.width, texture.height)));
+                float maxDim = std::max(1.0f, std::max(region.bounds.width, region.bounds.height));
                 float targetDim = std::max(0.0f, std::min(iconRect.width, iconRect.height) - kInventorySpritePadding);
                 float scale = targetDim > 0.0f ? std::min(1.0f, targetDim / maxDim) : 1.0f;
-                drawSize = Vector2{static_cast<float>(texture.width) * scale, static_cast<float>(texture.height) * scale};
+                drawSize = Vector2{region.bounds.width * scale, region.bounds.height * scale};
             }
             Rectangle dest{center.x, center.y, drawSize.x, drawSize.y};
             Vector2 origin{dest.width * 0.5f, dest.height * 0.5f};
-            DrawTexturePro(texture, src, dest, origin, 0.0f, WHITE);
+            DrawTextureRegion(region, src, dest, origin, 0.0f, WHITE);
             drewIcon = true;
         }
     }
     if (!drewIcon) {
-        DrawRectangleRec(iconRect, Color{90, 100, 128, 255});
+        Counted::DrawRectangleRec(iconRect, Color{90, 100, 128, 255});
     }
 
     std::string name = itemDef ? itemDef->name : (iconBlueprint ? iconBlueprint->name : "Item");
@@ -622,10 +762,10 @@ void DrawItemDetailPanel(InventoryUIState& state,
     std::string typeLine = ItemCategoryLabel(category) + " - " + RarityName(rarity);
 
     Vector2 namePos{iconRect.x + iconRect.width + 14.0f, area.y + padding};
-    DrawTextEx(font, name.c_str(), namePos, headingFont, kBodyTextSpacing, textColor);
+    Counted::DrawTextEx(headingFace, name.c_str(), namePos, headingFont, kBodyTextSpacing, textColor);
 
     Vector2 typePos{namePos.x, namePos.y + headingFont + 4.0f};
-    DrawTextEx(font, typeLine.c_str(), typePos, bodyFont, kBodyTextSpacing, RarityToColor(rarity));
+    Counted::DrawTextEx(bodyFace, typeLine.c_str(), typePos, bodyFont, kBodyTextSpacing, RarityToColor(rarity));
 
     float cursorY = iconRect.y + iconRect.height + 18.0f;
     float contentWidth = area.width - padding * 2.0f;
@@ -768,7 +908,7 @@ void DrawItemDetailPanel(InventoryUIState& state,
 
     std::string abilityText = BuildAbilityDescription(itemDef);
     float textWidth = std::max(0.0f, scrollBounds.width - 12.0f);
-    std::vector<std::string> abilityLines = WrapTextLines(abilityText, textWidth, bodyFont);
+    const std::vector<std::string>& abilityLines = WrapTextLines(abilityText, textWidth, bodyFont);
     float abilityContentHeight = abilityLines.empty()
         ? bodyFont
         : abilityLines.size() * (bodyFont + kParagraphSpacing) - kParagraphSpacing;
@@ -873,9 +1013,8 @@ void RefreshForgeChance(InventoryUIState& state) {
     state.forgeSuccessChance = std::clamp(ratio, 0.0f, 1.0f);
 }
 
-std::string ItemNameFromId(const InventoryUIState& state, int id) {
-    const ItemDefinition* def = FindItemDefinition(state, id);
-    return def ? def->name : std::string();
+const std::string& ItemNameFromId(const InventoryUIState& state, int id) {
+    return state.items.NameOf(id);
 }
 
 ItemCategory ItemCategoryFromId(const InventoryUIState& state, int id) {
@@ -883,13 +1022,6 @@ ItemCategory ItemCategoryFromId(const InventoryUIState& state, int id) {
     return def ? def->category : ItemCategory::None;
 }
 
-uint64_t MakeForgeKey(int idA, int idB) {
-    if (idA > idB) {
-        std::swap(idA, idB);
-    }
-    return (static_cast<uint64_t>(static_cast<uint32_t>(idA)) << 32) | static_cast<uint32_t>(idB);
-}
-
 void AppendForgeCombos(const InventoryUIState& state, int itemId, std::string& text) {
     if (itemId <= 0) {
         return;
@@ -897,169 +1029,84 @@ void AppendForgeCombos(const InventoryUIState& state, int itemId, std::string& t
     if (ItemCategoryFromId(state, itemId) == ItemCategory::Material) {
         return;
     }
-    std::string combos;
-    for (const auto& entry : state.forgeRecipes) {
-        int a = static_cast<int>(entry.first >> 32);
-        int b = static_cast<int>(entry.first & 0xFFFFFFFFu);
-        if (a == itemId || b == itemId) {
-            int other = (a == itemId) ? b : a;
-            std::string otherName = ItemNameFromId(state, other);
-            std::string resultName = ItemNameFromId(state, entry.second);
-            if (!otherName.empty() && !resultName.empty()) {
-                combos += "- " + otherName + " -> " + resultName + "\n";
-            }
-        }
-    }
+    // Texto montado uma vez em ForgeRecipeBook::Build.
+    const std::string& combos = state.forgeRecipes.ComboText(itemId);
     if (!combos.empty()) {
-        text += "\nCombina com:\n" + combos;
-    }
-}
-
-void EnsureInventoryMeta(InventoryUIState& state) {
-    size_t targetSize = state.inventoryItemIds.size();
-    targetSize = std::max(targetSize, state.inventoryItems.size());
-    targetSize = std::max(targetSize, state.inventoryQuantities.size());
-    targetSize = std::max(targetSize, state.inventoryTypes.size());
-    if (targetSize < 24) {
-        targetSize = 24;
+        text += "\n" + combos;
     }
-    state.inventoryItemIds.resize(targetSize, 0);
-    state.inventoryItems.resize(targetSize);
-    state.inventoryQuantities.resize(targetSize, 0);
-    state.inventoryTypes.resize(targetSize, ItemCategory::None);
 }
 
-void EnsureWeaponCapacity(InventoryUIState& state, size_t size) {
-    if (state.weaponSlotIds.size() < size) {
-        state.weaponSlotIds.resize(size, 0);
-    }
-    if (state.weaponSlots.size() < size) {
-        state.weaponSlots.resize(size);
-    }
-}
-
-void EnsureEquipmentCapacity(InventoryUIState& state, size_t size) {
-    if (state.equipmentSlotIds.size() < size) {
-        state.equipmentSlotIds.resize(size, 0);
-    }
-    if (state.equipmentSlots.size() < size) {
-        state.equipmentSlots.resize(size);
-    }
-    if (state.equipmentAbilityCooldowns.size() < size) {
-        state.equipmentAbilityCooldowns.resize(size, 0.0f);
-    }
-}
+std::vector<int> g_craftableRecipes; // Reaproveitado entre quadros pela consulta de receitas possiveis
 
-void EnsureShopCapacity(InventoryUIState& state, size_t size) {
-    if (state.shopItemIds.size() < size) {
-        state.shopItemIds.resize(size, 0);
-    }
-    if (state.shopItems.size() < size) {
-        state.shopItems.resize(size);
-    }
-    if (state.shopPrices.size() < size) {
-        state.shopPrices.resize(size, 0);
+// Lista as receitas que os itens do inventario ja permitem forjar (texto da bigorna sem selecao).
+std::string BuildCraftableText(const InventoryUIState& state) {
+    state.forgeRecipes.FindCraftable(state.inventorySlots.data(), state.inventorySlots.size(), g_craftableRecipes);
+    if (g_craftableRecipes.empty()) {
+        return "Nenhuma receita disponivel com os itens do inventario.";
     }
-    if (state.shopTypes.size() < size) {
-        state.shopTypes.resize(size, ItemCategory::None);
+    std::string text = "Pode forjar com o inventario:\n";
+    for (int recipeIndex : g_craftableRecipes) {
+        const ForgeRecipe& recipe = state.forgeRecipes.Recipe(recipeIndex);
+        text += "- " + ItemNameFromId(state, recipe.inputA) + " + " + ItemNameFromId(state, recipe.inputB) +
+                " -> " + ItemNameFromId(state, recipe.resultId) + "\n";
     }
-        if (state.shopStock.size() < size) {
-            state.shopStock.resize(size, 0);
-        }
+    return text;
 }
 
 void SetInventorySlot(InventoryUIState& state, int index, int itemId, int quantity) {
-    EnsureInventoryMeta(state);
-    if (index < 0 || index >= static_cast<int>(state.inventoryItemIds.size())) {
+    MarkInventoryDirty(state);
+    if (index < 0 || index >= static_cast<int>(state.inventorySlots.size())) {
         return;
     }
-    state.inventoryItemIds[index] = itemId;
-    if (itemId <= 0) {
-        state.inventoryItems[index].clear();
-        state.inventoryQuantities[index] = 0;
-        state.inventoryTypes[index] = ItemCategory::None;
-    } else {
-        const ItemDefinition* def = FindItemDefinition(state, itemId);
-        state.inventoryItems[index] = def ? def->name : "?";
-        state.inventoryQuantities[index] = std::max(1, quantity);
-        state.inventoryTypes[index] = def ? def->category : ItemCategory::None;
-    }
+    ItemSlot& slot = state.inventorySlots[index];
+    slot.itemId = std::max(0, itemId);
+    slot.quantity = (slot.itemId > 0) ? std::max(1, quantity) : 0;
 }
 
 void SetWeaponSlot(InventoryUIState& state, int index, int itemId) {
-    if (index < 0) {
+    MarkInventoryDirty(state);
+    if (index < 0 || index >= static_cast<int>(state.weaponSlotIds.size())) {
         return;
     }
-    EnsureWeaponCapacity(state, static_cast<size_t>(index) + 1);
     state.weaponSlotIds[index] = itemId;
-    state.weaponSlots[index] = ItemNameFromId(state, itemId);
+    state.weaponSlotVersion = NextStatVersion();
 }
 
 void SetShopSlot(InventoryUIState& state, int index, int itemId, int price, int stock) {
-    if (index < 0) {
+    if (index < 0 || index >= static_cast<int>(state.shopSlots.size())) {
         return;
     }
-    EnsureShopCapacity(state, static_cast<size_t>(index) + 1);
-    state.shopItemIds[index] = itemId;
-    state.shopItems[index] = ItemNameFromId(state, itemId);
-    state.shopPrices[index] = price;
-    state.shopTypes[index] = ItemCategoryFromId(state, itemId);
-    state.shopStock[index] = std::max(0, stock);
+    state.shopSlots[index] = ShopSlot{itemId, price, std::max(0, stock)};
 }
 
 void RollShopInventoryInternal(InventoryUIState& state, ShopInstance* shop = nullptr) {
-    EnsureShopCapacity(state, kShopSlotCount);
-    state.shopItemIds.assign(kShopSlotCount, 0);
-    state.shopItems.assign(kShopSlotCount, std::string());
-    state.shopPrices.assign(kShopSlotCount, 0);
-    state.shopTypes.assign(kShopSlotCount, ItemCategory::None);
-    state.shopStock.assign(kShopSlotCount, 0);
+    state.shopSlots.fill(ShopSlot{});
     ResetShopTradeState(state);
 
-    std::vector<int> availableIndices;
-    availableIndices.reserve(state.items.size());
-    for (int i = 0; i < static_cast<int>(state.items.size()); ++i) {
-        if (state.items[i].id > 0) {
-            availableIndices.push_back(i);
-        }
-    }
-
-    std::mt19937_64 shopRng;
-    bool useShopRng = (shop != nullptr);
-    if (useShopRng) {
-        shopRng.seed(shop->CurrentSeed());
-    }
-
-    for (int slot = 0; slot < kShopSlotCount; ++slot) {
-        if (availableIndices.empty()) {
-            SetShopSlot(state, slot, 0, 0, 0);
+    const LootTable& table = g_lootTables.Get(state.items, LootSource::Shop, state.lootBiome, state.lootLuckBonus);
+    // Sem ShopInstance (vitrine de debug) a seed vem do stream de loot da run.
+    RandomStream shopRng(shop != nullptr ? shop->CurrentSeed() : GameRandom(RandomStreamId::Loot)());
+
+    // Sem reposicao: um item repetido na vitrine gera novo sorteio (tentativas limitadas para tabelas pequenas).
+    int filled = 0;
+    for (int attempt = 0; attempt < kShopSlotCount * kShopRollAttemptsPerSlot && filled < kShopSlotCount && !table.Empty(); ++attempt) {
+        int itemId = table.Sample(shopRng());
+        bool duplicate = std::any_of(state.shopSlots.begin(), state.shopSlots.begin() + filled, [itemId](const ShopSlot& slot) {
+            return slot.itemId == itemId;
+        });
+        const ItemDefinition* def = FindItemDefinition(state, itemId);
+        if (duplicate || def == nullptr) {
             continue;
         }
 
-        int pickIndex = 0;
-        if (useShopRng) {
-            std::uniform_int_distribution<int> dist(0, static_cast<int>(availableIndices.size()) - 1);
-            pickIndex = dist(shopRng);
-        } else {
-            pickIndex = GetRandomValue(0, static_cast<int>(availableIndices.size()) - 1);
-        }
-
-        int itemIndex = availableIndices[pickIndex];
-        const ItemDefinition& def = state.items[itemIndex];
-        int price = static_cast<int>(std::round(def.value * 1.3f));
-        int finalPrice = (price <= 0) ? def.value : price;
+        int price = static_cast<int>(std::round(def->value * 1.3f));
+        int finalPrice = (price <= 0) ? def->value : price;
         int stock = kDefaultShopStock;
-        if (def.category == ItemCategory::Consumable) {
-            if (useShopRng) {
-                std::uniform_int_distribution<int> stockDist(kConsumableShopMinStock, kConsumableShopMaxStock);
-                stock = stockDist(shopRng);
-            } else {
-                stock = GetRandomValue(kConsumableShopMinStock, kConsumableShopMaxStock);
-            }
+        if (def->category == ItemCategory::Consumable) {
+            stock = shopRng.RangeInt(kConsumableShopMinStock, kConsumableShopMaxStock);
         }
 
-        SetShopSlot(state, slot, def.id, finalPrice, stock);
-        availableIndices.erase(availableIndices.begin() + pickIndex);
+        SetShopSlot(state, filled++, def->id, finalPrice, stock);
     }
 
     if (shop != nullptr) {
@@ -1067,9 +1114,9 @@ void RollShopInventoryInternal(InventoryUIState& state, ShopInstance* shop = nul
         shop->items.reserve(kShopSlotCount);
         for (int slot = 0; slot < kShopSlotCount; ++slot) {
             ShopInventoryEntry entry{};
-            entry.itemId = state.shopItemIds[slot];
-            entry.price = state.shopPrices[slot];
-            entry.stock = (slot < static_cast<int>(state.shopStock.size())) ? state.shopStock[slot] : 0;
+            entry.itemId = state.shopSlots[slot].itemId;
+            entry.price = state.shopSlots[slot].price;
+            entry.stock = (slot < static_cast<int>(state.shopSlots.size())) ? state.shopSlots[slot].stock : 0;
             shop->items.push_back(entry);
         }
     }
@@ -1082,10 +1129,10 @@ void ClearInventorySlot(InventoryUIState& state, int index) {
 }
 
 bool ReduceStackableSlot(InventoryUIState& state, int index, int amount) {
-    if (amount <= 0 || index < 0 || index >= static_cast<int>(state.inventoryItemIds.size())) {
+    if (amount <= 0 || index < 0 || index >= static_cast<int>(state.inventorySlots.size())) {
         return false;
     }
-    int itemId = state.inventoryItemIds[index];
+    int itemId = state.inventorySlots[index].itemId;
     if (itemId == 0) {
         return false;
     }
@@ -1093,7 +1140,7 @@ bool ReduceStackableSlot(InventoryUIState& state, int index, int amount) {
     if (category != ItemCategory::Consumable && category != ItemCategory::Material) {
         return false;
     }
-    int current = (index < static_cast<int>(state.inventoryQuantities.size())) ? state.inventoryQuantities[index] : 0;
+    int current = (index < static_cast<int>(state.inventorySlots.size())) ? state.inventorySlots[index].quantity : 0;
     if (current < amount || current <= 0) {
         return false;
     }
@@ -1108,13 +1155,14 @@ bool ReduceStackableSlot(InventoryUIState& state, int index, int amount) {
 }
 
 bool ReduceConsumableStack(InventoryUIState& state, int index, int amount) {
-    if (amount <= 0 || index < 0 || index >= static_cast<int>(state.inventoryItemIds.size())) {
+    MarkInventoryDirty(state);
+    if (amount <= 0 || index < 0 || index >= static_cast<int>(state.inventorySlots.size())) {
         return false;
     }
-    if (state.inventoryItemIds[index] == 0) {
+    if (state.inventorySlots[index].itemId == 0) {
         return false;
     }
-    if (ItemCategoryFromId(state, state.inventoryItemIds[index]) != ItemCategory::Consumable) {
+    if (ItemCategoryFromId(state, state.inventorySlots[index].itemId) != ItemCategory::Consumable) {
         return false;
     }
     bool reduced = ReduceStackableSlot(state, index, amount);
@@ -1123,8 +1171,8 @@ bool ReduceConsumableStack(InventoryUIState& state, int index, int amount) {
 }
 
 int FindEmptyInventorySlot(const InventoryUIState& state) {
-    for (int i = 0; i < static_cast<int>(state.inventoryItemIds.size()); ++i) {
-        if (state.inventoryItemIds[i] == 0) {
+    for (int i = 0; i < static_cast<int>(state.inventorySlots.size()); ++i) {
+        if (state.inventorySlots[i].itemId == 0) {
             return i;
         }
     }
@@ -1132,11 +1180,11 @@ int FindEmptyInventorySlot(const InventoryUIState& state) {
 }
 
 int AddItemToInventory(InventoryUIState& state, int itemId, int quantity) {
+    MarkInventoryDirty(state);
     if (itemId <= 0 || quantity <= 0) {
         return -1;
     }
 
-    EnsureInventoryMeta(state);
     ItemCategory category = ItemCategoryFromId(state, itemId);
     int remaining = quantity;
     int firstSlotUsed = -1;
@@ -1147,11 +1195,11 @@ int AddItemToInventory(InventoryUIState& state, int itemId, int quantity) {
     if (isStackable) {
         int availableStackSpace = 0;
         int emptySlots = 0;
-        for (int i = 0; i < static_cast<int>(state.inventoryItemIds.size()); ++i) {
-            if (state.inventoryItemIds[i] == itemId) {
-                int currentQty = std::max(0, state.inventoryQuantities[i]);
+        for (int i = 0; i < static_cast<int>(state.inventorySlots.size()); ++i) {
+            if (state.inventorySlots[i].itemId == itemId) {
+                int currentQty = std::max(0, state.inventorySlots[i].quantity);
                 availableStackSpace += std::max(0, maxStack - currentQty);
-            } else if (state.inventoryItemIds[i] == 0) {
+            } else if (state.inventorySlots[i].itemId == 0) {
                 ++emptySlots;
             }
         }
@@ -1160,11 +1208,11 @@ int AddItemToInventory(InventoryUIState& state, int itemId, int quantity) {
             return -1;
         }
 
-        for (int i = 0; i < static_cast<int>(state.inventoryItemIds.size()) && remaining > 0; ++i) {
-            if (state.inventoryItemIds[i] != itemId) {
+        for (int i = 0; i < static_cast<int>(state.inventorySlots.size()) && remaining > 0; ++i) {
+            if (state.inventorySlots[i].itemId != itemId) {
                 continue;
             }
-            int currentQty = std::max(0, state.inventoryQuantities[i]);
+            int currentQty = std::max(0, state.inventorySlots[i].quantity);
             int addable = std::min(maxStack - currentQty, remaining);
             if (addable <= 0) {
                 continue;
@@ -1193,8 +1241,8 @@ int AddItemToInventory(InventoryUIState& state, int itemId, int quantity) {
     }
 
     int emptySlots = 0;
-    for (int id : state.inventoryItemIds) {
-        if (id == 0) {
+    for (const ItemSlot& slot : state.inventorySlots) {
+        if (slot.itemId == 0) {
             ++emptySlots;
         }
     }
@@ -1231,14 +1279,12 @@ void ClearForgeSlot(InventoryUIState& state, int slot) {
         return;
     }
     state.forgeInputIds[slot] = 0;
-    state.forgeInputNames[slot].clear();
     state.forgeInputQuantities[slot] = 0;
     RefreshForgeChance(state);
 }
 
 void ClearForgeResult(InventoryUIState& state) {
     state.forgeResultId = 0;
-    state.forgeResultName.clear();
     state.forgeResultQuantity = 0;
 }
 
@@ -1250,17 +1296,17 @@ bool DetermineForgeOutcome(const InventoryUIState& state,
     if (idA <= 0 || idB <= 0) {
         return false;
     }
-    uint64_t key = MakeForgeKey(idA, idB);
-    auto it = state.forgeRecipes.find(key);
-    if (it == state.forgeRecipes.end()) {
+    const ForgeRecipe* recipe = state.forgeRecipes.Find(idA, idB);
+    if (recipe == nullptr) {
         return false;
     }
-    resultId = it->second;
-    resultQuantity = 1;
+    resultId = recipe->resultId;
+    resultQuantity = recipe->resultQuantity;
     return true;
 }
 
 void AttemptForge(InventoryUIState& state) {
+    MarkInventoryDirty(state);
     if (state.forgeState == ForgeState::Broken) {
         ShowMessage(state, "A bigorna esta quebrada.");
         return;
@@ -1293,7 +1339,7 @@ void AttemptForge(InventoryUIState& state) {
         return;
     }
 
-    float roll = static_cast<float>(GetRandomValue(0, 1000000)) / 1000000.0f;
+    float roll = GameRandom(RandomStreamId::Forge).NextFloat();
     bool success = roll <= successChance;
 
     state.coins = std::max(0, state.coins - invested);
@@ -1303,7 +1349,6 @@ void AttemptForge(InventoryUIState& state) {
         ClearForgeResult(state);
         state.forgeResultId = resultId;
         state.forgeResultQuantity = std::max(1, resultQuantity);
-        state.forgeResultName = ItemNameFromId(state, resultId);
 
         ClearForgeSlot(state, 0);
         ClearForgeSlot(state, 1);
@@ -1350,12 +1395,12 @@ void HandleShopTradeInventoryCandidate(InventoryUIState& state, int inventoryInd
         return;
     }
 
-    if (inventoryIndex < 0 || inventoryIndex >= static_cast<int>(state.inventoryItemIds.size())) {
+    if (inventoryIndex < 0 || inventoryIndex >= static_cast<int>(state.inventorySlots.size())) {
         InvalidateTradeCandidate(state);
         return;
     }
 
-    int itemId = state.inventoryItemIds[inventoryIndex];
+    int itemId = state.inventorySlots[inventoryIndex].itemId;
     if (itemId == 0) {
         InvalidateTradeCandidate(state);
         state.feedbackMessage = "Ofereca um item valido para a troca.";
@@ -1404,6 +1449,7 @@ void HandleShopTradeShopSelection(InventoryUIState& state, int shopIndex) {
 }
 
 void HandleDesequiparWeapon(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (index < 0 || index >= static_cast<int>(state.weaponSlotIds.size())) {
         return;
     }
@@ -1423,6 +1469,7 @@ void HandleDesequiparWeapon(InventoryUIState& state, int index) {
 }
 
 void HandleDesequiparArmor(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (index < 0 || index >= static_cast<int>(state.equipmentSlotIds.size())) {
         return;
     }
@@ -1442,6 +1489,7 @@ void HandleDesequiparArmor(InventoryUIState& state, int index) {
 }
 
 void HandleDiscardWeapon(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (index < 0 || index >= static_cast<int>(state.weaponSlotIds.size())) {
         return;
     }
@@ -1450,6 +1498,7 @@ void HandleDiscardWeapon(InventoryUIState& state, int index) {
 }
 
 void HandleDiscardArmor(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (index < 0 || index >= static_cast<int>(state.equipmentSlotIds.size())) {
         return;
     }
@@ -1458,19 +1507,20 @@ void HandleDiscardArmor(InventoryUIState& state, int index) {
 }
 
 void HandleDiscardInventory(InventoryUIState& state, int index) {
-    if (index < 0 || index >= static_cast<int>(state.inventoryItemIds.size())) {
+    MarkInventoryDirty(state);
+    if (index < 0 || index >= static_cast<int>(state.inventorySlots.size())) {
         return;
     }
-    if (state.inventoryItemIds[index] == 0) {
+    if (state.inventorySlots[index].itemId == 0) {
         return;
     }
-    ItemCategory type = ItemCategoryFromId(state, state.inventoryItemIds[index]);
+    ItemCategory type = ItemCategoryFromId(state, state.inventorySlots[index].itemId);
     if (type == ItemCategory::Consumable) {
         if (!ReduceConsumableStack(state, index, 1)) {
             ShowMessage(state, "Falha ao descartar o consumivel.");
             return;
         }
-        if (state.inventoryItemIds[index] == 0) {
+        if (state.inventorySlots[index].itemId == 0) {
             state.selectedInventoryIndex = -1;
         }
         return;
@@ -1481,6 +1531,7 @@ void HandleDiscardInventory(InventoryUIState& state, int index) {
 }
 
 void HandleSellWeapon(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (index < 0 || index >= static_cast<int>(state.weaponSlotIds.size())) {
         return;
     }
@@ -1501,6 +1552,7 @@ void HandleSellWeapon(InventoryUIState& state, int index) {
 }
 
 void HandleSellArmor(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (index < 0 || index >= static_cast<int>(state.equipmentSlotIds.size())) {
         return;
     }
@@ -1521,14 +1573,15 @@ void HandleSellArmor(InventoryUIState& state, int index) {
 }
 
 void HandleSellInventory(InventoryUIState& state, int index) {
-    if (index < 0 || index >= static_cast<int>(state.inventoryItemIds.size())) {
+    MarkInventoryDirty(state);
+    if (index < 0 || index >= static_cast<int>(state.inventorySlots.size())) {
         return;
     }
-    if (state.inventoryItemIds[index] == 0) {
+    if (state.inventorySlots[index].itemId == 0) {
         ShowMessage(state, "Nenhum item para vender.");
         return;
     }
-    int itemId = state.inventoryItemIds[index];
+    int itemId = state.inventorySlots[index].itemId;
     ItemCategory type = ItemCategoryFromId(state, itemId);
     if (type == ItemCategory::Consumable || type == ItemCategory::Material) {
         int saleValue = CalculateSaleValue(state, itemId, 1);
@@ -1542,7 +1595,7 @@ void HandleSellInventory(InventoryUIState& state, int index) {
         }
         state.coins += saleValue;
         ShowMessage(state, TextFormat("Vendeu 1 unidade por %d moedas.", saleValue));
-        if (state.inventoryItemIds[index] == 0) {
+        if (state.inventorySlots[index].itemId == 0) {
             state.selectedInventoryIndex = -1;
         } else {
             state.selectedInventoryIndex = index;
@@ -1550,7 +1603,7 @@ void HandleSellInventory(InventoryUIState& state, int index) {
         return;
     }
 
-    int quantity = std::max(1, state.inventoryQuantities[index]);
+    int quantity = std::max(1, state.inventorySlots[index].quantity);
     int saleValue = CalculateSaleValue(state, itemId, quantity);
     if (saleValue <= 0) {
         ShowMessage(state, "Item sem valor de venda.");
@@ -1563,10 +1616,11 @@ void HandleSellInventory(InventoryUIState& state, int index) {
 }
 
 void HandleEquipInventory(InventoryUIState& state, int index) {
-    if (index < 0 || index >= static_cast<int>(state.inventoryItemIds.size())) {
+    MarkInventoryDirty(state);
+    if (index < 0 || index >= static_cast<int>(state.inventorySlots.size())) {
         return;
     }
-    int itemId = state.inventoryItemIds[index];
+    int itemId = state.inventorySlots[index].itemId;
     if (itemId == 0) {
         ShowMessage(state, "Nenhum item para equipar.");
         return;
@@ -1581,7 +1635,6 @@ void HandleEquipInventory(InventoryUIState& state, int index) {
             ShowMessage(state, "Esta arma ainda nao pode ser utilizada.");
             return;
         }
-        EnsureWeaponCapacity(state, std::max<size_t>(2, state.weaponSlotIds.size()));
         for (int slot = 0; slot < static_cast<int>(state.weaponSlotIds.size()); ++slot) {
             if (state.weaponSlotIds[slot] == 0) {
                 SetWeaponSlot(state, slot, itemId);
@@ -1596,15 +1649,14 @@ void HandleEquipInventory(InventoryUIState& state, int index) {
     }
 
     if (type == ItemCategory::Armor || canEquipAbilityItem) {
-        EnsureEquipmentCapacity(state, std::max<size_t>(5, state.equipmentSlotIds.size()));
         bool stackable = IsStackableCategory(type);
         bool consumeSingleUnit = canEquipAbilityItem && stackable;
         for (int slot = 0; slot < static_cast<int>(state.equipmentSlotIds.size()); ++slot) {
             if (state.equipmentSlotIds[slot] == 0) {
                 SetEquipmentSlot(state, slot, itemId);
                 if (consumeSingleUnit) {
-                    int availableQuantity = (index < static_cast<int>(state.inventoryQuantities.size()))
-                        ? state.inventoryQuantities[index]
+                    int availableQuantity = (index < static_cast<int>(state.inventorySlots.size()))
+                        ? state.inventorySlots[index].quantity
                         : 1;
                     if (availableQuantity > 1) {
                         SetInventorySlot(state, index, itemId, availableQuantity - 1);
@@ -1629,10 +1681,11 @@ void HandleEquipInventory(InventoryUIState& state, int index) {
 }
 
 void HandleSendInventoryToForge(InventoryUIState& state, int index) {
-    if (index < 0 || index >= static_cast<int>(state.inventoryItemIds.size())) {
+    MarkInventoryDirty(state);
+    if (index < 0 || index >= static_cast<int>(state.inventorySlots.size())) {
         return;
     }
-    int itemId = state.inventoryItemIds[index];
+    int itemId = state.inventorySlots[index].itemId;
     if (itemId == 0) {
         ShowMessage(state, "Nenhum item selecionado.");
         return;
@@ -1653,10 +1706,9 @@ void HandleSendInventoryToForge(InventoryUIState& state, int index) {
         return;
     }
     state.forgeInputIds[slot] = itemId;
-    state.forgeInputNames[slot] = ItemNameFromId(state, itemId);
     state.forgeInputQuantities[slot] = 1;
 
-    int availableQuantity = (index < static_cast<int>(state.inventoryQuantities.size())) ? state.inventoryQuantities[index] : 1;
+    int availableQuantity = (index < static_cast<int>(state.inventorySlots.size())) ? state.inventorySlots[index].quantity : 1;
     if (availableQuantity > 1) {
         SetInventorySlot(state, index, itemId, availableQuantity - 1);
         state.selectedInventoryIndex = index;
@@ -1669,6 +1721,7 @@ void HandleSendInventoryToForge(InventoryUIState& state, int index) {
 }
 
 void HandleSendWeaponToForge(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (index < 0 || index >= static_cast<int>(state.weaponSlotIds.size())) {
         return;
     }
@@ -1688,7 +1741,6 @@ void HandleSendWeaponToForge(InventoryUIState& state, int index) {
         return;
     }
     state.forgeInputIds[slot] = itemId;
-    state.forgeInputNames[slot] = ItemNameFromId(state, itemId);
     state.forgeInputQuantities[slot] = 1;
     SetWeaponSlot(state, index, 0);
     state.selectedWeaponIndex = -1;
@@ -1697,6 +1749,7 @@ void HandleSendWeaponToForge(InventoryUIState& state, int index) {
 }
 
 void HandleSendArmorToForge(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (index < 0 || index >= static_cast<int>(state.equipmentSlotIds.size())) {
         return;
     }
@@ -1716,7 +1769,6 @@ void HandleSendArmorToForge(InventoryUIState& state, int index) {
         return;
     }
     state.forgeInputIds[slot] = itemId;
-    state.forgeInputNames[slot] = ItemNameFromId(state, itemId);
     state.forgeInputQuantities[slot] = 1;
     SetEquipmentSlot(state, index, 0);
     state.selectedEquipmentIndex = -1;
@@ -1725,6 +1777,7 @@ void HandleSendArmorToForge(InventoryUIState& state, int index) {
 }
 
 void HandleRemoveFromForge(InventoryUIState& state, int slot) {
+    MarkInventoryDirty(state);
     if (slot == 0 || slot == 1) {
         int itemId = state.forgeInputIds[slot];
         if (itemId == 0) {
@@ -1759,11 +1812,12 @@ void HandleRemoveFromForge(InventoryUIState& state, int slot) {
 }
 
 void HandleChestWithdraw(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (!state.hasActiveChest || state.activeChest == nullptr) {
         ShowMessage(state, "Nenhum bau ativo.");
         return;
     }
-    if (index < 0 || index >= static_cast<int>(state.chestItemIds.size())) {
+    if (index < 0 || index >= state.chestSlotCount) {
         ShowMessage(state, "Selecione um item valido do bau.");
         return;
     }
@@ -1774,18 +1828,11 @@ void HandleChestWithdraw(InventoryUIState& state, int index) {
         return;
     }
 
-    const std::vector<int> prevIds = state.inventoryItemIds;
-    const std::vector<std::string> prevNames = state.inventoryItems;
-    const std::vector<int> prevQuantities = state.inventoryQuantities;
-    const std::vector<ItemCategory> prevTypes = state.inventoryTypes;
+    const std::array<ItemSlot, kInventorySlotCount> prevSlots = state.inventorySlots;
 
     int addedSlot = AddItemToInventory(state, slot.itemId, std::max(1, slot.quantity));
     if (addedSlot < 0) {
-        state.inventoryItemIds = prevIds;
-        state.inventoryItems = prevNames;
-        state.inventoryQuantities = prevQuantities;
-        state.inventoryTypes = prevTypes;
-        EnsureInventoryMeta(state);
+        state.inventorySlots = prevSlots;
         ShowMessage(state, "Sem espaco no inventario.");
         return;
     }
@@ -1798,10 +1845,11 @@ void HandleChestWithdraw(InventoryUIState& state, int index) {
 }
 
 void HandleChestDiscard(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     if (!state.hasActiveChest || state.activeChest == nullptr) {
         return;
     }
-    if (index < 0 || index >= static_cast<int>(state.chestItemIds.size())) {
+    if (index < 0 || index >= state.chestSlotCount) {
         return;
     }
     state.activeChest->ClearSlot(index);
@@ -1811,6 +1859,7 @@ void HandleChestDiscard(InventoryUIState& state, int index) {
 }
 
 void HandleChestDeposit(InventoryUIState& state, int inventoryIndex) {
+    MarkInventoryDirty(state);
     if (!state.hasActiveChest || state.activeChest == nullptr) {
         ShowMessage(state, "Nenhum bau ativo.");
         return;
@@ -1819,18 +1868,18 @@ void HandleChestDeposit(InventoryUIState& state, int inventoryIndex) {
         ShowMessage(state, "Este bau nao aceita deposito.");
         return;
     }
-    if (inventoryIndex < 0 || inventoryIndex >= static_cast<int>(state.inventoryItemIds.size())) {
+    if (inventoryIndex < 0 || inventoryIndex >= static_cast<int>(state.inventorySlots.size())) {
         ShowMessage(state, "Selecione um item valido do inventario.");
         return;
     }
 
-    int itemId = state.inventoryItemIds[inventoryIndex];
+    int itemId = state.inventorySlots[inventoryIndex].itemId;
     if (itemId == 0) {
         ShowMessage(state, "Slot vazio.");
         return;
     }
 
-    int quantity = std::max(1, state.inventoryQuantities[inventoryIndex]);
+    int quantity = std::max(1, state.inventorySlots[inventoryIndex].quantity);
     if (!ChestCanAccept(*state.activeChest, state, itemId, quantity)) {
         ShowMessage(state, "O bau nao tem espaco suficiente.");
         return;
@@ -1850,6 +1899,7 @@ void HandleChestDeposit(InventoryUIState& state, int inventoryIndex) {
 }
 
 void HandleChestTakeAll(InventoryUIState& state) {
+    MarkInventoryDirty(state);
     if (!state.hasActiveChest || state.activeChest == nullptr) {
         ShowMessage(state, "Nenhum bau ativo.");
         return;
@@ -1870,10 +1920,7 @@ void HandleChestTakeAll(InventoryUIState& state) {
         return;
     }
 
-    const std::vector<int> prevIds = state.inventoryItemIds;
-    const std::vector<std::string> prevNames = state.inventoryItems;
-    const std::vector<int> prevQuantities = state.inventoryQuantities;
-    const std::vector<ItemCategory> prevTypes = state.inventoryTypes;
+    const std::array<ItemSlot, kInventorySlotCount> prevSlots = state.inventorySlots;
     const int previousSelectedInventory = state.selectedInventoryIndex;
 
     std::vector<int> addedSlots;
@@ -1884,11 +1931,7 @@ void HandleChestTakeAll(InventoryUIState& state) {
         const Chest::Slot& slot = slots[static_cast<size_t>(slotIndex)];
         int addedSlot = AddItemToInventory(state, slot.itemId, entry.second);
         if (addedSlot < 0) {
-            state.inventoryItemIds = prevIds;
-            state.inventoryItems = prevNames;
-            state.inventoryQuantities = prevQuantities;
-            state.inventoryTypes = prevTypes;
-            EnsureInventoryMeta(state);
+            state.inventorySlots = prevSlots;
             state.selectedInventoryIndex = previousSelectedInventory;
             ShowMessage(state, "Sem espaco para pegar tudo.");
             return;
@@ -1909,19 +1952,20 @@ void HandleChestTakeAll(InventoryUIState& state) {
 }
 
 void HandleBuyFromShop(InventoryUIState& state, int index) {
+    MarkInventoryDirty(state);
     ResetShopTradeState(state);
-    if (index < 0 || index >= static_cast<int>(state.shopItemIds.size())) {
+    if (index < 0 || index >= static_cast<int>(state.shopSlots.size())) {
         return;
     }
-    if (index >= static_cast<int>(state.shopStock.size()) || state.shopStock[index] <= 0) {
+    if (index >= static_cast<int>(state.shopSlots.size()) || state.shopSlots[index].stock <= 0) {
         ShowMessage(state, "Este item nao esta mais disponivel.");
         return;
     }
-    if (state.coins < state.shopPrices[index]) {
+    if (state.coins < state.shopSlots[index].price) {
         ShowMessage(state, "Moedas insuficientes.");
         return;
     }
-    int itemId = state.shopItemIds[index];
+    int itemId = state.shopSlots[index].itemId;
     if (itemId == 0) {
         ShowMessage(state, "Item indisponivel.");
         return;
@@ -1931,8 +1975,8 @@ void HandleBuyFromShop(InventoryUIState& state, int index) {
         ShowMessage(state, "Sem espaco no inventario.");
         return;
     }
-    state.coins -= state.shopPrices[index];
-    state.shopStock[index] = std::max(0, state.shopStock[index] - 1);
+    state.coins -= state.shopSlots[index].price;
+    state.shopSlots[index].stock = std::max(0, state.shopSlots[index].stock - 1);
     ShowMessage(state, "Compra realizada.");
     state.selectedInventoryIndex = slot;
     state.selectedShopIndex = index;
@@ -1940,6 +1984,12 @@ void HandleBuyFromShop(InventoryUIState& state, int index) {
 
 void DrawMultilineText(const Rectangle& area, const std::string& text, float fontSize);
 
+// Contorno de seleção desenhado por fora do slot (não cobre o sprite).
+void DrawSlotSelection(Rectangle rect) {
+    Rectangle selectionRect{rect.x - 3.0f, rect.y - 3.0f, rect.width + 6.0f, rect.height + 6.0f};
+    Counted::DrawRectangleLinesEx(selectionRect, 1.0f, Color{255, 230, 160, 255});
+}
+
 void DrawSlot(const InventoryUIState& state,
               Rectangle rect,
               const std::string& label,
@@ -1947,12 +1997,11 @@ void DrawSlot(const InventoryUIState& state,
               int itemId,
               int quantity = -1,
               bool showQuantity = true) {
-    DrawRectangleRec(rect, Color{54, 58, 72, 220});
-    DrawRectangleLinesEx(rect, 2.0f, ResolveBorderColor(state, itemId));
+    Counted::DrawRectangleRec(rect, Color{54, 58, 72, 220});
+    Counted::DrawRectangleLinesEx(rect, 2.0f, ResolveBorderColor(state, itemId));
 
     if (selected) {
-        Rectangle selectionRect{rect.x - 3.0f, rect.y - 3.0f, rect.width + 6.0f, rect.height + 6.0f};
-        DrawRectangleLinesEx(selectionRect, 1.0f, Color{255, 230, 160, 255});
+        DrawSlotSelection(rect);
     }
 
     bool drewInventorySprite = false;
@@ -1961,20 +2010,20 @@ void DrawSlot(const InventoryUIState& state,
             drewInventorySprite = DrawWeaponInventorySprite(*blueprint, rect);
         } else if (const ItemDefinition* def = FindItemDefinition(state, itemId)) {
             if (!def->inventorySpritePath.empty()) {
-                Texture2D texture = AcquireInventorySpriteTexture(def->inventorySpritePath);
-                if (texture.id != 0) {
-                    Rectangle src{0.0f, 0.0f, static_cast<float>(texture.width), static_cast<float>(texture.height)};
+                const TextureRegion& region = AcquireInventorySpriteTexture(def->inventorySpritePath);
+                if (region.texture.id != 0) {
+                    Rectangle src{0.0f, 0.0f, region.bounds.width, region.bounds.height};
                     Vector2 center{rect.x + rect.width * 0.5f, rect.y + rect.height * 0.5f};
                     Vector2 drawSize = def->inventorySpriteDrawSize;
                     if (drawSize.x <= 0.0f || drawSize.y <= 0.0f) {
-                        float maxDim = std::max(1.0f, static_cast<float>(std::max(texture.width, texture.height)));
+                        float maxDim = std::max(1.0f, std::max(region.bounds.width, region.bounds.height));
                         float targetDim = std::max(0.0f, std::min(rect.width, rect.height) - kInventorySpritePadding);
                         float scale = targetDim > 0.0f ? std::min(1.0f, targetDim / maxDim) : 1.0f;
-                        drawSize = Vector2{static_cast<float>(texture.width) * scale, static_cast<float>(texture.height) * scale};
+                        drawSize = Vector2{region.bounds.width * scale, region.bounds.height * scale};
                     }
                     Rectangle dest{center.x, center.y, drawSize.x, drawSize.y};
                     Vector2 origin{dest.width * 0.5f, dest.height * 0.5f};
-                    DrawTexturePro(texture, src, dest, origin, 0.0f, WHITE);
+                    DrawTextureRegion(region, src, dest, origin, 0.0f, WHITE);
                     drewInventorySprite = true;
                 }
             }
@@ -1984,15 +2033,15 @@ void DrawSlot(const InventoryUIState& state,
     if (!drewInventorySprite && !label.empty()) {
         const float fontSize = 16.0f;
         Rectangle textBounds{rect.x + 6.0f, rect.y + 6.0f, rect.width - 12.0f, rect.height - 12.0f};
-        std::vector<std::string> lines = WrapTextLines(label, textBounds.width, fontSize);
+        const std::vector<std::string>& lines = WrapTextLines(label, textBounds.width, fontSize);
         DrawLineList(lines, Vector2{textBounds.x, textBounds.y}, fontSize, Color{58, 68, 96, 255});
     }
 
     if (showQuantity && quantity >= 0) {
         std::string qty = std::to_string(quantity);
-        Vector2 measure = MeasureTextEx(GetGameFont(), qty.c_str(), 14.0f, 0.0f);
+        Vector2 measure = MeasureTextEx(GetGameFont(14.0f), qty.c_str(), 14.0f, 0.0f);
         Vector2 pos{rect.x + rect.width - measure.x - 5.0f, rect.y + rect.height - measure.y - 3.0f};
-        DrawTextEx(GetGameFont(), qty.c_str(), pos, 14.0f, 0.0f, Color{210, 225, 255, 255});
+        Counted::DrawTextEx(GetGameFont(14.0f), qty.c_str(), pos, 14.0f, 0.0f, Color{210, 225, 255, 255});
     }
 }
 
@@ -2003,24 +2052,24 @@ bool SlotClicked(Rectangle rect) {
 void DrawAttributeLabel(Vector2 position, const std::string& label, int value) {
     const float fontSize = 20.0f;
     std::string text = label + ": " + std::to_string(value);
-    DrawTextEx(GetGameFont(), text.c_str(), position, fontSize, kBodyTextSpacing, Color{58, 68, 96, 255});
+    Counted::DrawTextEx(GetGameFont(fontSize), text.c_str(), position, fontSize, kBodyTextSpacing, Color{58, 68, 96, 255});
 }
 
 void DrawAttributeLabel(Vector2 position, const std::string& label, float value, int decimals = 2) {
     const float fontSize = 20.0f;
     std::string text = label + ": " + std::string(TextFormat("%0.*f", decimals, value));
-    DrawTextEx(GetGameFont(), text.c_str(), position, fontSize, kBodyTextSpacing, Color{58, 68, 96, 255});
+    Counted::DrawTextEx(GetGameFont(fontSize), text.c_str(), position, fontSize, kBodyTextSpacing, Color{58, 68, 96, 255});
 }
 
 void DrawMultilineText(const Rectangle& area, const std::string& text, float fontSize) {
-    const Font& font = GetGameFont();
+    const Font& font = GetGameFont(fontSize);
     float lineSpacing = 6.0f;
     float y = area.y;
     size_t start = 0;
     while (start < text.size() && y < area.y + area.height - fontSize) {
         size_t end = text.find('\n', start);
         std::string line = text.substr(start, (end == std::string::npos) ? text.size() - start : end - start);
-        DrawTextEx(font, line.c_str(), Vector2{area.x, y}, fontSize, kBodyTextSpacing, Color{58, 68, 96, 255});
+        Counted::DrawTextEx(font, line.c_str(), Vector2{area.x, y}, fontSize, kBodyTextSpacing, Color{58, 68, 96, 255});
         y += fontSize + lineSpacing;
         if (end == std::string::npos) {
             break;
@@ -2029,8 +2078,267 @@ void DrawMultilineText(const Rectangle& area, const std::string& text, float fon
     }
 }
 
+constexpr float kInventorySlotSize = 64.0f;    // Define a largura/altura dos slots
+constexpr float kInventorySlotSpacing = 12.0f; // Define o espaco entre os slots
+constexpr int kInventoryColumns = 8;           // Numero de colunas na grade
+constexpr int kInventoryRows = 3;              // Numero de linhas na grade
+
+// Retângulos fixos do painel, compartilhados entre a camada em cache e a parte interativa.
+struct InventoryPanelLayout {
+    Rectangle window{};
+    Rectangle attributes{};
+    Rectangle content{};
+    Rectangle panelLabel{};
+    Rectangle weaponsLabel{};
+    Rectangle equipLabel{};
+    Rectangle inventoryLabel{};
+    Rectangle coinsLabel{};
+    Rectangle detail{};
+    std::array<Rectangle, 2> weaponSlots{};
+    std::array<Rectangle, 5> equipmentSlots{};
+    std::array<Rectangle, kInventoryColumns * kInventoryRows> inventorySlots{};
+};
+
+InventoryPanelLayout ComputeInventoryPanelLayout(Vector2 screenSize) {
+    InventoryPanelLayout layout{};
+    const float windowWidth = std::min(1720.0f, screenSize.x - 40.0f); // Limite e largura total da janela
+    const float windowHeight = std::min(860.0f, screenSize.y - 140.0f); // Limite e altura total da janela
+    layout.window = Rectangle{
+        screenSize.x * 0.5f - windowWidth * 0.5f,
+        screenSize.y * 0.5f - windowHeight * 0.5f,
+        windowWidth,
+        windowHeight
+    };
+
+    const Rectangle& windowRect = layout.window;
+    const float padding = 22.0f; // Margem interna entre bordas da janela e blocos
+    layout.attributes = Rectangle{windowRect.x + padding, windowRect.y + padding, 360.0f, windowRect.height - padding * 2.0f}; // Largura e altura da coluna de atributos
+    layout.content = Rectangle{
+        layout.attributes.x + layout.attributes.width + padding,
+        windowRect.y + padding,
+        windowRect.width - layout.attributes.width - padding * 3.0f,
+        windowRect.height - padding * 2.0f
+    };
+
+    const Rectangle& contentRect = layout.content;
+    layout.panelLabel = Rectangle{contentRect.x + 18.0f, contentRect.y - 14.0f, 132.0f, 24.0f};
+    layout.weaponsLabel = Rectangle{contentRect.x + 10.0f, contentRect.y + 32.0f, 140.0f, 22.0f}; // Reposiciona o titulo "Armas"
+    for (int i = 0; i < static_cast<int>(layout.weaponSlots.size()); ++i) {
+        layout.weaponSlots[i] = Rectangle{
+            contentRect.x + 10.0f + (kInventorySlotSize + kInventorySlotSpacing) * i,
+            contentRect.y + 48.0f,
+            kInventorySlotSize,
+            kInventorySlotSize
+        };
+    }
+
+    layout.equipLabel = Rectangle{contentRect.x + 10.0f, layout.weaponsLabel.y + 28.0f + kInventorySlotSize, 160.0f, 22.0f}; // Move o titulo "Equipamento"
+    for (int i = 0; i < static_cast<int>(layout.equipmentSlots.size()); ++i) {
+        layout.equipmentSlots[i] = Rectangle{
+            contentRect.x + 10.0f + (kInventorySlotSize + kInventorySlotSpacing) * i,
+            layout.equipLabel.y + 22.0f,
+            kInventorySlotSize,
+            kInventorySlotSize
+        };
+    }
+
+    layout.inventoryLabel = Rectangle{contentRect.x + 10.0f, layout.equipLabel.y + 30.0f + kInventorySlotSize, 160.0f, 22.0f}; // Move o titulo "Inventario"
+    for (int row = 0; row < kInventoryRows; ++row) {
+        for (int col = 0; col < kInventoryColumns; ++col) {
+            layout.inventorySlots[row * kInventoryColumns + col] = Rectangle{
+                contentRect.x + 10.0f + (kInventorySlotSize + kInventorySlotSpacing) * col,
+                layout.inventoryLabel.y + 20.0f + (kInventorySlotSize + kInventorySlotSpacing) * row,
+                kInventorySlotSize,
+                kInventorySlotSize
+            };
+        }
+    }
+
+    layout.coinsLabel = Rectangle{contentRect.x + 10.0f, layout.inventoryLabel.y + 20.0f + (kInventorySlotSize + kInventorySlotSpacing) * kInventoryRows + 12.0f, 180.0f, 24.0f};
+
+    // Detail panel on the right
+    const float detailPanelWidth = contentRect.width * 0.48f; // Largura dedicada ao painel de detalhes (percentual do conteudo)
+    const float detailPanelMargin = 8.0f;    // Espaco entre o painel de detalhes e o restante do conteudo
+    layout.detail = Rectangle{
+        contentRect.x + contentRect.width - detailPanelWidth - detailPanelMargin,
+        contentRect.y + 32.0f,
+        detailPanelWidth,
+        contentRect.height - 44.0f
+    };
+    // Ajuste a posicao/largura/altura acima para remodelar o painel de detalhes à direita
+    return layout;
+}
+
+// Partes do painel que só mudam com o conteúdo: molduras, coluna de atributos, rótulos e itens dos slots.
+// Seleção, botões, painel de detalhes e abas de forja/loja/baú são desenhados por cima a cada quadro.
+void DrawInventoryStaticContent(const InventoryUIState& state,
+                                const PlayerCharacter& player,
+                                const InventoryPanelLayout& layout) {
+    GuiPanel(layout.window, nullptr);
+    GuiGroupBox(layout.attributes, "Personagem");
+
+    Vector2 attrPos{layout.attributes.x + 20.0f, layout.attributes.y + 36.0f};
+    constexpr float kLineSpacing = 22.0f;
+    constexpr float kGroupSpacing = 28.0f;
+    auto drawIntStat = [&](const char* label, int value, float spacing) {
+        DrawAttributeLabel(attrPos, label, value);
+        attrPos.y += spacing;
+    };
+    auto drawFloatStat = [&](const char* label, float value, int decimals, float spacing) {
+        DrawAttributeLabel(attrPos, label, value, decimals);
+        attrPos.y += spacing;
+    };
+
+    drawIntStat("Vida", static_cast<int>(std::round(player.currentHealth)), 26.0f);
+    drawIntStat("Vida Max", static_cast<int>(std::round(player.derivedStats.maxHealth)), kGroupSpacing);
+
+    drawIntStat("Poder", player.totalAttributes.primary.poder, kLineSpacing);
+    drawIntStat("Defesa", player.totalAttributes.primary.defesa, kLineSpacing);
+    drawIntStat("Vigor", player.totalAttributes.primary.vigor, kLineSpacing);
+    drawIntStat("Velocidade", player.totalAttributes.primary.velocidade, kLineSpacing);
+    drawIntStat("Destreza", player.totalAttributes.primary.destreza, kLineSpacing);
+    drawIntStat("Inteligencia", player.totalAttributes.primary.inteligencia, kGroupSpacing);
+
+    drawIntStat("Constituicao", player.totalAttributes.attack.constituicao, kLineSpacing);
+    drawIntStat("Forca", player.totalAttributes.attack.forca, kLineSpacing);
+    drawIntStat("Foco", player.totalAttributes.attack.foco, kLineSpacing);
+    drawIntStat("Misticismo", player.totalAttributes.attack.misticismo, kLineSpacing);
+    drawIntStat("Conhecimento", player.totalAttributes.attack.conhecimento, kGroupSpacing);
+
+    drawFloatStat("Vampirismo", player.totalAttributes.secondary.vampirismo, 2, kLineSpacing);
+    drawFloatStat("Letalidade", player.totalAttributes.secondary.letalidade, 2, kLineSpacing);
+    drawFloatStat("Reducao de Dano", player.totalAttributes.secondary.reducaoDano, 2, kLineSpacing);
+    drawFloatStat("Desvio", player.totalAttributes.secondary.desvio, 2, kLineSpacing);
+    drawFloatStat("Sorte", player.totalAttributes.secondary.sorte, 2, kLineSpacing);
+    drawIntStat("Maldicao", player.totalAttributes.secondary.maldicao, kLineSpacing);
+
+    GuiPanel(layout.content, nullptr);
+    Color panelLabelBg = GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR));
+    Counted::DrawRectangleRec(layout.panelLabel, panelLabelBg);
+    Counted::DrawTextEx(GetGameFont(20.0f), "Inventario", Vector2{layout.panelLabel.x + 6.0f, layout.panelLabel.y + 4.0f}, 20.0f, kBodyTextSpacing, Color{58, 68, 96, 255});
+
+    GuiLabel(layout.weaponsLabel, "Armas");
+    for (int i = 0; i < static_cast<int>(layout.weaponSlots.size()); ++i) {
+        int weaponId = state.weaponSlotIds[i];
+        DrawSlot(state, layout.weaponSlots[i], ItemNameFromId(state, weaponId), false, weaponId);
+    }
+
+    GuiLabel(layout.equipLabel, "Equipamento");
+    for (int i = 0; i < static_cast<int>(layout.equipmentSlots.size()); ++i) {
+        int equipmentId = state.equipmentSlotIds[i];
+        DrawSlot(state, layout.equipmentSlots[i], ItemNameFromId(state, equipmentId), false, equipmentId);
+    }
+
+    GuiLabel(layout.inventoryLabel, "Inventario");
+    for (int index = 0; index < static_cast<int>(layout.inventorySlots.size()); ++index) {
+        const ItemSlot& slot = state.inventorySlots[index];
+        const std::string& label = ItemNameFromId(state, slot.itemId);
+        ItemCategory slotType = ItemCategoryFromId(state, slot.itemId);
+        bool showQuantity = (slotType == ItemCategory::Consumable || slotType == ItemCategory::Material);
+        int quantity = (showQuantity && !label.empty()) ? slot.quantity : -1;
+        DrawSlot(state, layout.inventorySlots[index], label, false, slot.itemId, quantity, showQuantity);
+    }
+
+    GuiLabel(layout.coinsLabel, TextFormat("Moedas: %d", state.coins));
+    GuiGroupBox(layout.detail, "Detalhes");
+}
+
+// Tudo o que altera a camada estática; qualquer diferença força o redesenho da render texture.
+struct InventoryLayerKey {
+    std::uint32_t contentVersion{0};
+    PlayerAttributes attributes{};
+    int health{0};
+    int maxHealth{0};
+    unsigned int fontGeneration{0};
+    std::uint64_t textureGeneration{0}; // Sprites que terminam de carregar depois do último redesenho
+    Rectangle window{};
+
+    bool operator==(const InventoryLayerKey& other) const {
+        return contentVersion == other.contentVersion && attributes == other.attributes &&
+               health == other.health && maxHealth == other.maxHealth &&
+               fontGeneration == other.fontGeneration && textureGeneration == other.textureGeneration &&
+               window.x == other.window.x && window.y == other.window.y &&
+               window.width == other.window.width && window.height == other.window.height;
+    }
+};
+
+// Render texture do tamanho da janela do inventário com a camada estática já composta.
+struct InventoryLayerCache {
+    RenderTexture2D target{};
+    InventoryLayerKey key{};
+    bool valid{false};
+};
+
+InventoryLayerCache g_inventoryLayer{};
+
+// Redesenha a camada na render texture somente quando a chave muda e a desenha em uma única chamada.
+void DrawInventoryStaticLayer(const InventoryUIState& state,
+                              const PlayerCharacter& player,
+                              const InventoryPanelLayout& layout) {
+    InventoryLayerKey key{};
+    key.contentVersion = state.contentVersion;
+    key.attributes = player.totalAttributes;
+    key.health = static_cast<int>(std::round(player.currentHealth));
+    key.maxHealth = static_cast<int>(std::round(player.derivedStats.maxHealth));
+    key.fontGeneration = GetGameFontGeneration();
+    key.textureGeneration = GetTextureResidencyGeneration();
+    key.window = layout.window;
+
+    const int width = static_cast<int>(std::ceil(layout.window.width));
+    const int height = static_cast<int>(std::ceil(layout.window.height));
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    if (!g_inventoryLayer.valid || !(g_inventoryLayer.key == key)) {
+        RenderTexture2D& target = g_inventoryLayer.target;
+        if (target.id == 0 || target.texture.width != width || target.texture.height != height) {
+            if (target.id != 0) {
+                UnloadRenderTexture(target);
+            }
+            target = LoadRenderTexture(width, height);
+            SetTextureFilter(target.texture, TEXTURE_FILTER_POINT);
+        }
+
+        BeginTextureMode(target);
+        ClearBackground(BLANK);
+        // Alfa acumulado em vez de multiplicado: slots translúcidos sobre o painel opaco continuam opacos na textura.
+        rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA, RL_FUNC_ADD, RL_FUNC_ADD);
+        BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+        rlPushMatrix();
+        rlTranslatef(-layout.window.x, -layout.window.y, 0.0f);
+        DrawInventoryStaticContent(state, player, layout);
+        rlPopMatrix();
+        EndBlendMode();
+        EndTextureMode();
+
+        g_inventoryLayer.key = key;
+        g_inventoryLayer.valid = true;
+    }
+
+    const Texture2D& texture = g_inventoryLayer.target.texture;
+    Counted::DrawTexturePro(texture,
+                            Rectangle{0.0f, 0.0f, static_cast<float>(texture.width), -static_cast<float>(texture.height)},
+                            Rectangle{layout.window.x, layout.window.y, static_cast<float>(texture.width), static_cast<float>(texture.height)},
+                            Vector2{0.0f, 0.0f},
+                            0.0f,
+                            WHITE);
+}
+
 } // namespace
 
+void MarkInventoryDirty(InventoryUIState& state) {
+    // Contador global (não por estado): o reset de run recria InventoryUIState, mas a camada em cache sobrevive.
+    state.contentVersion = NextStatVersion();
+}
+
+void UnloadInventoryUICache() {
+    if (g_inventoryLayer.target.id != 0) {
+        UnloadRenderTexture(g_inventoryLayer.target);
+    }
+    g_inventoryLayer = InventoryLayerCache{};
+}
+
 PlayerAttributes GatherEquipmentBonuses(const InventoryUIState& state) {
     PlayerAttributes totals{};
     for (int itemId : state.equipmentSlotIds) {
@@ -2044,7 +2352,7 @@ PlayerAttributes GatherEquipmentBonuses(const InventoryUIState& state) {
         if (def->category != ItemCategory::Armor) {
             continue;
         }
-        totals = AddAttributes(totals, def->attributeBonuses);
+        AddAttributesInPlace(totals, def->attributeBonuses);
     }
     return totals;
 }
@@ -2054,25 +2362,20 @@ const ItemDefinition* GetItemDefinition(const InventoryUIState& state, int id) {
 }
 
 void SetEquipmentSlot(InventoryUIState& state, int index, int itemId) {
-    if (index < 0) {
+    MarkInventoryDirty(state);
+    if (index < 0 || index >= static_cast<int>(state.equipmentSlotIds.size())) {
         return;
     }
-    EnsureEquipmentCapacity(state, static_cast<size_t>(index) + 1);
     state.equipmentSlotIds[index] = itemId;
-    state.equipmentSlots[index] = ItemNameFromId(state, itemId);
-    if (index < static_cast<int>(state.equipmentAbilityCooldowns.size())) {
-        state.equipmentAbilityCooldowns[index] = 0.0f;
-    }
+    state.equipmentAbilityCooldowns[index] = 0.0f;
+    state.equipmentVersion = NextStatVersion();
 }
 
 bool SyncEquipmentBonuses(const InventoryUIState& state, PlayerCharacter& player) {
-    PlayerAttributes desired = GatherEquipmentBonuses(state);
-    if (player.equipmentBonuses == desired) {
+    if (player.HasModifiersFrom(StatModifierSource::Equipment, state.equipmentVersion)) {
         return false;
     }
-    player.equipmentBonuses = desired;
-    player.RecalculateStats();
-    return true;
+    return player.SetModifiers(StatModifierSource::Equipment, GatherEquipmentBonuses(state), state.equipmentVersion);
 }
 
 void EnsureCommonChestLoot(CommonChest& chest, const InventoryUIState& state) {
@@ -2086,55 +2389,39 @@ void EnsureCommonChestLoot(CommonChest& chest, const InventoryUIState& state) {
         slot.quantity = 0;
     }
 
-    std::vector<const ItemDefinition*> lootPool;
-    lootPool.reserve(state.items.size());
-    for (const ItemDefinition& def : state.items) {
-        if (def.id <= 0) {
-            continue;
-        }
-        if (def.category == ItemCategory::None) {
-            continue;
-        }
-        lootPool.push_back(&def);
-    }
-
-    if (lootPool.empty()) {
+    const LootTable& lootTable = g_lootTables.Get(state.items, LootSource::Chest, state.lootBiome, state.lootLuckBonus);
+    if (lootTable.Empty()) {
         chest.MarkGenerated();
         return;
     }
 
-    std::mt19937_64 rng(chest.LootSeed());
+    RandomStream rng(chest.LootSeed());
 
     std::vector<int> slotIndices(static_cast<size_t>(chest.Capacity()));
     std::iota(slotIndices.begin(), slotIndices.end(), 0);
-    std::shuffle(slotIndices.begin(), slotIndices.end(), rng);
+    rng.Shuffle(slotIndices.begin(), slotIndices.end());
 
     int maxSlotsToFill = std::min(static_cast<int>(slotIndices.size()), 3);
     maxSlotsToFill = std::max(1, maxSlotsToFill);
-    std::uniform_int_distribution<int> countDist(1, maxSlotsToFill);
-    int slotsToFill = std::min(countDist(rng), static_cast<int>(slotIndices.size()));
+    int slotsToFill = std::min(rng.RangeInt(1, maxSlotsToFill), static_cast<int>(slotIndices.size()));
 
     if (slotsToFill <= 0) {
         chest.MarkGenerated();
         return;
     }
 
-    std::uniform_int_distribution<int> poolDist(0, static_cast<int>(lootPool.size()) - 1);
-
     for (int i = 0; i < slotsToFill; ++i) {
         int slotIndex = slotIndices[static_cast<size_t>(i)];
-        const ItemDefinition* def = lootPool[static_cast<size_t>(poolDist(rng))];
+        const ItemDefinition* def = FindItemDefinition(state, lootTable.Sample(rng()));
         if (def == nullptr) {
             continue;
         }
 
         int quantity = 1;
         if (def->category == ItemCategory::Consumable) {
-            std::uniform_int_distribution<int> qtyDist(1, std::min(3, MaxStackForCategory(def->category)));
-            quantity = qtyDist(rng);
+            quantity = rng.RangeInt(1, std::min(3, MaxStackForCategory(def->category)));
         } else if (def->category == ItemCategory::Material) {
-            std::uniform_int_distribution<int> qtyDist(2, std::min(6, MaxStackForCategory(def->category)));
-            quantity = qtyDist(rng);
+            quantity = rng.RangeInt(2, std::min(6, MaxStackForCategory(def->category)));
         }
 
         chest.SetSlot(slotIndex, def->id, quantity);
@@ -2145,39 +2432,25 @@ void EnsureCommonChestLoot(CommonChest& chest, const InventoryUIState& state) {
 
 void RefreshChestView(InventoryUIState& state) {
     if (!state.hasActiveChest || state.activeChest == nullptr) {
-        state.chestItemIds.clear();
-        state.chestItems.clear();
-        state.chestQuantities.clear();
-        state.chestTypes.clear();
+        state.chestSlotCount = 0;
         state.selectedChestIndex = -1;
         return;
     }
 
     const auto& slots = state.activeChest->GetSlots();
-    size_t capacity = slots.size();
-    state.chestItemIds.resize(capacity, 0);
-    state.chestItems.resize(capacity);
-    state.chestQuantities.resize(capacity, 0);
-    state.chestTypes.resize(capacity, ItemCategory::None);
+    if (slots.size() > state.chestSlots.size()) {
+        std::cerr << "[Inventory] Bau com " << slots.size() << " slots; exibindo apenas " << state.chestSlots.size() << std::endl;
+    }
+    size_t capacity = std::min(slots.size(), state.chestSlots.size());
+    state.chestSlotCount = static_cast<int>(capacity);
 
     for (size_t i = 0; i < capacity; ++i) {
         const Chest::Slot& slot = slots[i];
-        state.chestItemIds[i] = slot.itemId;
-        if (slot.itemId > 0) {
-            const ItemDefinition* def = FindItemDefinition(state, slot.itemId);
-            state.chestItems[i] = def ? def->name : ItemNameFromId(state, slot.itemId);
-            ItemCategory category = def ? def->category : ItemCategoryFromId(state, slot.itemId);
-            state.chestTypes[i] = category;
-            state.chestQuantities[i] = slot.quantity;
-        } else {
-            state.chestItems[i].clear();
-            state.chestQuantities[i] = 0;
-            state.chestTypes[i] = ItemCategory::None;
-        }
+        state.chestSlots[i] = (slot.itemId > 0) ? ItemSlot{slot.itemId, slot.quantity} : ItemSlot{};
     }
 
     if (state.selectedChestIndex >= static_cast<int>(capacity) ||
-        (state.selectedChestIndex >= 0 && state.chestItemIds[static_cast<size_t>(state.selectedChestIndex)] == 0)) {
+        (state.selectedChestIndex >= 0 && state.chestSlots[static_cast<size_t>(state.selectedChestIndex)].itemId == 0)) {
         state.selectedChestIndex = -1;
     }
 }
@@ -2221,20 +2494,10 @@ void LoadForgeContents(InventoryUIState& state, const ForgeInstance& forge) {
         const auto& slot = forge.contents.inputs[i];
         state.forgeInputIds[i] = slot.itemId;
         state.forgeInputQuantities[i] = (slot.itemId == 0) ? 0 : std::max(0, slot.quantity);
-        if (slot.itemId != 0) {
-            state.forgeInputNames[i] = ItemNameFromId(state, slot.itemId);
-        } else {
-            state.forgeInputNames[i].clear();
-        }
     }
 
     state.forgeResultId = forge.contents.result.itemId;
     state.forgeResultQuantity = (state.forgeResultId == 0) ? 0 : std::max(0, forge.contents.result.quantity);
-    if (state.forgeResultId != 0) {
-        state.forgeResultName = ItemNameFromId(state, state.forgeResultId);
-    } else {
-        state.forgeResultName.clear();
-    }
 
     state.forgeState = forge.state;
     state.pendingForgeBreak = false;
@@ -2266,7 +2529,6 @@ void StoreForgeContents(InventoryUIState& state, ForgeInstance& forge) {
 }
 
 void LoadShopContents(InventoryUIState& state, ShopInstance& shop) {
-    EnsureShopCapacity(state, kShopSlotCount);
     ResetShopTradeState(state);
 
     if (shop.items.empty()) {
@@ -2292,30 +2554,54 @@ void StoreShopContents(const InventoryUIState& state, ShopInstance& shop) {
 
     for (int i = 0; i < kShopSlotCount; ++i) {
         ShopInventoryEntry entry{};
-        entry.itemId = (i < static_cast<int>(state.shopItemIds.size())) ? state.shopItemIds[i] : 0;
-        entry.price = (i < static_cast<int>(state.shopPrices.size())) ? state.shopPrices[i] : 0;
-        entry.stock = (i < static_cast<int>(state.shopStock.size())) ? std::max(0, state.shopStock[i]) : 0;
+        entry.itemId = (i < static_cast<int>(state.shopSlots.size())) ? state.shopSlots[i].itemId : 0;
+        entry.price = (i < static_cast<int>(state.shopSlots.size())) ? state.shopSlots[i].price : 0;
+        entry.stock = (i < static_cast<int>(state.shopSlots.size())) ? std::max(0, state.shopSlots[i].stock) : 0;
         shop.items.push_back(entry);
     }
 }
 
+void ReloadItemDefinitions(InventoryUIState& state) {
+    const GameData& data = GetGameData();
+    MarkInventoryDirty(state);
+    state.items.Clear();
+    for (const ItemRecord& record : data.items) {
+        ItemDefinition def = record.definition;
+        def.rarity = std::max(1, def.rarity);
+        def.baseValue = std::max(0, def.baseValue);
+        def.value = CalculateItemPrice(def.rarity, def.baseValue);
+        if (!record.weaponName.empty()) {
+            def.weaponBlueprint = FindWeaponBlueprint(record.weaponName);
+        }
+        // Habilidades têm lógica em código; o arquivo de dados só escolhe qual usar.
+        if (record.abilityName == "healing_potion") {
+            def.activeAbility = MakeHealingPotionAbility();
+        } else if (!record.abilityName.empty()) {
+            std::cerr << "[Inventory] Habilidade desconhecida para " << def.name << ": " << record.abilityName << std::endl;
+        }
+        state.items.Add(std::move(def));
+    }
+
+    state.forgeRecipes.Clear();
+    for (const ForgeRecipe& recipe : data.recipes) {
+        state.forgeRecipes.Add(recipe.inputA, recipe.inputB, recipe.resultId, recipe.resultQuantity);
+    }
+    state.forgeRecipes.Build(state.items);
+    state.gameDataVersion = GetGameDataVersion();
+    // Bônus e blueprints dos itens equipados podem ter mudado com as definições.
+    state.equipmentVersion = NextStatVersion();
+    state.weaponSlotVersion = NextStatVersion();
+}
+
 void InitializeInventoryUIDummyData(InventoryUIState& state) {
-    state.items.clear();
-    state.itemNameToId.clear();
-    state.weaponSlotIds.clear();
-    state.weaponSlots.clear();
-    state.equipmentSlotIds.clear();
-    state.equipmentSlots.clear();
-    state.equipmentAbilityCooldowns.clear();
-    state.inventoryItemIds.clear();
-    state.inventoryItems.clear();
-    state.inventoryQuantities.clear();
-    state.inventoryTypes.clear();
-    state.shopItemIds.clear();
-    state.shopItems.clear();
-    state.shopPrices.clear();
-    state.shopTypes.clear();
-    state.shopStock.clear();
+    MarkInventoryDirty(state);
+    state.weaponSlotIds.fill(0);
+    state.equipmentSlotIds.fill(0);
+    state.weaponSlotVersion = NextStatVersion();
+    state.equipmentVersion = NextStatVersion();
+    state.equipmentAbilityCooldowns.fill(0.0f);
+    state.inventorySlots.fill(ItemSlot{});
+    state.shopSlots.fill(ShopSlot{});
     state.sellPriceMultiplier = 0.2f; // Reset base sell rate when seeding dummy data
     state.forgeBaseCost = 0;
     state.forgeSuccessChance = 0.0f;
@@ -2330,268 +2616,21 @@ void InitializeInventoryUIDummyData(InventoryUIState& state) {
     state.shopTradeRequiredRarity = 0;
     state.shopTradeInventoryIndex = -1;
     state.shopTradeShopIndex = -1;
-    state.forgeRecipes.clear();
     state.forgeInputIds = {0, 0};
-    state.forgeInputNames = {"", ""};
     state.forgeInputQuantities = {0, 0};
     ClearForgeResult(state);
 
-    auto addItem = [&](int id,
-                       const char* name,
-                       ItemCategory category,
-                       const char* description,
-                       int rarity,
-                       int baseValue,
-                       const WeaponBlueprint* blueprint = nullptr,
-                       const PlayerAttributes& bonuses = PlayerAttributes{},
-                       const char* spritePath = nullptr,
-                       Vector2 drawSize = Vector2{0.0f, 0.0f},
-                       ItemActiveAbility ability = ItemActiveAbility{}) {
-        ItemDefinition def{};
-        def.id = id;
-        def.name = name;
-        def.category = category;
-        def.description = description;
-        def.rarity = std::max(1, rarity);
-        def.baseValue = std::max(0, baseValue);
-        def.value = CalculateItemPrice(def.rarity, def.baseValue);
-        def.weaponBlueprint = blueprint;
-        def.attributeBonuses = bonuses;
-        if (spritePath != nullptr) {
-            def.inventorySpritePath = spritePath;
-        }
-        def.inventorySpriteDrawSize = drawSize;
-        if (ability.IsValid()) {
-            def.activeAbility = std::move(ability);
-        }
-        state.items.push_back(std::move(def));
-        state.itemNameToId[name] = id;
-    };
+    if (state.items.Empty() || state.gameDataVersion != GetGameDataVersion()) {
+        ReloadItemDefinitions(state);
+    }
 
-    constexpr int kCommonBaseValue = 20;
-    auto commonValue = [&](int delta) { return kCommonBaseValue + std::max(0, delta); };
-
-    addItem(1,  "Espada Curta",        ItemCategory::Weapon,      "Lamina equilibrada para iniciantes.", 2, 80,  &GetEspadaCurtaWeaponBlueprint());
-    addItem(2,  "Machadinha",          ItemCategory::Weapon,      "Machado leve de uma mao.",        2, 70,  &GetMachadinhaWeaponBlueprint());
-    addItem(3,  "Arco Simples",        ItemCategory::Weapon,      "Arco feito de madeira tratada.",  2, 100, &GetArcoSimplesWeaponBlueprint());
-    addItem(4,  "Cajado de Carvalho",  ItemCategory::Weapon,      "Canaliza energia natural.",       3, 100, &GetCajadoDeCarvalhoWeaponBlueprint());
-    addItem(21, "Broquel",             ItemCategory::Weapon,      "Escudo curto reforcado para contra-ataques.", 3, 90, &GetBroquelWeaponBlueprint());
-    addItem(19, "Espada Runica",       ItemCategory::Weapon,      "Lamina encantada pelas runas.",    5, 320, &GetEspadaRunicaWeaponBlueprint());
-
-    constexpr int kCommonRarity = 1;
-    const int idFarrapo = 100;
-    const int idTiraCouro = 101;
-    const int idLingoteBronze = 102;
-    const int idTunica = 110;
-    const int idCalcadosSimples = 111;
-    const int idElmoBronze = 112;
-    const int idColeteCouro = 113;
-    const int idEspaldeiraBronze = 114;
-    const int idPingenteBronze = 115;
-    const int idAmuletoSorrateiro = 120;
-    const int idCouracaCaido = 121;
-    const int idPocaoCura = 150;
-    const int idkitDoTestador = 159;
-
-    ItemActiveAbility healingPotionAbility = MakeHealingPotionAbility();
-
-    addItem(idFarrapo,
-    "Farrapo",
-        ItemCategory::Material,
-        "Restos de tecidos gastos e desbotados pelo tempo. Ainda que simples, podem ser costurados novamente e servir como base para algumas vestimentas.",
-        kCommonRarity,
-        commonValue(0),
-        nullptr,
-        PlayerAttributes{},
-    "assets/img/itens/Farrapo.png",
-    Vector2{56.0f, 56.0f});
-
-    addItem(idTiraCouro,
-        "Tira de couro",
-        ItemCategory::Material,
-        "Um pedaco fino e resistente de couro curtido. Muito util na confeccao de protecoes leves ou para reforcar costuras em equipamentos simples.",
-        kCommonRarity,
-        commonValue(0),
-        nullptr,
-    PlayerAttributes{},
-    "assets/img/itens/Tira_de_couro.png",
-    Vector2{56.0f, 56.0f});
-
-    addItem(idLingoteBronze,
-        "Lingote de bronze",
-        ItemCategory::Material,
-    "Uma barra solida de bronze fundido. Sua liga equilibrada garante boa durabilidade sem exigir forja avancada - ideal para armas e armaduras simples.",
-        kCommonRarity,
-        commonValue(0),
-        nullptr,
-    PlayerAttributes{},
-    "assets/img/itens/Lingote_de_bronze.png",
-    Vector2{56.0f, 56.0f});
-
-    PlayerAttributes kitDoTestador{};
-    kitDoTestador.secondary.vampirismo = 10;
-    kitDoTestador.primary.vigor = 3;
-    kitDoTestador.primary.defesa = 5;
-    kitDoTestador.attack.foco = 5;
-    kitDoTestador.attack.forca = 5;
-    addItem(idkitDoTestador,
-        "Kit do Testador",
-        ItemCategory::Armor,
-        "Equipamento de alta qualidade, usado pra testar jogos que ainda nao estao bem balanceados.",
-        5,
-        5,
-    nullptr,
-    kitDoTestador,
-    "assets/img/itens/Kit_do_Testador.png",
-    Vector2{56.0f, 56.0f});
-
-    PlayerAttributes tunicaBonus{};
-    tunicaBonus.primary.vigor = 2;
-    addItem(idTunica,
-        "Tunica",
-        ItemCategory::Armor,
-        "Uma veste simples feita de farrapos costurados. Nao oferece protecao, mas e confortavel.",
-        kCommonRarity,
-        commonValue(10),
-    nullptr,
-    tunicaBonus,
-    "assets/img/itens/Tunica.png",
-    Vector2{56.0f, 56.0f});
-
-    PlayerAttributes calcadosBonus{};
-    calcadosBonus.primary.velocidade = 2;
-    addItem(idCalcadosSimples,
-        "Calcados simples",
-        ItemCategory::Armor,
-        "Botas rudimentares feitas de tecido e couro leve. Melhor do que andar descalco.",
-        kCommonRarity,
-        commonValue(10),
-    nullptr,
-    calcadosBonus,
-    "assets/img/itens/Calcados_simples.png",
-    Vector2{56.0f, 56.0f});
-
-    PlayerAttributes elmoBonus{};
-    elmoBonus.primary.poder = 1;
-    elmoBonus.primary.defesa = 1;
-    addItem(idElmoBronze,
-        "Elmo de bronze",
-        ItemCategory::Armor,
-        "Um elmo basico moldado em bronze. Leve e confiavel.",
-        kCommonRarity,
-        commonValue(10),
-    nullptr,
-    elmoBonus,
-    "assets/img/itens/Elmo_de_bronze.png",
-    Vector2{56.0f, 56.0f});
-
-    PlayerAttributes coleteBonus{};
-    coleteBonus.primary.defesa = 2;
-    addItem(idColeteCouro,
-        "Colete de couro",
-        ItemCategory::Armor,
-        "Uma peca robusta feita de camadas costuradas de couro. Simples, mas eficaz.",
-        kCommonRarity,
-        commonValue(10),
-    nullptr,
-    coleteBonus,
-    "assets/img/itens/Colete_de_couro.png",
-    Vector2{56.0f, 56.0f});
-
-    PlayerAttributes espaldeiraBonus{};
-    espaldeiraBonus.primary.destreza = 1;
-    espaldeiraBonus.primary.defesa = 1;
-    addItem(idEspaldeiraBronze,
-        "Espaldeira de bronze",
-        ItemCategory::Armor,
-        "Ombreiras de bronze presas por tiras de couro, garantindo mobilidade sem sacrificar protecao.",
-        kCommonRarity,
-        commonValue(10),
-    nullptr,
-    espaldeiraBonus,
-    "assets/img/itens/Espaldeira_de_bronze.png",
-    Vector2{56.0f, 56.0f});
-
-    PlayerAttributes pingenteBonus{};
-    pingenteBonus.primary.inteligencia = 1;
-    pingenteBonus.primary.poder = 1;
-    addItem(idPingenteBronze,
-        "Pingente de bronze",
-        ItemCategory::Armor,
-        "Um pequeno amuleto de bronze. Diz-se que ajuda a clarear a mente e manter o foco.",
-        kCommonRarity,
-        commonValue(10),
-    nullptr,
-    pingenteBonus,
-    "assets/img/itens/Pingente_de_bronze.png",
-    Vector2{56.0f, 56.0f});
-
-    PlayerAttributes amuletoSorrateiroBonus{};
-    amuletoSorrateiroBonus.secondary.vampirismo = 2.0f;
-    amuletoSorrateiroBonus.secondary.desvio = 10.0f;
-    addItem(idAmuletoSorrateiro,
-        "Amuleto do Sorrateiro",
-        ItemCategory::Armor,
-        "Talisma furtivo que pulsa com magia rubra, facilitando golpes furtivos e esquivas improvaveis.",
-        4,
-        120,
-        nullptr,
-        amuletoSorrateiroBonus,
-        "assets/img/itens/Amuleto_do_Sorrateiro.png",
-        Vector2{56.0f, 56.0f});
-
-    PlayerAttributes couracaCaidoBonus{};
-    couracaCaidoBonus.secondary.reducaoDano = 10.0f;
-    couracaCaidoBonus.secondary.maldicao = 2;
-    addItem(idCouracaCaido,
-        "Couraca do Caido",
-        ItemCategory::Armor,
-        "Placas negras que absorvem parte dos impactos, mas sussurram maldicoes antigas ao usuario.",
-        4,
-        140,
-        nullptr,
-        couracaCaidoBonus,
-        "assets/img/itens/Couraca_do_caido.png",
-        Vector2{56.0f, 56.0f});
-
-    addItem(idPocaoCura,
-        "Pocao de cura",
-        ItemCategory::Consumable,
-        "Elixir alquimico de emergencia que restaura uma porcao generosa da vitalidade.",
-        1,
-        20,
-        nullptr,
-        PlayerAttributes{},
-        "assets/img/itens/Pocao_de_cura.png",
-        Vector2{56.0f, 56.0f},
-        healingPotionAbility);
-
-    EnsureWeaponCapacity(state, 2);
-    SetWeaponSlot(state, 0, 1);
-    SetWeaponSlot(state, 1, 3);
-    SetEquipmentSlot(state, 0, idkitDoTestador);
-
-    EnsureEquipmentCapacity(state, 5);
-
-    state.inventoryItemIds.resize(24, 0);
-    state.inventoryItems.resize(24);
-    state.inventoryQuantities.resize(24, 0);
-    state.inventoryTypes.resize(24, ItemCategory::None);
-
-    state.shopItemIds.clear();
-    state.shopItems.clear();
-    state.shopPrices.clear();
-    state.shopTypes.clear();
+    SetWeaponSlot(state, 0, kStarterLeftWeaponId);
+    SetWeaponSlot(state, 1, kStarterRightWeaponId);
+    SetEquipmentSlot(state, 0, kStarterEquipmentId);
 
     state.shopRollsLeft = 1;
     RollShopInventoryInternal(state);
 
-    state.forgeRecipes[MakeForgeKey(idFarrapo, idFarrapo)] = idTunica;
-    state.forgeRecipes[MakeForgeKey(idFarrapo, idTiraCouro)] = idCalcadosSimples;
-    state.forgeRecipes[MakeForgeKey(idFarrapo, idLingoteBronze)] = idElmoBronze;
-    state.forgeRecipes[MakeForgeKey(idTiraCouro, idTiraCouro)] = idColeteCouro;
-    state.forgeRecipes[MakeForgeKey(idTiraCouro, idLingoteBronze)] = idEspaldeiraBronze;
-
     state.coins = 0;
     RefreshForgeChance(state);
 
@@ -2602,10 +2641,7 @@ void InitializeInventoryUIDummyData(InventoryUIState& state) {
     state.chestSupportsTakeAll = false;
     state.selectedChestIndex = -1;
     state.chestTitle.clear();
-    state.chestItemIds.clear();
-    state.chestItems.clear();
-    state.chestQuantities.clear();
-    state.chestTypes.clear();
+    state.chestSlotCount = 0;
 }
 
 void RenderInventoryUI(InventoryUIState& state,
@@ -2614,16 +2650,15 @@ void RenderInventoryUI(InventoryUIState& state,
                        const WeaponState& rightWeapon,
                        Vector2 screenSize,
                        ShopInstance* activeShop) {
+    RenderStatsScope statsScope(RenderSubsystem::Inventory);
+    AllocScope allocScope(AllocTag::Inventory);
+    TrimTextLayoutCache();
     const int prevTextColor = GuiGetStyle(DEFAULT, TEXT_COLOR_NORMAL);
     const int prevFocusColor = GuiGetStyle(DEFAULT, TEXT_COLOR_FOCUSED);
     const int prevPressedColor = GuiGetStyle(DEFAULT, TEXT_COLOR_PRESSED);
     GuiSetStyle(DEFAULT, TEXT_COLOR_NORMAL, 0x3A445CFF);
     GuiSetStyle(DEFAULT, TEXT_COLOR_FOCUSED, 0x243149FF);
     GuiSetStyle(DEFAULT, TEXT_COLOR_PRESSED, 0x1B2538FF);
-    EnsureInventoryMeta(state);
-    EnsureWeaponCapacity(state, std::max<size_t>(2, state.weaponSlotIds.size()));
-    EnsureEquipmentCapacity(state, std::max<size_t>(5, state.equipmentSlotIds.size()));
-    EnsureShopCapacity(state, state.shopItemIds.size());
     if (state.mode != InventoryViewMode::Shop && state.shopTradeActive) {
         ResetShopTradeState(state);
     }
@@ -2646,16 +2681,17 @@ void RenderInventoryUI(InventoryUIState& state,
             state.feedbackMessage.clear();
         }
     }
-    const float windowWidth = std::min(1720.0f, screenSize.x - 40.0f); // Limite e largura total da janela
-    const float windowHeight = std::min(860.0f, screenSize.y - 140.0f); // Limite e altura total da janela
-    Rectangle windowRect{
-        screenSize.x * 0.5f - windowWidth * 0.5f,
-        screenSize.y * 0.5f - windowHeight * 0.5f,
-        windowWidth,
-        windowHeight
-    };
 
-    GuiPanel(windowRect, nullptr);
+    const InventoryPanelLayout layout = ComputeInventoryPanelLayout(screenSize);
+    const Rectangle& windowRect = layout.window;
+    const Rectangle& contentRect = layout.content;
+    const Rectangle& coinsLabel = layout.coinsLabel;
+    const Rectangle& detailRect = layout.detail;
+    const float slotSize = kInventorySlotSize;
+    const float slotSpacing = kInventorySlotSpacing;
+
+    // Molduras, atributos e itens dos slots vêm da render texture; o que depende de hover/seleção vem por cima.
+    DrawInventoryStaticLayer(state, player, layout);
 
     // Top buttons
         Rectangle menuButton{
@@ -2677,75 +2713,12 @@ void RenderInventoryUI(InventoryUIState& state,
         return;
     }
 
-    const float padding = 22.0f; // Margem interna entre bordas da janela e blocos
-    Rectangle attributesRect{windowRect.x + padding, windowRect.y + padding, 360.0f, windowRect.height - padding * 2.0f}; // Largura e altura da coluna de atributos
-    GuiGroupBox(attributesRect, "Personagem");
-
-    Vector2 attrPos{attributesRect.x + 20.0f, attributesRect.y + 36.0f};
-    constexpr float kLineSpacing = 22.0f;
-    constexpr float kGroupSpacing = 28.0f;
-    auto drawIntStat = [&](const char* label, int value, float spacing) {
-        DrawAttributeLabel(attrPos, label, value);
-        attrPos.y += spacing;
-    };
-    auto drawFloatStat = [&](const char* label, float value, int decimals, float spacing) {
-        DrawAttributeLabel(attrPos, label, value, decimals);
-        attrPos.y += spacing;
-    };
-
-    drawIntStat("Vida", static_cast<int>(std::round(player.currentHealth)), 26.0f);
-    drawIntStat("Vida Max", static_cast<int>(std::round(player.derivedStats.maxHealth)), kGroupSpacing);
-
-    drawIntStat("Poder", player.totalAttributes.primary.poder, kLineSpacing);
-    drawIntStat("Defesa", player.totalAttributes.primary.defesa, kLineSpacing);
-    drawIntStat("Vigor", player.totalAttributes.primary.vigor, kLineSpacing);
-    drawIntStat("Velocidade", player.totalAttributes.primary.velocidade, kLineSpacing);
-    drawIntStat("Destreza", player.totalAttributes.primary.destreza, kLineSpacing);
-    drawIntStat("Inteligencia", player.totalAttributes.primary.inteligencia, kGroupSpacing);
-
-    drawIntStat("Constituicao", player.totalAttributes.attack.constituicao, kLineSpacing);
-    drawIntStat("Forca", player.totalAttributes.attack.forca, kLineSpacing);
-    drawIntStat("Foco", player.totalAttributes.attack.foco, kLineSpacing);
-    drawIntStat("Misticismo", player.totalAttributes.attack.misticismo, kLineSpacing);
-    drawIntStat("Conhecimento", player.totalAttributes.attack.conhecimento, kGroupSpacing);
-
-    drawFloatStat("Vampirismo", player.totalAttributes.secondary.vampirismo, 2, kLineSpacing);
-    drawFloatStat("Letalidade", player.totalAttributes.secondary.letalidade, 2, kLineSpacing);
-    drawFloatStat("Reducao de Dano", player.totalAttributes.secondary.reducaoDano, 2, kLineSpacing);
-    drawFloatStat("Desvio", player.totalAttributes.secondary.desvio, 2, kLineSpacing);
-    drawFloatStat("Sorte", player.totalAttributes.secondary.sorte, 2, kLineSpacing);
-    drawIntStat("Maldicao", player.totalAttributes.secondary.maldicao, kLineSpacing);
-
-    Rectangle contentRect{
-        attributesRect.x + attributesRect.width + padding,
-        windowRect.y + padding,
-        windowRect.width - attributesRect.width - padding * 3.0f,
-        windowRect.height - padding * 2.0f
-    };
-    GuiPanel(contentRect, nullptr);
-    Color panelLabelBg = GetColor(GuiGetStyle(DEFAULT, BACKGROUND_COLOR));
-    Rectangle panelLabelRect{contentRect.x + 18.0f, contentRect.y - 14.0f, 132.0f, 24.0f};
-    DrawRectangleRec(panelLabelRect, panelLabelBg);
-    DrawTextEx(GetGameFont(), "Inventario", Vector2{panelLabelRect.x + 6.0f, panelLabelRect.y + 4.0f}, 20.0f, kBodyTextSpacing, Color{58, 68, 96, 255});
-
-    Rectangle weaponsLabelRect{contentRect.x + 10.0f, contentRect.y + 32.0f, 140.0f, 22.0f}; // Reposiciona o titulo "Armas"
-    GuiLabel(weaponsLabelRect, "Armas");
-
-    const float slotSize = 64.0f;   // Define a largura/altura dos slots
-    const float slotSpacing = 12.0f; // Define o espaco entre os slots
-
     // Weapons slots (2)
-    for (int i = 0; i < 2; ++i) {
-        Rectangle slotRect{
-            contentRect.x + 10.0f + (slotSize + slotSpacing) * i,
-            contentRect.y + 48.0f,
-            slotSize,
-            slotSize
-        };
-        bool selected = (state.selectedWeaponIndex == i);
-        std::string label = (i < static_cast<int>(state.weaponSlots.size())) ? state.weaponSlots[i] : "";
-        int weaponId = (i < static_cast<int>(state.weaponSlotIds.size())) ? state.weaponSlotIds[i] : 0;
-        DrawSlot(state, slotRect, label, selected, weaponId);
+    for (int i = 0; i < static_cast<int>(layout.weaponSlots.size()); ++i) {
+        const Rectangle& slotRect = layout.weaponSlots[i];
+        if (state.selectedWeaponIndex == i) {
+            DrawSlotSelection(slotRect);
+        }
         if (SlotClicked(slotRect)) {
             if (state.shopTradeActive) {
                 state.feedbackMessage = "Nao e possivel trocar itens equipados.";
@@ -2762,20 +2735,11 @@ void RenderInventoryUI(InventoryUIState& state,
     }
 
     // Equipment slots row (5)
-    Rectangle equipLabelRect{contentRect.x + 10.0f, weaponsLabelRect.y + 28.0f + slotSize, 160.0f, 22.0f}; // Move o titulo "Equipamento"
-    GuiLabel(equipLabelRect, "Equipamento");
-
-    for (int i = 0; i < 5; ++i) {
-        Rectangle slotRect{
-            contentRect.x + 10.0f + (slotSize + slotSpacing) * i,
-            equipLabelRect.y + 22.0f,
-            slotSize,
-            slotSize
-        };
-        bool selected = (state.selectedEquipmentIndex == i);
-        std::string label = (i < static_cast<int>(state.equipmentSlots.size())) ? state.equipmentSlots[i] : "";
-        int equipmentId = (i < static_cast<int>(state.equipmentSlotIds.size())) ? state.equipmentSlotIds[i] : 0;
-        DrawSlot(state, slotRect, label, selected, equipmentId);
+    for (int i = 0; i < static_cast<int>(layout.equipmentSlots.size()); ++i) {
+        const Rectangle& slotRect = layout.equipmentSlots[i];
+        if (state.selectedEquipmentIndex == i) {
+            DrawSlotSelection(slotRect);
+        }
         if (SlotClicked(slotRect)) {
             if (state.shopTradeActive) {
                 state.feedbackMessage = "Nao e possivel trocar itens equipados.";
@@ -2791,64 +2755,27 @@ void RenderInventoryUI(InventoryUIState& state,
         }
     }
 
-    Rectangle inventoryLabelRect{contentRect.x + 10.0f, equipLabelRect.y + 30.0f + slotSize, 160.0f, 22.0f}; // Move o titulo "Inventario"
-    GuiLabel(inventoryLabelRect, "Inventario");
-
-    const int inventoryColumns = 8; // Numero de colunas na grade
-    const int inventoryRows = 3;    // Numero de linhas na grade
-    for (int row = 0; row < inventoryRows; ++row) {
-        for (int col = 0; col < inventoryColumns; ++col) {
-            int index = row * inventoryColumns + col;
-            Rectangle slotRect{
-                contentRect.x + 10.0f + (slotSize + slotSpacing) * col,
-                inventoryLabelRect.y + 20.0f + (slotSize + slotSpacing) * row,
-                slotSize,
-                slotSize
-            };
-            bool selected = (state.selectedInventoryIndex == index);
-            std::string label = (index < static_cast<int>(state.inventoryItems.size())) ? state.inventoryItems[index] : "";
-            ItemCategory slotType = (index < static_cast<int>(state.inventoryTypes.size())) ? state.inventoryTypes[index] : ItemCategory::None;
-            bool showQuantity = (slotType == ItemCategory::Consumable || slotType == ItemCategory::Material);
-            int quantity = -1;
-            if (showQuantity && index < static_cast<int>(state.inventoryQuantities.size())) {
-                quantity = state.inventoryQuantities[index];
-            }
-            if (label.empty()) {
-                quantity = -1;
+    // Inventory grid
+    for (int index = 0; index < static_cast<int>(layout.inventorySlots.size()); ++index) {
+        const Rectangle& slotRect = layout.inventorySlots[index];
+        if (state.selectedInventoryIndex == index) {
+            DrawSlotSelection(slotRect);
+        }
+        if (SlotClicked(slotRect)) {
+            state.selectedInventoryIndex = index;
+            state.selectedWeaponIndex = -1;
+            state.selectedEquipmentIndex = -1;
+            if (!state.shopTradeActive) {
+                state.selectedShopIndex = -1;
             }
-            int itemId = (index < static_cast<int>(state.inventoryItemIds.size())) ? state.inventoryItemIds[index] : 0;
-            DrawSlot(state, slotRect, label, selected, itemId, quantity, showQuantity);
-            if (SlotClicked(slotRect)) {
-                state.selectedInventoryIndex = index;
-                state.selectedWeaponIndex = -1;
-                state.selectedEquipmentIndex = -1;
-                if (!state.shopTradeActive) {
-                    state.selectedShopIndex = -1;
-                }
-                state.selectedForgeSlot = -1;
-                state.selectedChestIndex = -1;
-                if (state.shopTradeActive) {
-                    HandleShopTradeInventoryCandidate(state, index);
-                }
+            state.selectedForgeSlot = -1;
+            state.selectedChestIndex = -1;
+            if (state.shopTradeActive) {
+                HandleShopTradeInventoryCandidate(state, index);
             }
         }
     }
 
-    Rectangle coinsLabel{contentRect.x + 10.0f, inventoryLabelRect.y + 20.0f + (slotSize + slotSpacing) * inventoryRows + 12.0f, 180.0f, 24.0f};
-    GuiLabel(coinsLabel, TextFormat("Moedas: %d", state.coins));
-
-    // Detail panel on the right
-    const float detailPanelWidth = contentRect.width * 0.48f; // Largura dedicada ao painel de detalhes (percentual do conteudo)
-    const float detailPanelMargin = 8.0f;    // Espaco entre o painel de detalhes e o restante do conteudo
-    Rectangle detailRect{
-        contentRect.x + contentRect.width - detailPanelWidth - detailPanelMargin,
-        contentRect.y + 32.0f,
-        detailPanelWidth,
-        contentRect.height - 44.0f
-    };
-    // Ajuste a posicao/largura/altura acima para remodelar o painel de detalhes à direita
-    GuiGroupBox(detailRect, "Detalhes");
-
     const float detailHeaderOffset = 28.0f;
     Rectangle detailContent{detailRect.x + 12.0f, detailRect.y + detailHeaderOffset, detailRect.width - 24.0f, detailRect.height - detailHeaderOffset - 42.0f};
 
@@ -2868,7 +2795,7 @@ void RenderInventoryUI(InventoryUIState& state,
         effectiveShopIndex = state.shopTradeShopIndex;
     }
 
-    if (!tradeLocksDetail && state.selectedWeaponIndex >= 0 && state.selectedWeaponIndex < static_cast<int>(state.weaponSlots.size())) {
+    if (!tradeLocksDetail && state.selectedWeaponIndex >= 0 && state.selectedWeaponIndex < static_cast<int>(state.weaponSlotIds.size())) {
         const WeaponState& selectedWeapon = (state.selectedWeaponIndex == 0) ? leftWeapon : rightWeapon;
         detailWeaponBlueprint = selectedWeapon.blueprint;
         detailWeaponStatePtr = (selectedWeapon.blueprint != nullptr) ? &selectedWeapon : nullptr;
@@ -2882,7 +2809,7 @@ void RenderInventoryUI(InventoryUIState& state,
         if (!useItemLayout) {
             fallbackDetailText = "Arma: Slot vazio";
         }
-    } else if (!tradeLocksDetail && state.selectedEquipmentIndex >= 0 && state.selectedEquipmentIndex < static_cast<int>(state.equipmentSlots.size())) {
+    } else if (!tradeLocksDetail && state.selectedEquipmentIndex >= 0 && state.selectedEquipmentIndex < static_cast<int>(state.equipmentSlotIds.size())) {
         if (state.selectedEquipmentIndex < static_cast<int>(state.equipmentSlotIds.size())) {
             detailItemId = state.equipmentSlotIds[state.selectedEquipmentIndex];
             detailItemDef = FindItemDefinition(state, detailItemId);
@@ -2893,27 +2820,27 @@ void RenderInventoryUI(InventoryUIState& state,
         if (!useItemLayout) {
             fallbackDetailText = "Equipamento: Slot vazio";
         }
-    } else if (!tradeLocksDetail && state.selectedInventoryIndex >= 0 && state.selectedInventoryIndex < static_cast<int>(state.inventoryItems.size())) {
-        if (state.selectedInventoryIndex < static_cast<int>(state.inventoryItemIds.size())) {
-            detailItemId = state.inventoryItemIds[state.selectedInventoryIndex];
+    } else if (!tradeLocksDetail && state.selectedInventoryIndex >= 0 && state.selectedInventoryIndex < static_cast<int>(state.inventorySlots.size())) {
+        if (state.selectedInventoryIndex < static_cast<int>(state.inventorySlots.size())) {
+            detailItemId = state.inventorySlots[state.selectedInventoryIndex].itemId;
             detailItemDef = FindItemDefinition(state, detailItemId);
             if (detailItemDef != nullptr) {
                 detailWeaponBlueprint = detailItemDef->weaponBlueprint;
             }
         }
         detailIsPlayerOwned = true;
-        if (state.selectedInventoryIndex < static_cast<int>(state.inventoryQuantities.size())) {
-            detailQuantity = std::max(1, state.inventoryQuantities[state.selectedInventoryIndex]);
+        if (state.selectedInventoryIndex < static_cast<int>(state.inventorySlots.size())) {
+            detailQuantity = std::max(1, state.inventorySlots[state.selectedInventoryIndex].quantity);
         }
         useItemLayout = (detailItemDef != nullptr) || (detailWeaponBlueprint != nullptr);
         if (!useItemLayout) {
             fallbackDetailText = (detailItemId == 0) ? "Item: Slot vazio" : "Item: Dados indisponiveis";
         }
-    } else if (effectiveShopIndex >= 0 && effectiveShopIndex < static_cast<int>(state.shopItems.size())) {
+    } else if (effectiveShopIndex >= 0 && effectiveShopIndex < static_cast<int>(state.shopSlots.size())) {
         detailIsShopItem = true;
         detailQuantity = 1;
-        if (effectiveShopIndex < static_cast<int>(state.shopItemIds.size())) {
-            detailItemId = state.shopItemIds[effectiveShopIndex];
+        if (effectiveShopIndex < static_cast<int>(state.shopSlots.size())) {
+            detailItemId = state.shopSlots[effectiveShopIndex].itemId;
             detailItemDef = FindItemDefinition(state, detailItemId);
             if (detailItemDef != nullptr) {
                 detailWeaponBlueprint = detailItemDef->weaponBlueprint;
@@ -2925,28 +2852,28 @@ void RenderInventoryUI(InventoryUIState& state,
         useItemLayout = (detailItemDef != nullptr) || (detailWeaponBlueprint != nullptr);
         if (!useItemLayout) {
             fallbackDetailText = TextFormat("Loja: %s\nPreco: %d",
-                                            state.shopItems[effectiveShopIndex].c_str(),
-                                            state.shopPrices[effectiveShopIndex]);
+                                            ItemNameFromId(state, state.shopSlots[effectiveShopIndex].itemId).c_str(),
+                                            state.shopSlots[effectiveShopIndex].price);
         } else {
             fallbackDetailText.clear();
         }
     } else if (state.mode == InventoryViewMode::Chest &&
                state.selectedChestIndex >= 0 &&
-               state.selectedChestIndex < static_cast<int>(state.chestItemIds.size())) {
-        if (state.selectedChestIndex < static_cast<int>(state.chestItemIds.size())) {
-            detailItemId = state.chestItemIds[state.selectedChestIndex];
+               state.selectedChestIndex < state.chestSlotCount) {
+        if (state.selectedChestIndex < state.chestSlotCount) {
+            detailItemId = state.chestSlots[state.selectedChestIndex].itemId;
             detailItemDef = FindItemDefinition(state, detailItemId);
             if (detailItemDef != nullptr) {
                 detailWeaponBlueprint = detailItemDef->weaponBlueprint;
             }
         }
-        detailQuantity = (state.selectedChestIndex < static_cast<int>(state.chestQuantities.size()))
-                             ? std::max(1, state.chestQuantities[state.selectedChestIndex])
+        detailQuantity = (state.selectedChestIndex < state.chestSlotCount)
+                             ? std::max(1, state.chestSlots[state.selectedChestIndex].quantity)
                              : 1;
         useItemLayout = (detailItemDef != nullptr) || (detailWeaponBlueprint != nullptr);
         if (!useItemLayout) {
-            std::string entryName = (state.selectedChestIndex < static_cast<int>(state.chestItems.size()))
-                                        ? state.chestItems[state.selectedChestIndex]
+            std::string entryName = (state.selectedChestIndex < state.chestSlotCount)
+                                        ? ItemNameFromId(state, state.chestSlots[state.selectedChestIndex].itemId)
                                         : std::string();
             if (entryName.empty()) {
                 fallbackDetailText = "Bau: Slot vazio";
@@ -2957,23 +2884,22 @@ void RenderInventoryUI(InventoryUIState& state,
     } else if (!tradeLocksDetail && (state.selectedForgeSlot == 0 || state.selectedForgeSlot == 1)) {
         int slot = state.selectedForgeSlot;
         if (slot >= 0 && slot < 2 && state.forgeInputIds[slot] != 0) {
-            std::string name = state.forgeInputNames[slot];
-            if (name.empty()) {
-                name = ItemNameFromId(state, state.forgeInputIds[slot]);
-            }
-            fallbackDetailText = "Bigorna: " + name + "\nStatus: Pronto para forjar";
+            fallbackDetailText = "Bigorna: " + ItemNameFromId(state, state.forgeInputIds[slot]) + "\nStatus: Pronto para forjar";
             detailItemId = state.forgeInputIds[slot];
             detailQuantity = std::max(1, state.forgeInputQuantities[slot]);
         }
         detailIsPlayerOwned = true;
     } else if (!tradeLocksDetail && state.selectedForgeSlot == 2 && state.forgeResultId != 0) {
-        std::string name = state.forgeResultName.empty() ? ItemNameFromId(state, state.forgeResultId) : state.forgeResultName;
-        fallbackDetailText = "Resultado: " + name + "\nStatus: Aguarda coleta";
+        fallbackDetailText = "Resultado: " + ItemNameFromId(state, state.forgeResultId) + "\nStatus: Aguarda coleta";
         detailItemId = state.forgeResultId;
         detailQuantity = std::max(1, state.forgeResultQuantity);
         detailIsPlayerOwned = true;
     }
 
+    if (state.mode == InventoryViewMode::Forge && !useItemLayout && detailItemId == 0 && state.selectedForgeSlot < 0) {
+        fallbackDetailText = BuildCraftableText(state);
+    }
+
     if (useItemLayout) {
         int detailKey = detailItemId;
         if (detailKey == 0 && detailWeaponBlueprint != nullptr) {
@@ -3014,8 +2940,8 @@ void RenderInventoryUI(InventoryUIState& state,
     int displayValue = 0;
     bool showValue = false;
     if (detailIsShopItem) {
-        if (effectiveShopIndex >= 0 && effectiveShopIndex < static_cast<int>(state.shopPrices.size())) {
-            displayValue = state.shopPrices[effectiveShopIndex];
+        if (effectiveShopIndex >= 0 && effectiveShopIndex < static_cast<int>(state.shopSlots.size())) {
+            displayValue = state.shopSlots[effectiveShopIndex].price;
             showValue = displayValue > 0;
         } else if (detailItemId > 0) {
             displayValue = GetItemValue(state, detailItemId);
@@ -3032,9 +2958,9 @@ void RenderInventoryUI(InventoryUIState& state,
     if (showValue) {
         std::string priceLine = TextFormat("Valor: %d", displayValue);
         const float priceFont = 20.0f;
-        Vector2 textSize = MeasureTextEx(GetGameFont(), priceLine.c_str(), priceFont, kBodyTextSpacing);
+        Vector2 textSize = MeasureTextEx(GetGameFont(priceFont), priceLine.c_str(), priceFont, kBodyTextSpacing);
         float priceX = detailRect.x + detailRect.width * 0.5f - textSize.x * 0.5f;
-        DrawTextEx(GetGameFont(), priceLine.c_str(), Vector2{priceX, priceY}, priceFont, kBodyTextSpacing, Color{58, 68, 96, 255});
+        Counted::DrawTextEx(GetGameFont(priceFont), priceLine.c_str(), Vector2{priceX, priceY}, priceFont, kBodyTextSpacing, Color{58, 68, 96, 255});
     }
 
     float bottomAreaTop = coinsLabel.y + 36.0f; // Ponto inicial vertical da area inferior (forge/loja)
@@ -3060,26 +2986,26 @@ void RenderInventoryUI(InventoryUIState& state,
 
         DrawSlot(state,
                  inputSlotA,
-                 state.forgeInputIds[0] == 0 ? "Slot 1" : (state.forgeInputNames[0].empty() ? ItemNameFromId(state, state.forgeInputIds[0]) : state.forgeInputNames[0]),
+                 state.forgeInputIds[0] == 0 ? kForgeSlotLabels[0] : ItemNameFromId(state, state.forgeInputIds[0]),
                  state.selectedForgeSlot == 0,
                  state.forgeInputIds[0],
                  -1,
                  false);
         DrawSlot(state,
                  inputSlotB,
-                 state.forgeInputIds[1] == 0 ? "Slot 2" : (state.forgeInputNames[1].empty() ? ItemNameFromId(state, state.forgeInputIds[1]) : state.forgeInputNames[1]),
+                 state.forgeInputIds[1] == 0 ? kForgeSlotLabels[1] : ItemNameFromId(state, state.forgeInputIds[1]),
                  state.selectedForgeSlot == 1,
                  state.forgeInputIds[1],
                  -1,
                  false);
 
-    DrawRectangleLinesEx(arrowRect, 2.0f, Color{200, 200, 220, 255});
-    DrawTextEx(GetGameFont(), "=>", Vector2{arrowRect.x + 8.0f, arrowRect.y + 8.0f}, 28.0f, 0.0f, Color{230, 230, 240, 255});
+    Counted::DrawRectangleLinesEx(arrowRect, 2.0f, Color{200, 200, 220, 255});
+    Counted::DrawTextEx(GetGameFont(28.0f), "=>", Vector2{arrowRect.x + 8.0f, arrowRect.y + 8.0f}, 28.0f, 0.0f, Color{230, 230, 240, 255});
 
         bool showResultQuantity = state.forgeResultQuantity > 1;
         DrawSlot(state,
                  resultSlot,
-                 state.forgeResultId == 0 ? "Resultado" : (state.forgeResultName.empty() ? ItemNameFromId(state, state.forgeResultId) : state.forgeResultName),
+                 state.forgeResultId == 0 ? kForgeSlotLabels[2] : ItemNameFromId(state, state.forgeResultId),
                  state.selectedForgeSlot == 2,
                  state.forgeResultId,
                  showResultQuantity ? state.forgeResultQuantity : -1,
@@ -3111,12 +3037,12 @@ void RenderInventoryUI(InventoryUIState& state,
         if (chanceWidth > 60.0f) {
             Rectangle chanceRect{resultSlot.x + slotSize + 60.0f, slotRowY + slotSize * 0.5f - 16.0f, chanceWidth, 32.0f}; // Controla a posicao/tamanho da barra de chance
             if (state.forgeState == ForgeState::Broken) {
-                DrawRectangleRec(chanceRect, Color{160, 32, 32, 230});
-                DrawRectangleLinesEx(chanceRect, 2.0f, Color{90, 16, 16, 255});
-                DrawTextEx(GetGameFont(), "Falha", Vector2{chanceRect.x + 16.0f, chanceRect.y + 6.0f}, 24.0f, 0.0f, Color{255, 255, 255, 255});
+                Counted::DrawRectangleRec(chanceRect, Color{160, 32, 32, 230});
+                Counted::DrawRectangleLinesEx(chanceRect, 2.0f, Color{90, 16, 16, 255});
+                Counted::DrawTextEx(GetGameFont(24.0f), "Falha", Vector2{chanceRect.x + 16.0f, chanceRect.y + 6.0f}, 24.0f, 0.0f, Color{255, 255, 255, 255});
             } else {
                 GuiProgressBar(chanceRect, nullptr, nullptr, &state.forgeSuccessChance, 0.0f, 1.0f);
-                DrawTextEx(GetGameFont(), TextFormat("%d%%", static_cast<int>(state.forgeSuccessChance * 100.0f)),
+                Counted::DrawTextEx(GetGameFont(24.0f), TextFormat("%d%%", static_cast<int>(state.forgeSuccessChance * 100.0f)),
                            Vector2{chanceRect.x + chanceRect.width * 0.5f - 18.0f, chanceRect.y + 6.0f}, 24.0f, 0.0f, Color{40, 48, 68, 255});
             }
         }
@@ -3187,7 +3113,7 @@ void RenderInventoryUI(InventoryUIState& state,
         columns = std::max(1, std::min(columns, 5));
 
     const float slotVerticalStep = slotSize + slotSpacing + 44.0f; // Distancia entre linhas da lista da loja
-        for (int i = 0; i < static_cast<int>(state.shopItems.size()); ++i) {
+        for (int i = 0; i < static_cast<int>(state.shopSlots.size()); ++i) {
             int col = columns > 0 ? i % columns : 0;
             int row = columns > 0 ? i / columns : 0;
             float slotX = startX + col * (slotSize + slotSpacing); // Ajuste fino por slot (X)
@@ -3197,14 +3123,14 @@ void RenderInventoryUI(InventoryUIState& state,
             }
             Rectangle slotRect{slotX, slotY, slotSize, slotSize};
             bool selected = (state.selectedShopIndex == i);
-            int stock = (i < static_cast<int>(state.shopStock.size())) ? state.shopStock[i] : 0;
-            int shopItemId = (i < static_cast<int>(state.shopItemIds.size())) ? state.shopItemIds[i] : 0;
-            ItemCategory shopType = (i < static_cast<int>(state.shopTypes.size())) ? state.shopTypes[i] : ItemCategory::None;
+            int stock = state.shopSlots[i].stock;
+            int shopItemId = state.shopSlots[i].itemId;
+            ItemCategory shopType = ItemCategoryFromId(state, shopItemId);
             bool showQuantity = (shopType == ItemCategory::Consumable || shopType == ItemCategory::Material);
-            DrawSlot(state, slotRect, state.shopItems[i], selected, shopItemId, std::max(0, stock), showQuantity);
+            DrawSlot(state, slotRect, ItemNameFromId(state, shopItemId), selected, shopItemId, std::max(0, stock), showQuantity);
             if (stock <= 0) {
-                DrawRectangleRec(slotRect, Color{0, 0, 0, 140});
-                DrawRectangleLinesEx(slotRect, 2.0f, ResolveBorderColor(state, shopItemId));
+                Counted::DrawRectangleRec(slotRect, Color{0, 0, 0, 140});
+                Counted::DrawRectangleLinesEx(slotRect, 2.0f, ResolveBorderColor(state, shopItemId));
             }
             if (SlotClicked(slotRect)) {
                 bool tradeLocked = state.shopTradeActive && state.shopTradeShopIndex >= 0;
@@ -3224,10 +3150,10 @@ void RenderInventoryUI(InventoryUIState& state,
                 }
             }
             Rectangle priceRect{slotRect.x, slotRect.y + slotSize + 6.0f, slotSize, 20.0f};
-            GuiLabel(priceRect, TextFormat("%d", state.shopPrices[i]));
+            GuiLabel(priceRect, TextFormat("%d", state.shopSlots[i].price));
         }
 
-        int totalRows = columns > 0 ? (static_cast<int>(state.shopItems.size()) + columns - 1) / columns : 0;
+        int totalRows = columns > 0 ? (static_cast<int>(state.shopSlots.size()) + columns - 1) / columns : 0;
         float rerollButtonWidth = 180.0f;  // Ajuste aqui para alterar a largura do botao re-roll
         float rerollButtonHeight = 38.0f;  // Ajuste aqui para alterar a altura do botao re-roll
         float rerollButtonX = bottomArea.x + bottomArea.width * 0.5f - rerollButtonWidth * 0.5f; // Ajuste aqui para mover o botao re-roll no eixo X
@@ -3270,7 +3196,7 @@ void RenderInventoryUI(InventoryUIState& state,
                          ? personalChestOffset
                          : commonChestOffset);
         float startY = bottomArea.y + 44.0f;
-        int capacity = static_cast<int>(state.chestItems.size());
+        int capacity = state.chestSlotCount;
         int columns = (state.chestUiType == InventoryUIState::ChestUIType::Player) ? 6 : std::max(1, std::min(4, capacity));
         columns = std::max(1, columns);
         const float slotVerticalStep = slotSize + slotSpacing + 16.0f;
@@ -3286,12 +3212,11 @@ void RenderInventoryUI(InventoryUIState& state,
 
             Rectangle slotRect{slotX, slotY, slotSize, slotSize};
             bool selected = (state.selectedChestIndex == i);
-            int itemId = (i < static_cast<int>(state.chestItemIds.size())) ? state.chestItemIds[i] : 0;
-            ItemCategory itemType = (i < static_cast<int>(state.chestTypes.size())) ? state.chestTypes[i] : ItemCategory::None;
+            int itemId = state.chestSlots[i].itemId;
+            ItemCategory itemType = ItemCategoryFromId(state, itemId);
             bool showQuantity = IsStackableCategory(itemType);
-            int quantity = (i < static_cast<int>(state.chestQuantities.size()) && showQuantity) ? state.chestQuantities[i] : -1;
-            std::string label = (i < static_cast<int>(state.chestItems.size())) ? state.chestItems[i] : std::string();
-            DrawSlot(state, slotRect, label, selected, itemId, quantity, showQuantity);
+            int quantity = showQuantity ? state.chestSlots[i].quantity : -1;
+            DrawSlot(state, slotRect, ItemNameFromId(state, itemId), selected, itemId, quantity, showQuantity);
             if (SlotClicked(slotRect)) {
                 if (itemId == 0) {
                     state.selectedChestIndex = -1;
@@ -3313,7 +3238,7 @@ void RenderInventoryUI(InventoryUIState& state,
                 180.0f,
                 32.0f
             };
-            bool hasItems = std::any_of(state.chestItemIds.begin(), state.chestItemIds.end(), [](int id) { return id != 0; });
+            bool hasItems = std::any_of(state.chestSlots.begin(), state.chestSlots.begin() + state.chestSlotCount, [](const ItemSlot& slot) { return slot.itemId != 0; });
             if (!hasItems) {
                 GuiDisable();
             }
@@ -3345,17 +3270,17 @@ void RenderInventoryUI(InventoryUIState& state,
         selection = SelectionKind::ForgeInput1;
     } else if (state.mode == InventoryViewMode::Forge && state.selectedForgeSlot == 2 && state.forgeResultId != 0) {
         selection = SelectionKind::ForgeResult;
-    } else if (state.mode == InventoryViewMode::Shop && state.selectedShopIndex >= 0 && state.selectedShopIndex < static_cast<int>(state.shopItems.size())) {
+    } else if (state.mode == InventoryViewMode::Shop && state.selectedShopIndex >= 0 && state.selectedShopIndex < static_cast<int>(state.shopSlots.size())) {
         selection = SelectionKind::ShopItem;
     } else if (state.mode == InventoryViewMode::Chest && state.selectedChestIndex >= 0 &&
-               state.selectedChestIndex < static_cast<int>(state.chestItems.size()) &&
-               !state.chestItems[state.selectedChestIndex].empty()) {
+               state.selectedChestIndex < state.chestSlotCount &&
+               state.chestSlots[state.selectedChestIndex].itemId > 0) {
         selection = SelectionKind::ChestItem;
-    } else if (state.selectedWeaponIndex >= 0 && state.selectedWeaponIndex < static_cast<int>(state.weaponSlots.size()) && !state.weaponSlots[state.selectedWeaponIndex].empty()) {
+    } else if (state.selectedWeaponIndex >= 0 && state.selectedWeaponIndex < static_cast<int>(state.weaponSlotIds.size()) && state.weaponSlotIds[state.selectedWeaponIndex] > 0) {
         selection = SelectionKind::Weapon;
-    } else if (state.selectedEquipmentIndex >= 0 && state.selectedEquipmentIndex < static_cast<int>(state.equipmentSlots.size()) && !state.equipmentSlots[state.selectedEquipmentIndex].empty()) {
+    } else if (state.selectedEquipmentIndex >= 0 && state.selectedEquipmentIndex < static_cast<int>(state.equipmentSlotIds.size()) && state.equipmentSlotIds[state.selectedEquipmentIndex] > 0) {
         selection = SelectionKind::Equipment;
-    } else if (state.selectedInventoryIndex >= 0 && state.selectedInventoryIndex < static_cast<int>(state.inventoryItems.size()) && !state.inventoryItems[state.selectedInventoryIndex].empty()) {
+    } else if (state.selectedInventoryIndex >= 0 && state.selectedInventoryIndex < static_cast<int>(state.inventorySlots.size()) && state.inventorySlots[state.selectedInventoryIndex].itemId > 0) {
         selection = SelectionKind::Inventory;
     }
 
@@ -3371,10 +3296,10 @@ void RenderInventoryUI(InventoryUIState& state,
         tradeReadyForSelected = tradeActiveForSelected && state.shopTradeReadyToConfirm;
         if (tradeActiveForSelected) {
             tradeAllowedForSelected = true;
-        } else if (state.selectedShopIndex >= 0 && state.selectedShopIndex < static_cast<int>(state.shopItemIds.size())) {
+        } else if (state.selectedShopIndex >= 0 && state.selectedShopIndex < static_cast<int>(state.shopSlots.size())) {
             int rarity = selectedShopItemRarity;
-            if (rarity < 0 && state.selectedShopIndex < static_cast<int>(state.shopItemIds.size())) {
-                rarity = GetItemRarity(state, state.shopItemIds[state.selectedShopIndex]);
+            if (rarity < 0 && state.selectedShopIndex < static_cast<int>(state.shopSlots.size())) {
+                rarity = GetItemRarity(state, state.shopSlots[state.selectedShopIndex].itemId);
             }
             tradeAllowedForSelected = (rarity >= 0 && rarity < kMythicRarity);
         }
@@ -3436,7 +3361,7 @@ void RenderInventoryUI(InventoryUIState& state,
     const float feedbackMessageLeftInset = 24.0f;    // Ajuda a centralizar horizontalmente
     const float feedbackMessageBottomOffset = 34.0f; // Aumente para subir o texto de erro, diminua para descer
     if (!state.feedbackMessage.empty()) {
-        DrawTextEx(GetGameFont(), state.feedbackMessage.c_str(),
+        Counted::DrawTextEx(GetGameFont(18.0f), state.feedbackMessage.c_str(),
                    Vector2{detailRect.x + feedbackMessageLeftInset, detailRect.y + detailRect.height - feedbackMessageBottomOffset},
                    18.0f, 0.0f, Color{176, 64, 64, 255});
     }
@@ -3460,18 +3385,18 @@ void RenderInventoryUI(InventoryUIState& state,
                 HandleEquipInventory(state, state.selectedInventoryIndex);
             } else if (selection == SelectionKind::ShopItem) {
                 int shopIndex = state.selectedShopIndex;
-                if (shopIndex < 0 || shopIndex >= static_cast<int>(state.shopItemIds.size())) {
+                if (shopIndex < 0 || shopIndex >= static_cast<int>(state.shopSlots.size())) {
                     state.feedbackMessage = "Selecione um item valido da loja.";
                     state.feedbackTimer = 0.0f;
                 } else if (!tradeActiveForSelected) {
                     if (!tradeAllowedForSelected) {
                         state.feedbackMessage = "Este item nao pode ser trocado.";
                         state.feedbackTimer = 0.0f;
-                    } else if (shopIndex >= static_cast<int>(state.shopStock.size()) || state.shopStock[shopIndex] <= 0) {
+                    } else if (shopIndex >= static_cast<int>(state.shopSlots.size()) || state.shopSlots[shopIndex].stock <= 0) {
                         state.feedbackMessage = "Este item nao esta mais disponivel.";
                         state.feedbackTimer = 0.0f;
                     } else {
-                        int itemId = state.shopItemIds[shopIndex];
+                        int itemId = state.shopSlots[shopIndex].itemId;
                         if (itemId == 0) {
                             state.feedbackMessage = "Item indisponivel.";
                             state.feedbackTimer = 0.0f;
@@ -3503,19 +3428,19 @@ void RenderInventoryUI(InventoryUIState& state,
                     } else {
                         int inventoryIndex = state.shopTradeInventoryIndex;
                         int activeShopIndex = state.shopTradeShopIndex;
-                        if (inventoryIndex < 0 || inventoryIndex >= static_cast<int>(state.inventoryItemIds.size())) {
+                        if (inventoryIndex < 0 || inventoryIndex >= static_cast<int>(state.inventorySlots.size())) {
                             state.feedbackMessage = "Selecione um item valido do seu inventario.";
                             state.feedbackTimer = 0.0f;
-                        } else if (activeShopIndex < 0 || activeShopIndex >= static_cast<int>(state.shopItemIds.size())) {
+                        } else if (activeShopIndex < 0 || activeShopIndex >= static_cast<int>(state.shopSlots.size())) {
                             state.feedbackMessage = "Selecione um item valido da loja.";
                             state.feedbackTimer = 0.0f;
                             ResetShopTradeState(state);
-                        } else if (activeShopIndex >= static_cast<int>(state.shopStock.size()) || state.shopStock[activeShopIndex] <= 0) {
+                        } else if (activeShopIndex >= static_cast<int>(state.shopSlots.size()) || state.shopSlots[activeShopIndex].stock <= 0) {
                             state.feedbackMessage = "Este item nao esta mais disponivel.";
                             state.feedbackTimer = 0.0f;
                             ResetShopTradeState(state);
                         } else {
-                            int offeredId = state.inventoryItemIds[inventoryIndex];
+                            int offeredId = state.inventorySlots[inventoryIndex].itemId;
                             int offeredRarity = GetItemRarity(state, offeredId);
                             if (offeredId == 0) {
                                 state.feedbackMessage = "Selecione um item valido do seu inventario.";
@@ -3526,7 +3451,7 @@ void RenderInventoryUI(InventoryUIState& state,
                                 state.feedbackTimer = 0.0f;
                                 InvalidateTradeCandidate(state);
                             } else {
-                                int targetItemId = state.shopItemIds[activeShopIndex];
+                                int targetItemId = state.shopSlots[activeShopIndex].itemId;
                                 if (targetItemId == 0) {
                                     state.feedbackMessage = "Item indisponivel.";
                                     state.feedbackTimer = 0.0f;
@@ -3538,7 +3463,7 @@ void RenderInventoryUI(InventoryUIState& state,
                                         SetInventorySlot(state, inventoryIndex, targetItemId, 1);
                                         addedSlot = inventoryIndex;
                                     }
-                                    state.shopStock[activeShopIndex] = std::max(0, state.shopStock[activeShopIndex] - 1);
+                                    state.shopSlots[activeShopIndex].stock = std::max(0, state.shopSlots[activeShopIndex].stock - 1);
                                     state.selectedInventoryIndex = addedSlot;
                                     state.selectedShopIndex = activeShopIndex;
                                     ResetShopTradeState(state);
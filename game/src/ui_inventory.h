@@ -9,6 +9,8 @@
 #include <string>
 #include <vector>
 
+#include "forge_recipes.h"
+#include "item_registry.h"
 #include "room.h"
 #include "player.h"
 
@@ -27,45 +29,18 @@ enum class InventoryViewMode {
     Chest
 };
 
-// Agrupa itens em categorias para filtros, regras de pilha e crafting.
-enum class ItemCategory {
-    None,
-    Weapon,
-    Armor,
-    Consumable,
-    Material,
-    Result
-};
-
-using ItemAbilityHandler = std::function<bool(InventoryUIState&, PlayerCharacter&, int)>;
-
-// Representa habilidade ativa vinculada a um item (ex.: poção ou artefato).
-struct ItemActiveAbility {
-    std::string name;
-    std::string description;
-    float cooldownSeconds{0.0f};
-    bool consumesItemOnUse{false};
-    ItemAbilityHandler handler{};
-
-    bool IsValid() const { return static_cast<bool>(handler); }
-};
-
-// Metadados de um item disponível no protótipo do inventário.
-struct ItemDefinition {
-    int id{0};
-    std::string name;
-    ItemCategory category{ItemCategory::None};
-    std::string description;
-    int rarity{1};
-    int baseValue{0};
-    int value{0};
-    const WeaponBlueprint* weaponBlueprint{nullptr};
-    PlayerAttributes attributeBonuses{};
-    std::string inventorySpritePath;
-    Vector2 inventorySpriteDrawSize{0.0f, 0.0f};
-    ItemActiveAbility activeAbility{};
-
-    bool HasActiveAbility() const { return activeAbility.IsValid(); }
+// Quantidade fixa de slots de cada área do painel.
+constexpr int kInventorySlotCount = 24;
+constexpr int kWeaponSlotCount = 2;
+constexpr int kEquipmentSlotCount = 5;
+constexpr int kShopSlotCount = 4;
+constexpr int kMaxChestSlotCount = 24; // Capacidade do maior baú (baú pessoal)
+
+// Slot da vitrine da loja.
+struct ShopSlot {
+    int itemId{0};
+    int price{0};
+    int stock{0};
 };
 
 // Estado completo da interface de inventário (slots, seleção, forja, loja, baú).
@@ -100,32 +75,26 @@ struct InventoryUIState {
     float sellPriceMultiplier{0.2f}; // Base sell multiplier; meta progression can scale this later
     bool forgeEditingCost{false};
     std::array<int, 2> forgeInputIds{0, 0};
-    std::array<std::string, 2> forgeInputNames{};
     std::array<int, 2> forgeInputQuantities{0, 0};
     int forgeResultId{0};
-    std::string forgeResultName;
     int forgeResultQuantity{0};
     std::string feedbackMessage;
     float feedbackTimer{0.0f};
+    std::uint32_t contentVersion{0}; // Nova versão global a cada MarkInventoryDirty; invalida a camada do painel em cache
+    BiomeType lootBiome{BiomeType::Unknown}; // Bioma da sala atual; escolhe a tabela de loot de lojas e baús
+    float lootLuckBonus{0.0f};               // Sorte do jogador aplicada aos sorteios de loot
+    std::uint32_t gameDataVersion{0};        // Versão de GetGameData() usada para montar items/forgeRecipes
+    std::uint32_t equipmentVersion{0};       // Muda quando slots de equipamento ou definições mudam (NextStatVersion)
+    std::uint32_t weaponSlotVersion{0};      // Idem para os slots de arma; o jogador só reagrega bônus quando muda
 
     // Placeholder data for prototype
-    std::vector<ItemDefinition> items;
-    std::vector<int> weaponSlotIds;
-    std::vector<int> equipmentSlotIds;
-    std::vector<float> equipmentAbilityCooldowns;
-    std::vector<int> inventoryItemIds;
-    std::vector<int> inventoryQuantities;
-    std::vector<int> shopItemIds;
-    std::vector<int> shopPrices;
-    std::vector<int> shopStock;
-    std::vector<std::string> weaponSlots;
-    std::vector<std::string> equipmentSlots;
-    std::vector<std::string> inventoryItems;
-    std::vector<ItemCategory> inventoryTypes;
-    std::vector<std::string> shopItems;
-    std::vector<ItemCategory> shopTypes;
-    std::unordered_map<uint64_t, int> forgeRecipes;
-    std::unordered_map<std::string, int> itemNameToId;
+    ItemRegistry items; // Definições indexadas por id (O(1)) e por nome
+    std::array<int, kWeaponSlotCount> weaponSlotIds{};
+    std::array<int, kEquipmentSlotCount> equipmentSlotIds{};
+    std::array<float, kEquipmentSlotCount> equipmentAbilityCooldowns{};
+    std::array<ItemSlot, kInventorySlotCount> inventorySlots{};
+    std::array<ShopSlot, kShopSlotCount> shopSlots{};
+    ForgeRecipeBook forgeRecipes;
     Vector2 detailAbilityScroll{0.0f, 0.0f};
 
     enum class ChestUIType {
@@ -141,13 +110,14 @@ struct InventoryUIState {
     bool chestSupportsDeposit{false};
     bool chestSupportsTakeAll{false};
     std::string chestTitle;
-    std::vector<int> chestItemIds;
-    std::vector<int> chestQuantities;
-    std::vector<std::string> chestItems;
-    std::vector<ItemCategory> chestTypes;
+    std::array<ItemSlot, kMaxChestSlotCount> chestSlots{};
+    int chestSlotCount{0}; // Slots em uso de chestSlots (capacidade do baú aberto)
 };
 
-// Preenche o estado com dados fictícios enquanto o conteúdo real não existe.
+// Remonta o registro de itens e as receitas da forja a partir de GetGameData() (carga inicial ou recarga a quente).
+// Slots guardam só ids, então o conteúdo do inventário sobrevive; itens removidos do arquivo somem da UI.
+void ReloadItemDefinitions(InventoryUIState& state);
+// Reinicia slots, loja e forja para uma run nova; só remonta o registro de itens se os dados mudaram.
 void InitializeInventoryUIDummyData(InventoryUIState& state);
 // Renderiza o painel completo, incluindo informações do jogador e lojas ativas.
 void RenderInventoryUI(InventoryUIState& state,
@@ -157,9 +127,15 @@ void RenderInventoryUI(InventoryUIState& state,
                        Vector2 screenSize,
                        ShopInstance* activeShop);
 
+// Marca slots, moedas ou itens como alterados; todo handler que muda o conteúdo exibido deve chamar.
+void MarkInventoryDirty(InventoryUIState& state);
+// Libera a render texture do painel em cache; chamado antes de CloseWindow.
+void UnloadInventoryUICache();
+
 // Agrega bônus de equipamentos equipados para aplicar nas estatísticas.
 PlayerAttributes GatherEquipmentBonuses(const InventoryUIState& state);
-// Sincroniza atributos do jogador com o que está equipado no inventário.
+// Reagrega os bônus de equipamento no jogador só se os slots mudaram desde a última sincronização.
+// Retorna true se o bloco de equipamento mudou; o recálculo fica para PlayerCharacter::RefreshStats.
 bool SyncEquipmentBonuses(const InventoryUIState& state, PlayerCharacter& player);
 
 // Recupera definição de item pelo id (retorna nullptr se inexistente).
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <cstdint>
 #include <string>
 
 #include "player.h"
+#include "profiler.h"
 #include "projectile.h"
 
 // Define dano base da arma e quanto escala com o atributo principal.
@@ -62,6 +64,8 @@ struct WeaponState {
     const WeaponBlueprint* blueprint{nullptr};
     float cooldownTimer{0.0f};
     WeaponDerivedStats derived{};
+    const WeaponBlueprint* derivedBlueprint{nullptr}; // Blueprint e versão das stats do jogador do último recálculo
+    std::uint32_t derivedStatsVersion{0};
 
     // Atualiza temporizador de cooldown a cada quadro.
     void Update(float deltaSeconds) {
@@ -73,9 +77,21 @@ struct WeaponState {
         }
     }
 
+    // Recalcula só se o blueprint ou as stats do jogador mudaram desde o último recálculo; retorna true se recalculou.
+    bool RefreshDerivedStats(const PlayerCharacter& player) {
+        if (blueprint == derivedBlueprint && player.statsVersion == derivedStatsVersion) {
+            return false;
+        }
+        RecalculateDerivedStats(player);
+        return true;
+    }
+
     // Recalcula dano/cadência/crítico considerando atributos atuais do jogador.
     void RecalculateDerivedStats(const PlayerCharacter& player) {
+        CountStatRecompute(StatRecomputeKind::Weapon);
         derived = WeaponDerivedStats{};
+        derivedBlueprint = blueprint;
+        derivedStatsVersion = player.statsVersion;
 
         if (blueprint == nullptr) {
             return;
@@ -137,20 +153,14 @@ struct WeaponState {
         }
     }
 
-    // Propaga valores calculados (dano/crítico) para o projétil antes de spawnar.
-    void ApplyDerivedToProjectile(ProjectileBlueprint& projectile) const {
-        if (derived.damagePerShot > 0.0f) {
-            projectile.common.damage = derived.damagePerShot;
-        }
-        projectile.common.criticalChance = derived.criticalChance;
-        projectile.common.criticalMultiplier = derived.criticalMultiplier;
-
-        for (auto& thrown : projectile.thrownProjectiles) {
-            if (derived.damagePerShot > 0.0f) {
-                thrown.common.damage = derived.damagePerShot;
-            }
-            thrown.common.criticalChance = derived.criticalChance;
-            thrown.common.criticalMultiplier = derived.criticalMultiplier;
-        }
+    // Monta os overrides de dano/crítico do disparo; o blueprint do projétil permanece compartilhado.
+    ProjectileShotOverrides MakeShotOverrides() const {
+        ProjectileShotOverrides overrides{};
+        overrides.overrideDamage = derived.damagePerShot > 0.0f;
+        overrides.damage = derived.damagePerShot;
+        overrides.overrideCritical = true;
+        overrides.criticalChance = derived.criticalChance;
+        overrides.criticalMultiplier = derived.criticalMultiplier;
+        return overrides;
     }
 };
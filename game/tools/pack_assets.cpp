@@ -0,0 +1,129 @@
+// Empacota todos os arquivos de um diretório em um único .pak lido pelo jogo via memory-mapping.
+// Build/uso: `make assets_pak` (dentro de ./game) ou ./pack_assets <diretorio> <saida.pak>
+#include "asset_archive.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Arquivo coletado: caminho como o jogo o usa ("assets/img/...") e bytes brutos.
+struct PackedFile {
+    std::string path;
+    std::vector<char> bytes;
+};
+
+std::size_t AlignUp(std::size_t value, std::size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// Lê todos os arquivos regulares sob root; caminhos usam '/' independentemente da plataforma.
+bool CollectFiles(const fs::path& root, std::vector<PackedFile>& outFiles) {
+    std::error_code error;
+    for (fs::recursive_directory_iterator it(root, error), end; it != end; it.increment(error)) {
+        if (error) {
+            std::cerr << "[PackAssets] Falha ao percorrer " << root << ": " << error.message() << std::endl;
+            return false;
+        }
+        if (!it->is_regular_file()) {
+            continue;
+        }
+
+        std::ifstream input(it->path(), std::ios::binary);
+        if (!input) {
+            std::cerr << "[PackAssets] Nao foi possivel abrir " << it->path() << std::endl;
+            return false;
+        }
+
+        PackedFile file{};
+        file.path = it->path().lexically_normal().generic_string();
+        file.bytes.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+        outFiles.push_back(std::move(file));
+    }
+
+    // Ordem estável torna o arquivo reprodutível e permite busca binária no jogo.
+    std::sort(outFiles.begin(), outFiles.end(), [](const PackedFile& a, const PackedFile& b) {
+        return a.path < b.path;
+    });
+    return true;
+}
+
+bool WriteArchive(const std::vector<PackedFile>& files, const std::string& outputPath) {
+    using namespace AssetArchiveFormat;
+
+    std::size_t indexOffset = sizeof(Header);
+    std::size_t stringsOffset = indexOffset + files.size() * sizeof(IndexEntry);
+    std::size_t stringsSize = 0;
+    for (const PackedFile& file : files) {
+        stringsSize += file.path.size();
+    }
+
+    std::vector<IndexEntry> index(files.size());
+    std::size_t pathCursor = stringsOffset;
+    std::size_t dataCursor = AlignUp(stringsOffset + stringsSize, kDataAlignment);
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        index[i].pathOffset = static_cast<std::uint32_t>(pathCursor);
+        index[i].pathLength = static_cast<std::uint32_t>(files[i].path.size());
+        index[i].dataOffset = dataCursor;
+        index[i].dataSize = files[i].bytes.size();
+        pathCursor += files[i].path.size();
+        dataCursor = AlignUp(dataCursor + files[i].bytes.size(), kDataAlignment);
+    }
+
+    std::vector<char> image(dataCursor, 0);
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.entryCount = static_cast<std::uint32_t>(files.size());
+    std::memcpy(image.data(), &header, sizeof(Header));
+    if (!index.empty()) {
+        std::memcpy(image.data() + indexOffset, index.data(), index.size() * sizeof(IndexEntry));
+    }
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        std::memcpy(image.data() + index[i].pathOffset, files[i].path.data(), files[i].path.size());
+        if (!files[i].bytes.empty()) {
+            std::memcpy(image.data() + index[i].dataOffset, files[i].bytes.data(), files[i].bytes.size());
+        }
+    }
+
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+    if (!output) {
+        std::cerr << "[PackAssets] Nao foi possivel criar " << outputPath << std::endl;
+        return false;
+    }
+    output.write(image.data(), static_cast<std::streamsize>(image.size()));
+    return static_cast<bool>(output);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "Uso: pack_assets <diretorio-de-assets> <saida.pak>" << std::endl;
+        return 1;
+    }
+
+    std::vector<PackedFile> files;
+    if (!CollectFiles(argv[1], files)) {
+        return 1;
+    }
+    if (!WriteArchive(files, argv[2])) {
+        return 1;
+    }
+
+    std::size_t totalBytes = 0;
+    for (const PackedFile& file : files) {
+        totalBytes += file.bytes.size();
+    }
+    std::printf("[PackAssets] %zu arquivos (%zu bytes) -> %s\n", files.size(), totalBytes, argv[2]);
+    return 0;
+}